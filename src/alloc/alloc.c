@@ -0,0 +1,200 @@
+/**
+ * @file alloc.c
+ * @brief Implementation for the allocator hooks.
+ *
+ * Source code for the allocator interface the engine allocates through,
+ * the counters kept for each owner and a bump arena embedders can hand
+ * to a game.
+ *
+ * Design Philosophy:
+ *
+ * The engine allocates only when a board or an engine is built, and
+ * frees only when it is destroyed, so an allocator is two hooks and a
+ * context pointer. Releases pass the size back, so neither the hooks nor
+ * the counters need a header in front of each block. The counters live
+ * with their owner rather than the allocator: a board reports what it
+ * holds whichever allocator it shares.
+ *
+ * An arena hands out pieces of one block it never grows. Releasing into
+ * it does nothing; the embedder resets or drops the whole block once the
+ * games built from it are destroyed. A game built from an arena of
+ * engine__memory_size bytes calls malloc not even once.
+ *
+ * With MINESWEEPER_ALLOC_DEBUG defined, alloc__check_leaks reports on
+ * stderr every owner destroyed with memory still allocated.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "alloc/alloc.h"
+
+/**
+ * This function is the allocate hook of ALLOC_SYSTEM.
+ */
+static void *alloc__system_allocate(size_t size, void *context) {
+  (void) context;
+  return malloc(size);
+}
+
+/**
+ * This function is the release hook of ALLOC_SYSTEM.
+ */
+static void alloc__system_release(void *pointer, size_t size, void *context) {
+  (void) size;
+  (void) context;
+  free(pointer);
+}
+
+const struct Allocator ALLOC_SYSTEM = {alloc__system_allocate, alloc__system_release, NULL};
+
+/**
+ * This function allocates a block through an allocator and counts it
+ * against its owner. Returns NULL if the allocator is out of memory.
+ *
+ * @param size the size of the block in bytes
+ * @param allocator the allocator to allocate from
+ * @param stats the counters of the owner
+ *
+ * @return the block, or NULL
+ */
+void *alloc__allocate(size_t size, const struct Allocator *allocator, struct AllocStats *stats) {
+  void *pointer = allocator->allocate(size, allocator->context);
+  if (pointer == NULL) {
+    return NULL;
+  }
+
+  stats->allocations++;
+  stats->bytes += size;
+  stats->peak_bytes = stats->bytes > stats->peak_bytes ? stats->bytes : stats->peak_bytes;
+  return pointer;
+}
+
+/**
+ * This function gives a block back to the allocator it came from. NULL
+ * is ignored, as free does.
+ *
+ * @param pointer the block, or NULL
+ * @param size the size the block was allocated with
+ * @param allocator the allocator it came from
+ * @param stats the counters of the owner
+ */
+void alloc__release(void *pointer, size_t size, const struct Allocator *allocator, struct AllocStats *stats) {
+  if (pointer == NULL) {
+    return;
+  }
+
+  stats->releases++;
+  stats->bytes -= size;
+  allocator->release(pointer, size, allocator->context);
+}
+
+/**
+ * This function checks that an owner being destroyed released every
+ * block it allocated. With MINESWEEPER_ALLOC_DEBUG defined, a leak is
+ * reported on stderr.
+ *
+ * @param owner what is being destroyed, for the report
+ * @param stats the counters of the owner
+ *
+ * @return true if nothing leaked; false otherwise
+ */
+bool alloc__check_leaks(const char *owner, const struct AllocStats *stats) {
+  bool clean = stats->bytes == 0 && stats->allocations == stats->releases;
+
+#if defined(MINESWEEPER_ALLOC_DEBUG)
+  if (!clean) {
+    fprintf(stderr, "Leak: %s destroyed with %zu bytes in %ld of %ld blocks still allocated\n", owner, stats->bytes,
+            stats->allocations - stats->releases, stats->allocations);
+  }
+#else
+  (void) owner;
+#endif
+  return clean;
+}
+
+/**
+ * This function rounds a size up to ALLOC_ALIGNMENT, the space a block
+ * of that size takes in an arena.
+ *
+ * @param size the size in bytes
+ *
+ * @return the rounded size
+ */
+size_t alloc__round(size_t size) {
+  return (size + ALLOC_ALIGNMENT - 1) & ~(size_t) (ALLOC_ALIGNMENT - 1);
+}
+
+//-----------//
+//   ARENA   //
+//-----------//
+
+/**
+ * This function is the allocate hook of an arena. Returns NULL once the
+ * block is used up.
+ */
+static void *arena__allocate(size_t size, void *context) {
+  struct Arena *arena = (struct Arena *)context;
+  size_t rounded = alloc__round(size);
+
+  if (rounded < size || rounded > arena->capacity - arena->used) {
+    return NULL;
+  }
+  void *pointer = arena->memory + arena->used;
+  arena->used += rounded;
+  return pointer;
+}
+
+/**
+ * This function is the release hook of an arena, which keeps its memory
+ * until it is reset.
+ */
+static void arena__release(void *pointer, size_t size, void *context) {
+  (void) pointer;
+  (void) size;
+  (void) context;
+}
+
+/**
+ * This function sets up an arena over a caller-owned block. The start of
+ * the block is moved up to ALLOC_ALIGNMENT, which can cost a few bytes
+ * of its capacity.
+ *
+ * @param memory the block
+ * @param capacity the size of the block in bytes
+ * @param arena the arena to set up
+ */
+void arena__init(void *memory, size_t capacity, struct Arena *arena) {
+  size_t skip = alloc__round((uintptr_t) memory) - (uintptr_t) memory;
+
+  arena->memory = (char *)memory + (skip < capacity ? skip : capacity);
+  arena->capacity = skip < capacity ? capacity - skip : 0;
+  arena->used = 0;
+}
+
+/**
+ * This function empties an arena, so its whole block can be handed out
+ * again. Everything allocated from it must be destroyed first.
+ *
+ * @param arena the arena to empty
+ */
+void arena__reset(struct Arena *arena) {
+  arena->used = 0;
+}
+
+/**
+ * This function returns an allocator that allocates from an arena. The
+ * arena must outlive everything built with it.
+ *
+ * @param arena the arena
+ *
+ * @return the allocator
+ */
+struct Allocator arena__allocator(struct Arena *arena) {
+  struct Allocator allocator = {arena__allocate, arena__release, arena};
+  return allocator;
+}
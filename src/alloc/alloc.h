@@ -0,0 +1,46 @@
+/**
+ * @file alloc.h
+ * @brief The header for alloc.
+ */
+#ifndef ALLOC_H
+#define ALLOC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define ALLOC_ALIGNMENT 16 // every block an arena hands out starts on this boundary
+
+// where an engine object gets its memory from
+struct Allocator {
+    void* (*allocate)(size_t size, void* context);               // NULL when out of memory
+    void  (*release)(void* pointer, size_t size, void* context); // size as allocated
+    void*  context;
+};
+
+// what one owner, such as a board, has allocated
+struct AllocStats {
+    size_t bytes;       // allocated and not yet released
+    size_t peak_bytes;
+    long   allocations; // calls that returned memory
+    long   releases;
+};
+
+// bump allocation from one caller-owned block; releases give nothing back
+struct Arena {
+    char*  memory;
+    size_t capacity;
+    size_t used;
+};
+
+extern const struct Allocator ALLOC_SYSTEM; // malloc and free
+
+void*  alloc__allocate(size_t size, const struct Allocator* allocator, struct AllocStats* stats);
+void   alloc__release(void* pointer, size_t size, const struct Allocator* allocator, struct AllocStats* stats);
+bool   alloc__check_leaks(const char* owner, const struct AllocStats* stats);
+size_t alloc__round(size_t size);
+
+void             arena__init(void* memory, size_t capacity, struct Arena* arena);
+void             arena__reset(struct Arena* arena);
+struct Allocator arena__allocator(struct Arena* arena);
+
+#endif // ALLOC_H
@@ -0,0 +1,1113 @@
+/**
+ * @file bench.c
+ * @brief Implementation for the benchmarks.
+ *
+ * Source code for the benchmarks that measure the engine library from
+ * the command line.
+ *
+ * Design Philosophy:
+ *
+ * The library does not print, so measuring it and reporting the numbers
+ * happens here. Every benchmark uses fixed seeds, so two runs play the
+ * same games and only the timing differs.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench/bench.h"
+#include "coop/coop.h"
+#include "env/env.h"
+#include "game/game.h"
+#include "rng/rng.h"
+#include "solver/endgame.h"
+#include "solver/guesser.h"
+#include "solver/patterns.h"
+#include "solver/solver.h"
+#include "thread/thread_pool.h"
+
+#define BENCH_SWEEP_MAX   32   // sizes or densities a sweep takes
+#define BENCH_SWEEP_CHUNK 25   // games of a sweep task, so threads share the large boards
+#define BENCH_SWEEP_Z     1.96 // the 95% confidence interval of the win rate
+
+/**
+ * This function returns the wall clock in seconds.
+ *
+ * @return the current time
+ */
+static double bench__now() {
+  struct timespec now;
+  timespec_get(&now, TIME_UTC);
+  return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/**
+ * This function measures the step throughput of a batch of beginner
+ * games played with random reveals of hidden cells. Only the time spent
+ * in env__step is counted. Returns the exit code of the program.
+ *
+ * @param num_envs the number of games in the batch
+ * @param threads the number of worker threads
+ * @param steps the total number of env steps to run
+ *
+ * @return the exit code
+ */
+int bench__env(int num_envs, int threads, int steps) {
+  struct EnvConfig config = {
+      .rows = 9,
+      .cols = 9,
+      .mines = 10,
+      .threads = threads,
+      .seed = 1,
+      .first_click = GAME_FIRST_CLICK_ANY,
+  };
+  struct Env env;
+  struct Rng rng;
+  double seconds = 0;
+  long long done_count = 0;
+
+  if (!env__create(num_envs, &config, &env)) {
+    fprintf(stderr, "Invalid environment configuration\n");
+    return 1;
+  }
+  int cells = config.rows * config.cols;
+  uint8_t *observations = (uint8_t *)malloc((size_t) num_envs * cells);
+  int32_t *actions = (int32_t *)malloc(num_envs * sizeof(int32_t));
+  float *rewards = (float *)malloc(num_envs * sizeof(float));
+  uint8_t *dones = (uint8_t *)malloc(num_envs);
+
+  rng__seed(3, &rng);
+  env__reset(observations, &env);
+  int iterations = steps / num_envs > 0 ? steps / num_envs : 1;
+  for (int step = 0; step < iterations; step++) {
+    for (int i = 0; i < num_envs; i++) {
+      int cell;
+      do {
+        cell = rng__below(cells, &rng);
+      } while (observations[(size_t) i * cells + cell] != ENV_CELL_HIDDEN);
+      actions[i] = cell;
+    }
+
+    double start = bench__now();
+    env__step(actions, observations, rewards, dones, &env);
+    seconds += bench__now() - start;
+
+    for (int i = 0; i < num_envs; i++) {
+      done_count += dones[i];
+    }
+  }
+
+  printf("Envs: %d, threads: %d, steps: %lld, episodes: %lld\n", num_envs, threads,
+         (long long) iterations * num_envs, done_count);
+  printf("Steps/sec: %.0f\n", (double) iterations * num_envs / seconds);
+
+  free(observations);
+  free(actions);
+  free(rewards);
+  free(dones);
+  env__destruct(&env);
+  return 0;
+}
+
+/**
+ * This function labels a board from scratch and returns how long it took.
+ *
+ * @param board the board to label
+ *
+ * @return the time in seconds
+ */
+static double bench__time_label(struct Board *board) {
+  double start = bench__now();
+  board->counts_ready = false;
+  board__label_openings(board);
+  return bench__now() - start;
+}
+
+/**
+ * This function reveals the largest opening of a labeled board and
+ * returns how long it took.
+ *
+ * @param board the board to reveal on
+ *
+ * @return the time in seconds
+ */
+static double bench__time_reveal(struct Board *board) {
+  int largest = 0;
+  for (int i = 1; i < board__get_num_openings(board); i++) {
+    if (board->opening_start[i + 1] - board->opening_start[i] >
+        board->opening_start[largest + 1] - board->opening_start[largest]) {
+      largest = i;
+    }
+  }
+  int cell = board->opening_cells[board->opening_start[largest]];
+
+  double start = bench__now();
+  board__clear_changes(board);
+  board__reveal(board__index_x(cell, board), board__index_y(cell, board), board);
+  return bench__now() - start;
+}
+
+/**
+ * This function returns whether two boards ended up in the same state,
+ * journal included.
+ *
+ * @param first a board
+ * @param second a board of the same size
+ *
+ * @return true if the same; false otherwise
+ */
+static bool bench__same_board(struct Board *first, struct Board *second) {
+  size_t cells = (size_t) first->board_cells;
+  int tiles = board__get_x(first) * board__get_y(first);
+
+  return memcmp(first->board_pointer, second->board_pointer, cells) == 0 &&
+         memcmp(first->reveal_pointer, second->reveal_pointer, cells) == 0 &&
+         memcmp(first->count_pointer, second->count_pointer, cells) == 0 &&
+         memcmp(first->opening_cells, second->opening_cells, tiles * sizeof(int)) == 0 &&
+         board__get_3bv(first) == board__get_3bv(second) &&
+         board__get_num_openings(first) == board__get_num_openings(second) &&
+         board__get_num_revealed(first) == board__get_num_revealed(second) &&
+         board__get_num_changes(first) == board__get_num_changes(second) &&
+         memcmp(first->changed_cells, second->changed_cells, board__get_num_changes(first) * sizeof(int)) == 0;
+}
+
+/**
+ * This function measures labeling a huge board and revealing its largest
+ * opening, once on the serial path and once on a thread pool, and checks
+ * that both give the same board. One mine in twenty leaves an opening
+ * spanning most of the board. Returns the exit code of the program.
+ *
+ * @param size the number of rows and columns
+ * @param threads the number of worker threads
+ *
+ * @return the exit code
+ */
+int bench__board(int size, int threads) {
+  struct Game serial;
+  struct Game parallel;
+  struct ThreadPool pool;
+  int mines = (int) ((long long) size * size / 20);
+
+  if (!thread_pool__create(threads, &pool)) {
+    fprintf(stderr, "Could not start %d threads\n", threads);
+    return 1;
+  }
+  if (!board__build_array(size, size, &serial.board) || !board__build_array(size, size, &parallel.board)) {
+    fprintf(stderr, "Could not build a %dx%d board\n", size, size);
+    return 1;
+  }
+  if (!board__set_pool(&pool, &parallel.board)) {
+    fprintf(stderr, "Could not give the board a pool\n");
+    return 1;
+  }
+  game__reset_game(mines, 5, &serial);
+  game__reset_game(mines, 5, &parallel);
+
+  double serial_label = bench__time_label(&serial.board);
+  double parallel_label = bench__time_label(&parallel.board);
+  double serial_reveal = bench__time_reveal(&serial.board);
+  double parallel_reveal = bench__time_reveal(&parallel.board);
+  bool same = bench__same_board(&serial.board, &parallel.board);
+
+  printf("Board: %dx%d, mines: %d, threads: %d, revealed: %d\n", size, size, mines, threads,
+         board__get_num_revealed(&serial.board));
+  printf("Label:  serial %.3f s, parallel %.3f s, speedup %.2fx\n", serial_label, parallel_label,
+         serial_label / parallel_label);
+  printf("Reveal: serial %.3f s, parallel %.3f s, speedup %.2fx\n", serial_reveal, parallel_reveal,
+         serial_reveal / parallel_reveal);
+  printf("Results: %s\n", same ? "identical" : "DIFFERENT");
+
+  board__destruct(&serial.board);
+  board__destruct(&parallel.board);
+  thread_pool__destruct(&pool);
+  return same ? 0 : 1;
+}
+
+/**
+ * This function counts the adjacent mines of every tile column after
+ * column, the access order that row-major storage serves worst, and
+ * returns how long it took.
+ *
+ * @param board the board to sweep
+ * @param total receives the sum of the counts
+ *
+ * @return the time in seconds
+ */
+static double bench__time_sweep(struct Board *board, long long *total) {
+  double start = bench__now();
+  *total = 0;
+  for (int j = 0; j < board__get_y(board); j++) {
+    for (int i = 0; i < board__get_x(board); i++) {
+      *total += board__count_num_adjacent(i, j, board);
+    }
+  }
+  return bench__now() - start;
+}
+
+/**
+ * This function compares the memory layouts of the board at a few sizes:
+ * labeling, revealing the largest opening and a column by column sweep
+ * of the adjacent mine counts. Every layout plays the same board, and
+ * the 3BV, the revealed tiles and the sweep must agree. Returns the exit
+ * code of the program.
+ *
+ * @return the exit code
+ */
+int bench__layouts() {
+  static const int SIZES[] = {250, 1000, 4000};
+  static const char *NAMES[] = {"rows", "tiles", "morton"};
+  bool same = true;
+
+  printf("%6s %-7s %10s %10s %10s\n", "size", "layout", "label ms", "reveal ms", "sweep ms");
+  for (int s = 0; s < (int) (sizeof(SIZES) / sizeof(SIZES[0])); s++) {
+    int size = SIZES[s];
+    int bbbv = 0;
+    int revealed = 0;
+    long long sweep = 0;
+
+    for (int layout = BOARD_LAYOUT_ROWS; layout <= BOARD_LAYOUT_MORTON; layout++) {
+      struct Game game;
+      long long total;
+      if (!board__build_array_layout(size, size, (enum BoardLayout) layout, &game.board)) {
+        fprintf(stderr, "Could not build a %dx%d board\n", size, size);
+        return 1;
+      }
+      game__reset_game(size * size / 20, 5, &game);
+
+      double label = bench__time_label(&game.board);
+      double sweep_time = bench__time_sweep(&game.board, &total);
+      double reveal = bench__time_reveal(&game.board);
+      printf("%6d %-7s %10.2f %10.2f %10.2f\n", size, NAMES[layout], label * 1e3, reveal * 1e3, sweep_time * 1e3);
+
+      if (layout == BOARD_LAYOUT_ROWS) {
+        bbbv = board__get_3bv(&game.board);
+        revealed = board__get_num_revealed(&game.board);
+        sweep = total;
+      }
+      same = same && bbbv == board__get_3bv(&game.board) && revealed == board__get_num_revealed(&game.board) &&
+             sweep == total;
+      board__destruct(&game.board);
+    }
+  }
+
+  printf("Results: %s\n", same ? "identical" : "DIFFERENT");
+  return same ? 0 : 1;
+}
+
+/**
+ * This function compares the topologies of the board. For each size it
+ * builds a board of every topology with the same mine density, then
+ * times labeling it from scratch and revealing its largest opening.
+ * Returns the exit code of the program.
+ *
+ * @return the exit code
+ */
+int bench__topologies() {
+  static const int SIZES[] = {250, 1000, 4000};
+  static const char *NAMES[] = {"square", "torus", "hex", "knight"};
+  const struct BoardTopology *topologies[] = {&BOARD_TOPOLOGY_SQUARE, &BOARD_TOPOLOGY_TORUS, &BOARD_TOPOLOGY_HEX,
+                                              &BOARD_TOPOLOGY_KNIGHT};
+
+  printf("%6s %-7s %10s %10s %10s %10s\n", "size", "shape", "label ms", "reveal ms", "3BV", "revealed");
+  for (int s = 0; s < (int) (sizeof(SIZES) / sizeof(SIZES[0])); s++) {
+    int size = SIZES[s];
+    for (int t = 0; t < (int) (sizeof(topologies) / sizeof(topologies[0])); t++) {
+      struct Game game;
+      if (!board__build_array_topology(size, size, topologies[t], &game.board)) {
+        fprintf(stderr, "Could not build a %dx%d board\n", size, size);
+        return 1;
+      }
+      game__reset_game(size * size / 20, 5, &game);
+
+      double label = bench__time_label(&game.board);
+      double reveal = bench__time_reveal(&game.board);
+      printf("%6d %-7s %10.2f %10.2f %10d %10d\n", size, NAMES[t], label * 1e3, reveal * 1e3,
+             board__get_3bv(&game.board), board__get_num_revealed(&game.board));
+      board__destruct(&game.board);
+    }
+  }
+  return 0;
+}
+
+/**
+ * This function times starting games on one board: placing the mines and
+ * labeling the board for each seed in turn. Returns the summed 3BV, so
+ * two runs can be checked for the same boards.
+ *
+ * @param games the number of games to start
+ * @param mines the number of mines of each game
+ * @param game the game to reset
+ * @param seconds the time taken
+ *
+ * @return the summed 3BV
+ */
+static long long bench__time_resets(int games, int mines, struct Game *game, double *seconds) {
+  long long bbbv = 0;
+  double start = bench__now();
+  for (int i = 0; i < games; i++) {
+    game__reset_game(mines, (uint64_t) i, game);
+    bbbv += game__get_3bv(game);
+  }
+  *seconds = bench__now() - start;
+  return bbbv;
+}
+
+/**
+ * This function compares the code built for each preset with the
+ * generic code on boards of the same size. Both start the same games,
+ * so their summed 3BV must agree. Returns the exit code of the program.
+ *
+ * @param games the number of games to start per preset and path
+ *
+ * @return the exit code
+ */
+int bench__presets(int games) {
+  static const struct {
+    const char *name;
+    int rows;
+    int cols;
+    int mines;
+  } PRESETS[] = {
+#define BENCH_PRESET(NAME, name, rows, cols, mines) {#name, rows, cols, mines},
+      BOARD_PRESETS(BENCH_PRESET)
+#undef BENCH_PRESET
+  };
+  bool same = true;
+
+  printf("%-13s %14s %14s %8s\n", "preset", "generic /sec", "preset /sec", "speedup");
+  for (int p = 0; p < BOARD_NUM_PRESETS; p++) {
+    struct Game game;
+    double generic;
+    double preset;
+    if (!board__build_array(PRESETS[p].cols, PRESETS[p].rows, &game.board)) {
+      fprintf(stderr, "Could not build a %dx%d board\n", PRESETS[p].rows, PRESETS[p].cols);
+      return 1;
+    }
+
+    long long preset_bbbv = bench__time_resets(games, PRESETS[p].mines, &game, &preset);
+    game.board.board_preset = BOARD_PRESET_NONE;
+    long long generic_bbbv = bench__time_resets(games, PRESETS[p].mines, &game, &generic);
+    printf("%-13s %14.0f %14.0f %7.2fx\n", PRESETS[p].name, games / generic, games / preset, generic / preset);
+
+    same = same && preset_bbbv == generic_bbbv;
+    board__destruct(&game.board);
+  }
+
+  printf("Results: %s\n", same ? "identical" : "DIFFERENT");
+  return same ? 0 : 1;
+}
+
+// what bench__play_solver plays: the boards, and the bots beside the solver
+struct BenchSolverPlan {
+    int                         width;        // columns
+    int                         height;       // rows
+    int                         mines;
+    uint64_t                    seed;         // game i is seeded with seed + i
+    int                         games;
+    bool                        use_patterns; // look moves up in the pattern table first
+    const struct GuesserConfig* guesser;      // or NULL for random guesses
+    const struct EndgameConfig* endgame;      // or NULL for none
+};
+
+// totals of the games bench__play_solver played
+struct BenchSolverRun {
+    int       wins;
+    long long moves;
+    long long guesses;
+    long long from_patterns; // moves the pattern table found
+    long long wrong;         // deduced moves that hit a mine or flagged a safe tile
+    double    seconds;
+    double    deducing;      // time spent finding moves, guesses aside
+    double    guessing;      // time spent picking guesses
+    long long endgame_moves; // moves the endgame search picked
+    struct EndgameStats endgame;
+};
+
+/**
+ * This function picks the next move of a solver game: a tile proved
+ * safe, else a mine proved but not flagged yet, else a guess at a tile
+ * the solver could not settle. With patterns, a tile they force is
+ * taken before the solver is asked. A guess comes from the endgame
+ * search when few tiles are left, else from the guesser; without
+ * either, guesses are random.
+ *
+ * @param x where to store the x coordinate
+ * @param y where to store the y coordinate
+ * @param solver the solver, up to date with the board
+ * @param patterns the patterns, up to date with the board, or NULL
+ * @param endgame the endgame search, or NULL
+ * @param guesser the guesser, or NULL
+ * @param mines the mines on the board
+ * @param rng the source of random guesses
+ *
+ * @return 'r' to reveal a safe tile, 'f' to flag, 'p' and 'm' for a safe
+ *         tile and a mine the patterns found, 'e' for a reveal the
+ *         endgame search picked, or 'g' for a guessed reveal
+ */
+static char bench__solver_move(int *x, int *y, struct Solver *solver, struct Patterns *patterns,
+                               struct Endgame *endgame, struct Guesser *guesser, int mines, struct Rng *rng) {
+  struct Board *board = solver->board;
+  int rows = board__get_x(board);
+  int cols = board__get_y(board);
+  bool mine;
+
+  if (solver__next_safe(x, y, solver)) {
+    return 'r';
+  }
+  if (patterns != NULL && patterns__next(x, y, &mine, patterns)) {
+    solver__learn(*x, *y, mine, solver);
+    return mine ? 'm' : 'p';
+  }
+  solver__solve(solver);
+  if (solver__next_safe(x, y, solver)) {
+    return 'r';
+  }
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      if (solver__get_cell(i, j, solver) == SOLVER_MINE && board__get_cell(i, j, board) != 'F') {
+        *x = i;
+        *y = j;
+        return 'f';
+      }
+    }
+  }
+  if (endgame != NULL && endgame__choose(x, y, mines, endgame)) {
+    return 'e';
+  }
+  if (guesser != NULL && guesser__choose(x, y, mines, guesser)) {
+    return 'g';
+  }
+  do {
+    *x = rng__below(rows, rng);
+    *y = rng__below(cols, rng);
+  } while (solver__get_cell(*x, *y, solver) != SOLVER_UNKNOWN || board__get_cell(*x, *y, board) == 'F');
+  return 'g';
+}
+
+/**
+ * This function plays games with the solver: it reveals every tile
+ * proved safe and flags every mine proved, and only guesses when there
+ * is neither. The first click is in the middle and opens. Plans with the
+ * same boards and seed play the same games, whatever bots they add.
+ *
+ * @param plan the games to play and the bots to play them with
+ * @param run where to store the totals
+ *
+ * @return true if played; false if out of memory
+ */
+static bool bench__play_solver(const struct BenchSolverPlan *plan, struct BenchSolverRun *run) {
+  const struct GuesserConfig *config = plan->guesser;
+  const struct EndgameConfig *endgame_config = plan->endgame;
+  struct Game game;
+  struct Solver solver;
+  struct Patterns patterns;
+  struct Guesser guesser;
+  struct Endgame endgame;
+  struct Rng rng;
+
+  memset(run, 0, sizeof(*run));
+  if (!game__build_game_seeded(plan->width, plan->height, plan->mines, plan->seed, &game)) {
+    return false;
+  }
+  if (!solver__create(&game.board, &solver)) {
+    board__destruct(&game.board);
+    return false;
+  }
+  if (!patterns__create(&solver, &patterns)) {
+    solver__destruct(&solver);
+    board__destruct(&game.board);
+    return false;
+  }
+  if (config != NULL && !guesser__create(&game.board, config, &guesser)) {
+    patterns__destruct(&patterns);
+    solver__destruct(&solver);
+    board__destruct(&game.board);
+    return false;
+  }
+  if (endgame_config != NULL && !endgame__create(&game.board, endgame_config, &endgame)) {
+    if (config != NULL) {
+      guesser__destruct(&guesser);
+    }
+    patterns__destruct(&patterns);
+    solver__destruct(&solver);
+    board__destruct(&game.board);
+    return false;
+  }
+  game__set_first_click(GAME_FIRST_CLICK_OPENING, &game);
+  rng__seed(plan->seed + 1, &rng);
+
+  double start = bench__now();
+  for (int i = 0; i < plan->games; i++) {
+    game__reset_game(plan->mines, plan->seed + i, &game);
+    solver__reset(&solver);
+    patterns__reset(&patterns);
+    int x = board__get_x(&game.board) / 2;
+    int y = board__get_y(&game.board) / 2;
+    char move = 'g';
+    enum GameStatus status = GAME_STATUS_OK;
+
+    while (status == GAME_STATUS_OK) {
+      bool flag = move == 'f' || move == 'm';
+      run->wrong += flag && !board__contains_mine(x, y, &game.board);
+      board__clear_changes(&game.board);
+      status = game__apply(flag ? 'f' : 'r', x, y, &game);
+      run->moves++;
+      run->guesses += move == 'g';
+      run->from_patterns += move == 'p' || move == 'm';
+      run->endgame_moves += move == 'e';
+      run->wrong += move != 'g' && move != 'e' && status == GAME_STATUS_LOSS;
+      if (status != GAME_STATUS_OK) {
+        break;
+      }
+
+      double deduce_start = bench__now();
+      solver__update(&solver);
+      if (plan->use_patterns) {
+        patterns__update(&patterns);
+      }
+      move = bench__solver_move(&x, &y, &solver, plan->use_patterns ? &patterns : NULL,
+                                endgame_config != NULL ? &endgame : NULL, config != NULL ? &guesser : NULL,
+                                plan->mines, &rng);
+      double deduce_end = bench__now();
+      if (move == 'g' || move == 'e') {
+        run->guessing += deduce_end - deduce_start;
+      } else {
+        run->deducing += deduce_end - deduce_start;
+      }
+    }
+    run->wins += status == GAME_STATUS_WIN;
+  }
+  run->seconds = bench__now() - start;
+
+  if (endgame_config != NULL) {
+    endgame__get_stats(&endgame, &run->endgame);
+    endgame__destruct(&endgame);
+  }
+  if (config != NULL) {
+    guesser__destruct(&guesser);
+  }
+  patterns__destruct(&patterns);
+  solver__destruct(&solver);
+  board__destruct(&game.board);
+  return true;
+}
+
+/**
+ * This function flags, guesses and flags again half the mines of a
+ * small board. A guess takes a flag off, so the mines must count once
+ * each and the game must not be won.
+ *
+ * @return true if the game was not won and the counts are right; false
+ *         otherwise, or if out of memory
+ */
+static bool bench__check_reflag() {
+  struct Game game;
+  int mines = 10;
+  int reflagged = 0;
+  bool won = false;
+
+  if (!game__build_game_seeded(9, 9, mines, 0, &game)) {
+    return false;
+  }
+  for (int x = 0; x < board__get_x(&game.board) && reflagged < mines / 2; x++) {
+    for (int y = 0; y < board__get_y(&game.board) && reflagged < mines / 2; y++) {
+      if (board__contains_mine(x, y, &game.board)) {
+        won |= game__apply('f', x, y, &game) == GAME_STATUS_WIN;
+        won |= game__apply('g', x, y, &game) == GAME_STATUS_WIN;
+        won |= game__apply('f', x, y, &game) == GAME_STATUS_WIN;
+        reflagged++;
+      }
+    }
+  }
+  bool counted = board__get_num_mines(&game.board) == mines - reflagged &&
+                 board__get_num_flags(&game.board) == reflagged;
+  board__destruct(&game.board);
+  return !won && counted;
+}
+
+/**
+ * This function plays expert games with the constraint solver and
+ * reports how many it won and how fast it moved. Deduced moves must
+ * never be wrong, and flagging a mine again after a guess must not win.
+ * Returns the exit code of the program.
+ *
+ * @param games the number of games to play
+ *
+ * @return the exit code
+ */
+int bench__solver(int games) {
+  struct BenchSolverPlan plan = {30, 16, 99, 0, games, false, NULL, NULL};
+  struct BenchSolverRun run;
+
+  if (!bench__play_solver(&plan, &run)) {
+    fprintf(stderr, "Could not build an expert game\n");
+    return 1;
+  }
+
+  printf("Games: %d, won %.1f%%\n", games, 100.0 * run.wins / games);
+  printf("Moves: %lld (%.0f/sec), %lld guesses\n", run.moves, run.moves / run.seconds, run.guesses);
+  printf("Solver: %.2f us per move\n", 1e6 * run.deducing / run.moves);
+  printf("Wrong deductions: %lld\n", run.wrong);
+  bool reflag = bench__check_reflag();
+  printf("Flag, guess, flag: %s\n", reflag ? "counted once" : "WON WITH MINES UNFLAGGED");
+  return run.wrong == 0 && reflag ? 0 : 1;
+}
+
+/**
+ * This function plays the same expert games with the solver alone and
+ * with the pattern table in front of it, and reports how many moves the
+ * table found and what the time to find a move became. Both must win
+ * the same share of games within noise and never deduce wrong. Returns
+ * the exit code of the program.
+ *
+ * @param games the number of games to play with each
+ *
+ * @return the exit code
+ */
+int bench__patterns(int games) {
+  struct BenchSolverRun runs[2];
+
+  for (int p = 0; p < 2; p++) {
+    struct BenchSolverPlan plan = {30, 16, 99, 0, games, p == 1, NULL, NULL};
+    if (!bench__play_solver(&plan, &runs[p])) {
+      fprintf(stderr, "Could not build an expert game\n");
+      return 1;
+    }
+  }
+
+  printf("%-18s %8s %10s %12s %13s %7s\n", "", "won", "moves/sec", "us per move", "from patterns", "wrong");
+  for (int p = 0; p < 2; p++) {
+    printf("%-18s %7.1f%% %10.0f %12.2f %12.1f%% %7lld\n", p == 0 ? "solver" : "patterns + solver",
+           100.0 * runs[p].wins / games, runs[p].moves / runs[p].seconds, 1e6 * runs[p].deducing / runs[p].moves,
+           100.0 * runs[p].from_patterns / runs[p].moves, runs[p].wrong);
+  }
+  return runs[0].wrong == 0 && runs[1].wrong == 0 ? 0 : 1;
+}
+
+/**
+ * This function plays the same expert games with patterns and the
+ * solver, guessing at random and with the Monte Carlo guesser, and
+ * reports the win rate and the cost of each guess. Returns the exit
+ * code of the program.
+ *
+ * @param games the number of games to play with each
+ * @param threads the worker threads of the guesser
+ * @param ms the time budget of a guess in milliseconds
+ *
+ * @return the exit code
+ */
+int bench__guesser(int games, int threads, int ms) {
+  struct GuesserConfig config = {threads, ms / 1000.0, 0, 0.05, 1};
+  struct BenchSolverRun runs[2];
+
+  for (int g = 0; g < 2; g++) {
+    struct BenchSolverPlan plan = {30, 16, 99, 0, games, true, g == 1 ? &config : NULL, NULL};
+    if (!bench__play_solver(&plan, &runs[g])) {
+      fprintf(stderr, "Could not build an expert game\n");
+      return 1;
+    }
+  }
+
+  printf("%-12s %8s %16s %14s %7s\n", "", "won", "guesses/game", "ms per guess", "wrong");
+  for (int g = 0; g < 2; g++) {
+    printf("%-12s %7.1f%% %16.2f %14.3f %7lld\n", g == 0 ? "random" : "monte carlo", 100.0 * runs[g].wins / games,
+           (double)runs[g].guesses / games, 1e3 * runs[g].guessing / runs[g].guesses, runs[g].wrong);
+  }
+  return runs[0].wrong == 0 && runs[1].wrong == 0 ? 0 : 1;
+}
+
+/**
+ * This function plays the same expert games with patterns, the solver
+ * and the Monte Carlo guesser, without and with the endgame search, and
+ * reports the win rate, the cost of an endgame move and how often the
+ * transposition table answered. Returns the exit code of the program.
+ *
+ * @param games the number of games to play with each
+ * @param threshold the most hidden tiles the endgame search takes
+ * @param ms the time budget of an endgame move in milliseconds
+ *
+ * @return the exit code
+ */
+int bench__endgame(int games, int threshold, int ms) {
+  struct GuesserConfig config = {0, 0, 2000, 0.05, 1};
+  struct EndgameConfig endgame_config = {threshold, ms / 1000.0, 18, 1 << 16};
+  struct BenchSolverRun runs[2];
+
+  for (int e = 0; e < 2; e++) {
+    struct BenchSolverPlan plan = {30, 16, 99, 0, games, true, &config, e == 1 ? &endgame_config : NULL};
+    if (!bench__play_solver(&plan, &runs[e])) {
+      fprintf(stderr, "Could not build an expert game\n");
+      return 1;
+    }
+  }
+
+  const struct EndgameStats *stats = &runs[1].endgame;
+  printf("%-22s %8s %14s\n", "", "won", "ms per guess");
+  for (int e = 0; e < 2; e++) {
+    printf("%-22s %7.1f%% %14.3f\n", e == 0 ? "monte carlo" : "monte carlo + endgame", 100.0 * runs[e].wins / games,
+           1e3 * runs[e].guessing / (runs[e].guesses + runs[e].endgame_moves));
+  }
+  printf("Endgame: %lld moves, %lld timeouts, %lld too many layouts\n", runs[1].endgame_moves, stats->timeouts,
+         stats->too_large);
+  printf("Search: %lld nodes, table hit rate %.1f%%\n", stats->nodes,
+         stats->probes > 0 ? 100.0 * stats->hits / stats->probes : 0.0);
+  return runs[0].wrong == 0 && runs[1].wrong == 0 ? 0 : 1;
+}
+
+// a sweep task: some games of one size and density
+struct BenchSweepTask {
+    int                   size;
+    double                density;
+    int                   mines;
+    struct BenchSolverPlan plan;
+    struct BenchSolverRun run;
+    bool                  played;
+};
+
+/**
+ * This function parses a comma-separated list of numbers.
+ *
+ * @param list the list
+ * @param values where to store the numbers, BENCH_SWEEP_MAX long
+ *
+ * @return how many; 0 if the list is empty, too long or not numbers
+ */
+static int bench__parse_list(const char *list, double *values) {
+  int count = 0;
+  char *end;
+
+  while (*list != '\0') {
+    if (count == BENCH_SWEEP_MAX) {
+      return 0;
+    }
+    values[count++] = strtod(list, &end);
+    if (end == list || (*end != ',' && *end != '\0')) {
+      return 0;
+    }
+    list = *end == ',' ? end + 1 : end;
+  }
+  return count;
+}
+
+/**
+ * This function plays the games of one sweep task, a task of the pool.
+ *
+ * @param context the tasks
+ * @param task the task
+ */
+static void bench__sweep_task(void *context, int task) {
+  struct BenchSweepTask *sweep_task = &((struct BenchSweepTask *)context)[task];
+  sweep_task->played = bench__play_solver(&sweep_task->plan, &sweep_task->run);
+}
+
+/**
+ * This function plays square boards of every size and mine density
+ * given with patterns, the solver and the Monte Carlo guesser, on a
+ * thread pool, and prints a CSV row per size and density: the win rate
+ * with its 95% Wilson interval, the time per game and the moves per
+ * second. Densities are not capped the way the menu caps them. Game i
+ * of a size and density is seeded from the seed, the size, the density
+ * and i, and the guesser runs on a sample budget, so the same arguments
+ * play the same games and give the same wins. Returns the exit code of
+ * the program.
+ *
+ * @param sizes the sides of the boards, comma-separated
+ * @param densities the shares of tiles that are mines, comma-separated
+ * @param games the number of games per size and density
+ * @param threads the number of worker threads
+ * @param seed the seed of the sweep
+ *
+ * @return the exit code
+ */
+int bench__sweep(const char *sizes, const char *densities, int games, int threads, uint64_t seed) {
+  struct GuesserConfig config = {0, 0, 1000, 0.05, seed};
+  double size_list[BENCH_SWEEP_MAX];
+  double density_list[BENCH_SWEEP_MAX];
+  int num_sizes = bench__parse_list(sizes, size_list);
+  int num_densities = bench__parse_list(densities, density_list);
+  struct ThreadPool pool;
+
+  if (num_sizes == 0 || num_densities == 0 || games <= 0) {
+    fprintf(stderr, "Invalid sweep: sizes and densities are comma-separated lists of up to %d numbers\n",
+            BENCH_SWEEP_MAX);
+    return 1;
+  }
+  for (int i = 0; i < num_sizes; i++) {
+    if (size_list[i] < 4 || size_list[i] * size_list[i] > SOLVER_MAX_CELLS) {
+      fprintf(stderr, "Invalid size %g: boards are 4x4 up to %d tiles\n", size_list[i], SOLVER_MAX_CELLS);
+      return 1;
+    }
+  }
+  for (int i = 0; i < num_densities; i++) {
+    if (density_list[i] <= 0 || density_list[i] >= 1) {
+      fprintf(stderr, "Invalid density %g: densities are between 0 and 1\n", density_list[i]);
+      return 1;
+    }
+  }
+
+  int chunks = (games + BENCH_SWEEP_CHUNK - 1) / BENCH_SWEEP_CHUNK;
+  int num_tasks = num_sizes * num_densities * chunks;
+  struct BenchSweepTask *tasks = (struct BenchSweepTask *)calloc(num_tasks, sizeof(struct BenchSweepTask));
+  if (tasks == NULL || !thread_pool__create(threads, &pool)) {
+    fprintf(stderr, "Could not start the sweep\n");
+    free(tasks);
+    return 1;
+  }
+
+  // the largest boards first, so no thread is left with one at the end
+  int t = 0;
+  for (int i = num_sizes - 1; i >= 0; i--) {
+    for (int j = 0; j < num_densities; j++) {
+      int size = (int)size_list[i];
+      int mines = (int)lround(density_list[j] * size * size);
+      mines = mines < 1 ? 1 : mines < size * size ? mines : size * size - 1;
+      uint64_t cell_seed = rng__mix(seed ^ rng__mix((uint64_t)size << 32 ^ (uint64_t)mines));
+      for (int c = 0; c < chunks; c++, t++) {
+        int first = c * BENCH_SWEEP_CHUNK;
+        int count = games - first < BENCH_SWEEP_CHUNK ? games - first : BENCH_SWEEP_CHUNK;
+        struct BenchSolverPlan plan = {size, size, mines, cell_seed + first, count, true, &config, NULL};
+        tasks[t].size = size;
+        tasks[t].density = density_list[j];
+        tasks[t].mines = mines;
+        tasks[t].plan = plan;
+      }
+    }
+  }
+  thread_pool__run(num_tasks, bench__sweep_task, tasks, &pool);
+  thread_pool__destruct(&pool);
+
+  bool played = true;
+  printf("size,density,mines,games,wins,win_rate,win_low,win_high,ms_per_game,moves_per_sec\n");
+  for (int i = 0; i < num_sizes * num_densities; i++) {
+    // smallest boards first, the tasks are largest first
+    int first = ((num_sizes - 1 - i / num_densities) * num_densities + i % num_densities) * chunks;
+    long long wins = 0;
+    long long moves = 0;
+    double seconds = 0;
+    for (int c = first; c < first + chunks; c++) {
+      played = played && tasks[c].played;
+      wins += tasks[c].run.wins;
+      moves += tasks[c].run.moves;
+      seconds += tasks[c].run.seconds;
+    }
+    // Wilson score interval
+    double rate = (double)wins / games;
+    double z2 = BENCH_SWEEP_Z * BENCH_SWEEP_Z;
+    double middle = (rate + z2 / (2.0 * games)) / (1 + z2 / games);
+    double half = BENCH_SWEEP_Z * sqrt(rate * (1 - rate) / games + z2 / (4.0 * games * games)) / (1 + z2 / games);
+    printf("%d,%.4f,%d,%d,%lld,%.4f,%.4f,%.4f,%.3f,%.0f\n", tasks[first].size, tasks[first].density,
+           tasks[first].mines, games, wins, rate, fmax(middle - half, 0), fmin(middle + half, 1), 1e3 * seconds / games,
+           seconds > 0 ? moves / seconds : 0.0);
+  }
+
+  free(tasks);
+  if (!played) {
+    fprintf(stderr, "Could not build a game\n");
+    return 1;
+  }
+  return 0;
+}
+
+/**
+ * This function returns the greatest common divisor of two positive
+ * numbers.
+ */
+static int bench__gcd(int a, int b) {
+  while (b != 0) {
+    int rest = a % b;
+    a = b;
+    b = rest;
+  }
+  return a;
+}
+
+// one thread of the cooperative benchmark, sweeping the board
+struct BenchCoopWorker {
+    struct Coop* coop;   // the shared board, or NULL to play game under lock
+    struct Game* game;
+    Mutex*       lock;
+    Thread       thread;
+    int          player;
+    int          start;  // the tile the sweep starts at
+    int          stride; // tiles between two steps of the sweep, coprime with the tiles
+    long long    moves;  // moves the board accepted
+};
+
+/**
+ * This function sweeps the tiles of the board in a stride order of its
+ * own and reveals every safe tile still hidden, until the game ends or
+ * the sweep is done. The workers cross each other's paths and openings
+ * all the time. It is a ThreadFunction taking a struct BenchCoopWorker.
+ *
+ * @param arg the worker
+ */
+static void bench__coop_worker(void *arg) {
+  struct BenchCoopWorker *worker = (struct BenchCoopWorker *)arg;
+  struct Board *board = worker->coop != NULL ? &worker->coop->game.board : &worker->game->board;
+  int cols = board__get_y(board);
+  int tiles = board__get_x(board) * cols;
+
+  for (long long i = 0; i < tiles; i++) {
+    int tile = (int) ((worker->start + i * worker->stride) % tiles);
+    int x = tile / cols;
+    int y = tile % cols;
+    if (board__contains_mine(x, y, board)) {
+      continue;
+    }
+    if (worker->coop != NULL) {
+      if (coop__is_revealed(x, y, worker->coop)) {
+        continue;
+      }
+      enum GameStatus status = coop__apply('r', x, y, worker->player, worker->coop);
+      worker->moves += status == GAME_STATUS_OK || status == GAME_STATUS_WIN;
+      if (status == GAME_STATUS_WIN || status == GAME_STATUS_ENDED) {
+        break;
+      }
+    } else {
+      thread__mutex_lock(worker->lock);
+      worker->moves += game__apply('r', x, y, worker->game) == GAME_STATUS_OK;
+      thread__mutex_unlock(worker->lock);
+    }
+  }
+}
+
+/**
+ * This function sweeps one board with a number of threads and returns
+ * how long it took. On a cooperative board the threads make their moves
+ * without locks; otherwise they share a game behind one mutex, the way
+ * a struct Game has to be shared.
+ *
+ * @param coop the cooperative board, or NULL to use game
+ * @param game the locked game, if coop is NULL
+ * @param threads the number of threads
+ * @param moves receives the moves the board accepted
+ *
+ * @return the time in seconds, or a negative number if a thread could not start
+ */
+static double bench__time_coop(struct Coop *coop, struct Game *game, int threads, long long *moves) {
+  struct BenchCoopWorker *workers = (struct BenchCoopWorker *)calloc(threads, sizeof(struct BenchCoopWorker));
+  struct Board *board = coop != NULL ? &coop->game.board : &game->board;
+  int tiles = board__get_x(board) * board__get_y(board);
+  int started = 0;
+  Mutex lock;
+
+  if (workers == NULL) {
+    return -1;
+  }
+  thread__mutex_init(&lock);
+  double start = bench__now();
+  for (int t = 0; t < threads; t++) {
+    workers[t] = (struct BenchCoopWorker) {coop, game, &lock, 0, t + 1, (int) ((long long) tiles * t / threads), 1, 0};
+    // a stride near the golden ratio of the board scatters every sweep over all of it
+    workers[t].stride = (int) (tiles * 0.618) + 2 * t;
+    while (bench__gcd(workers[t].stride, tiles) != 1) {
+      workers[t].stride++;
+    }
+    if (!thread__create(bench__coop_worker, &workers[t], &workers[t].thread)) {
+      break;
+    }
+    started++;
+  }
+  *moves = 0;
+  for (int t = 0; t < started; t++) {
+    thread__join(&workers[t].thread);
+    *moves += workers[t].moves;
+  }
+  double seconds = bench__now() - start;
+
+  thread__mutex_destroy(&lock);
+  free(workers);
+  return started == threads ? seconds : -1;
+}
+
+/**
+ * This function checks that a cooperative board swept to the end is won
+ * and shows every safe tile revealed once with its count.
+ *
+ * @param coop the board
+ *
+ * @return true if it is
+ */
+static bool bench__coop_solved(struct Coop *coop) {
+  struct Board *board = &coop->game.board;
+
+  if (coop__get_state(coop) != COOP_WON || coop__get_hidden(coop) != 0) {
+    return false;
+  }
+  for (int x = 0; x < board__get_x(board); x++) {
+    for (int y = 0; y < board__get_y(board); y++) {
+      bool mine = board__contains_mine(x, y, board);
+      char expected = (char) ('0' + board__count_num_adjacent(x, y, board));
+      if (coop__is_revealed(x, y, coop) == mine || (!mine && coop__get_cell(x, y, coop) != expected)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * This function measures how moves on one shared board scale with the
+ * threads making them. For each number of threads, doubling up to the
+ * given one, a fresh cooperative board is swept by that many threads
+ * revealing every safe tile, and the same board as a struct Game behind
+ * one mutex is swept the same way. Every cooperative board must end won,
+ * with every safe tile revealed once. One mine in six leaves many
+ * openings for the sweeps to meet in. Returns the exit code of the
+ * program.
+ *
+ * @param size the number of rows and columns
+ * @param threads the most threads
+ *
+ * @return the exit code
+ */
+int bench__coop(int size, int threads) {
+  int mines = size * size / 6;
+  bool solved = true;
+  double coop_base = 0;
+  double locked_base = 0;
+
+  printf("Board: %dx%d, mines: %d, cores: %d\n", size, size, mines, thread__hardware_concurrency());
+  printf("%7s %12s %9s %12s %9s %s\n", "threads", "coop moves/s", "speedup", "locked/s", "speedup", "result");
+  for (int t = 1; t <= threads; t = t < threads && 2 * t > threads ? threads : 2 * t) {
+    struct Coop coop;
+    struct Game game;
+    long long coop_moves;
+    long long locked_moves;
+
+    if (!coop__create(size, size, mines, 5, &coop)) {
+      fprintf(stderr, "Could not build a %dx%d board\n", size, size);
+      return 1;
+    }
+    if (!game__build_game_seeded(size, size, mines, 5, &game)) {
+      coop__destruct(&coop);
+      fprintf(stderr, "Could not build a %dx%d board\n", size, size);
+      return 1;
+    }
+    game__set_first_click(GAME_FIRST_CLICK_OPENING, &game);
+    game__apply('r', size / 2, size / 2, &game);
+
+    double coop_time = bench__time_coop(&coop, NULL, t, &coop_moves);
+    double locked_time = bench__time_coop(NULL, &game, t, &locked_moves);
+    bool ok = coop_time >= 0 && locked_time >= 0 && bench__coop_solved(&coop);
+    double coop_rate = coop_moves / coop_time;
+    double locked_rate = locked_moves / locked_time;
+    if (t == 1) {
+      coop_base = coop_rate;
+      locked_base = locked_rate;
+    }
+    printf("%7d %12.0f %8.2fx %12.0f %8.2fx %s\n", t, coop_rate, coop_rate / coop_base, locked_rate,
+           locked_rate / locked_base, ok ? "won" : "WRONG");
+    solved = solved && ok;
+
+    board__destruct(&game.board);
+    coop__destruct(&coop);
+  }
+  return solved ? 0 : 1;
+}
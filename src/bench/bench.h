@@ -0,0 +1,22 @@
+/**
+ * @file bench.h
+ * @brief The header for bench.
+ */
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+
+int bench__env(int num_envs, int threads, int steps);
+int bench__board(int size, int threads);
+int bench__layouts();
+int bench__topologies();
+int bench__presets(int games);
+int bench__solver(int games);
+int bench__patterns(int games);
+int bench__guesser(int games, int threads, int ms);
+int bench__endgame(int games, int threshold, int ms);
+int bench__sweep(const char* sizes, const char* densities, int games, int threads, uint64_t seed);
+int bench__coop(int size, int threads);
+
+#endif // BENCH_H
@@ -17,106 +17,583 @@
  * already beenrevealed by the player to avoid accidental duplicate reveal
  * functions.
  *
+ * Each array is one allocation, row after row, with a guard ring of one
+ * cell around the board. Guard cells hold no mine and count as revealed,
+ * so counting neighbors and revealing openings read the 8 neighbors at
+ * fixed offsets without any bounds checks: counting never sees a mine
+ * outside the board and a reveal never enters a revealed cell. Coordinates
+ * are checked once, by board__in_bounds, before they get here.
+ *
+ * The grids are row-major by default. board__build_array_layout can
+ * store them in 8x8 tiles or in Morton order instead; board__index and
+ * board__neighbor hide the layout, and the sweeps over the board walk
+ * rows and columns, so every layout labels, reveals and journals the
+ * same tiles in the same order. Row-major keeps its fixed neighbor
+ * offsets on the hot paths.
+ *
+ * Which tiles are neighbors is a struct BoardTopology, turned into a
+ * table of index offsets when the board is built: one table, or one per
+ * row parity on hex grids. The guard ring is as wide as the longest
+ * step, and on a torus wrap_pointer maps each guard cell to the tile it
+ * wraps to, so counting, labeling and revealing walk the table the same
+ * way for every topology. Only the square board is labeled and
+ * revealed in parallel.
+ *
+ * Every change to the board_pointer array is also written to the
+ * changed_cells journal, so callers that only need what an action changed
+ * do not have to compare whole boards. The journal holds one entry per
+ * cell, which is enough for any single action since no action changes a
+ * cell twice; callers clear it before each action.
+ *
+ * Changes also go to a history that nobody clears: a ring of the last
+ * board_x * board_y changed cells, numbered by a generation counter. An
+ * observer holding a struct BoardView reads the visible grid in place,
+ * remembers the generation it last looked at, and asks for the cells
+ * changed since then instead of comparing or copying the board. Once the
+ * ring has wrapped past its generation, or the board was reset, it reads
+ * the whole view again.
+ *
+ * Once the mines are placed, board__label_openings counts the adjacent
+ * mines of every tile and joins the zero tiles into openings with a
+ * union-find pass. Each opening gets a list of its zero tiles, so
+ * revealing a zero tile walks that list and the neighbors on it instead
+ * of flood filling. Placing a mine drops the labels; the next reveal
+ * labels the board again. Moving a mine patches the counts of the tiles
+ * around its old and new place, so labeling again only redoes the
+ * union-find.
+ *
+ * A board given a thread pool with board__set_pool splits the work on
+ * huge boards across it. Counting and union-find run on bands of rows;
+ * the trees of neighboring bands are joined afterwards, and since a
+ * root is always the first tile of its opening the labels come out the
+ * same in any order. A large opening is revealed in slices of its tile
+ * list, in one pass over it: each slice reveals its tiles and lists them
+ * in a scratch region of its own, and once a prefix sum over the slices
+ * gives each list its place in the journal, the slices copy them there.
+ * A tile near the start of a slice is revealed by the first zero tile of
+ * the list next to it, which is the one that reveals it on the serial
+ * path; the rest only the slice can reach, so it reveals them in list
+ * order as the serial path does. The board, the counters and even the
+ * order of the journal match the serial path. A machine with one core
+ * runs the serial path even when given a pool, since splitting the work
+ * there only adds to it.
+ *
  * @author daoge_cmd
  * @date June 24, 2025
  */
 
-#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "board/board.h"
+#include "thread/thread_pool.h"
+
+/* Count stored for the guard ring and mines, so neither is taken for a zero tile */
+#define BOARD_NOT_ZERO 9
+
+/* Work below these sizes is not worth waking a thread pool for */
+#define BOARD_PARALLEL_MIN_CELLS (1 << 18) // tiles of the board, for labeling
+#define BOARD_PARALLEL_MIN_TILES (1 << 16) // zero tiles of an opening, for revealing
+#define BOARD_PARALLEL_TASKS     64        // bands or slices the work is split into
+
+/* Inlined even where the compiler would not, so the presets get their own copy */
+#if defined(_MSC_VER)
+#define BOARD_INLINE __forceinline
+#else
+#define BOARD_INLINE inline __attribute__((always_inline))
+#endif
+
+static void board__reveal_opening_parallel(int opening, struct Board *board);
+static void board__init_preset(struct Board *board);
+static void board__label_preset(struct Board *board);
+
+const struct BoardTopology BOARD_TOPOLOGY_SQUARE = {
+    8,
+    {{{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}},
+     {{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}}},
+    false,
+};
+
+const struct BoardTopology BOARD_TOPOLOGY_TORUS = {
+    8,
+    {{{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}},
+     {{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}}},
+    true,
+};
+
+const struct BoardTopology BOARD_TOPOLOGY_HEX = {
+    6,
+    {{{-1, -1}, {-1, 0}, {0, -1}, {0, 1}, {1, -1}, {1, 0}},
+     {{-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, 0}, {1, 1}}},
+    false,
+};
+
+const struct BoardTopology BOARD_TOPOLOGY_KNIGHT = {
+    8,
+    {{{-2, -1}, {-2, 1}, {-1, -2}, {-1, 2}, {1, -2}, {1, 2}, {2, -1}, {2, 1}},
+     {{-2, -1}, {-2, 1}, {-1, -2}, {-1, 2}, {1, -2}, {1, 2}, {2, -1}, {2, 1}}},
+    false,
+};
 
 //------------------------------//
 //   CONSTRUCTOR / DESTRUCTOR   //
 //------------------------------//
 
 /**
- * This function takes a specified height and width and builds the passed
- * in board's arrays. This function returns a boolean to specify if the
- * build was successful.
- *
- * @param width the width of the board
- * @param height the height of the board
- * @param board the board struct to be built
+ * This function sets every grid to the start of a game: no mines, nothing
+ * revealed and every tile '*'; the guard ring is marked revealed.
  *
- * @return false if height OR width < 2; true otherwise
+ * @param board the board to be initialized
  */
-bool board__build_array(int width, int height, struct Board *board) {
-  if (width < 2 || height < 2) {
-    return false;
+static void board__init_grids(struct Board *board) {
+  if (board->board_preset != BOARD_PRESET_NONE) {
+    board__init_preset(board);
+    return;
   }
 
-  // Build array for mines
-  board->mine_pointer = (bool **)malloc(height * sizeof(bool*));
-  for (int i = 0; i < height; i++) {
-    board->mine_pointer[i] = (bool *)malloc(width * sizeof(bool));
+  for (int i = 0; i < board->board_cells; i++) {
+    board->mine_pointer[i] = false;
+    board->board_pointer[i] = '*';
+    board->reveal_pointer[i] = true;
+  }
+
+  for (int i = 0; i < board__get_x(board); i++) {
+    for (int j = 0; j < board__get_y(board); j++) {
+      board->reveal_pointer[board__index(i, j, board)] = false;
+    }
+  }
+}
+
+/**
+ * This function checks that a topology can be built: every step stays
+ * within two tiles, and the tile a step leads to has a step back, so
+ * being neighbors goes both ways.
+ *
+ * @param topology the topology to check
+ *
+ * @return true if valid; false otherwise
+ */
+static bool board__valid_topology(const struct BoardTopology *topology) {
+  if (topology->num_neighbors < 1 || topology->num_neighbors > BOARD_NUM_NEIGHBORS) {
+    return false;
   }
 
-  for (int i = 0; i < height; i++) {
-    for (int j = 0; j < width; j++) {
-      board->mine_pointer[i][j] = false;
+  for (int parity = 0; parity < 2; parity++) {
+    for (int k = 0; k < topology->num_neighbors; k++) {
+      int dx = topology->steps[parity][k][0];
+      int dy = topology->steps[parity][k][1];
+      if (abs(dx) > 2 || abs(dy) > 2 || (dx == 0 && dy == 0)) {
+        return false;
+      }
+      bool back = false;
+      for (int j = 0; j < topology->num_neighbors; j++) {
+        const int *step = topology->steps[(parity + dx) & 1][j];
+        back = back || (step[0] == -dx && step[1] == -dy);
+      }
+      if (!back) {
+        return false;
+      }
     }
   }
+  return true;
+}
+
+/**
+ * This function sets up the neighbor offsets of a board from its
+ * topology, and on a torus fills the table from guard cells to the tiles
+ * they stand for. Entries past the neighbors of the topology are 0, the
+ * tile itself.
+ *
+ * @param topology the topology of the board
+ * @param board the board being built
+ */
+static void board__init_neighbors(const struct BoardTopology *topology, struct Board *board) {
+  int stride = board->board_stride;
 
-  // Build array for game board
-  board->board_pointer = (char **)malloc(height * sizeof(char*));
-  for (int i = 0; i < height; i++) {
-    board->board_pointer[i] = (char *)malloc(width * sizeof(char));
+  board->board_num_neighbors = topology->num_neighbors;
+  board->board_square = !topology->wrap && topology->num_neighbors == BOARD_NUM_NEIGHBORS;
+  board->board_uniform = board->board_layout == BOARD_LAYOUT_ROWS && !topology->wrap;
+  for (int k = 0; k < BOARD_NUM_NEIGHBORS; k++) {
+    bool used = k < topology->num_neighbors;
+    const int *even = topology->steps[0][k];
+    const int *odd = topology->steps[1][k];
+    const int *square = BOARD_TOPOLOGY_SQUARE.steps[0][k];
+    board->board_neighbors[k] = used ? even[0] * stride + even[1] : 0;
+    board->board_odd_neighbors[k] = used ? odd[0] * stride + odd[1] : 0;
+    board->board_square = board->board_square && even[0] == square[0] && even[1] == square[1] &&
+                          odd[0] == square[0] && odd[1] == square[1];
+    board->board_uniform = board->board_uniform && board->board_neighbors[k] == board->board_odd_neighbors[k];
   }
 
-  for (int i = 0; i < height; i++) {
-    for (int j = 0; j < width; j++) {
-      board->board_pointer[i][j] = '*';
+  if (board->wrap_pointer != NULL) {
+    int rows = board__get_x(board);
+    int cols = board__get_y(board);
+    for (int index = 0; index < board->board_cells; index++) {
+      int x = (board__index_x(index, board) + rows) % rows;
+      int y = (board__index_y(index, board) + cols) % cols;
+      board->wrap_pointer[index] = board__index(x, y, board);
     }
   }
+}
+
+/**
+ * This function allocates a grid of a board from its allocator.
+ *
+ * @param size the size of the grid in bytes
+ * @param board the board the grid belongs to
+ *
+ * @return the grid, or NULL
+ */
+static void *board__allocate(size_t size, struct Board *board) {
+  return alloc__allocate(size, &board->board_allocator, &board->board_alloc_stats);
+}
+
+/**
+ * This function gives a grid of a board back to its allocator.
+ *
+ * @param pointer the grid, or NULL
+ * @param size the size of the grid in bytes
+ * @param board the board the grid belongs to
+ */
+static void board__release(void *pointer, size_t size, struct Board *board) {
+  alloc__release(pointer, size, &board->board_allocator, &board->board_alloc_stats);
+}
 
-  // Build array for reveal tracking
-  board->reveal_pointer = (bool **)malloc(height * sizeof(bool*));
-  for (int i = 0; i < height; i++) {
-    board->reveal_pointer[i] = (bool *)malloc(width * sizeof(bool));
+/**
+ * This function builds a board in any layout and topology, see
+ * board__build_array_layout and board__build_array_topology.
+ *
+ * @param width the width of the board
+ * @param height the height of the board
+ * @param layout the order of the cells in memory
+ * @param topology which tiles are neighbors
+ * @param allocator where the grids are allocated from, copied
+ * @param board the board struct to be built
+ *
+ * @return true if built; false otherwise
+ */
+static bool board__build(int width, int height, enum BoardLayout layout, const struct BoardTopology *topology,
+                         const struct Allocator *allocator, struct Board *board) {
+  if (width < 2 || height < 2 || !board__valid_topology(topology)) {
+    return false;
   }
 
-  for (int i = 0; i < height; i++) {
-    for (int j = 0; j < width; j++) {
-      board->reveal_pointer[i][j] = false;
+  int guard = 1;
+  bool offset_rows = false;
+  for (int parity = 0; parity < 2; parity++) {
+    for (int k = 0; k < topology->num_neighbors; k++) {
+      guard = abs(topology->steps[parity][k][0]) > guard ? abs(topology->steps[parity][k][0]) : guard;
+      guard = abs(topology->steps[parity][k][1]) > guard ? abs(topology->steps[parity][k][1]) : guard;
+      offset_rows = offset_rows || topology->steps[0][k][0] != topology->steps[1][k][0] ||
+                    topology->steps[0][k][1] != topology->steps[1][k][1];
     }
   }
+  // a torus needs room for every step to land on a different tile, and whole pairs of offset rows
+  if (topology->wrap && (width <= 2 * guard || height <= 2 * guard || (offset_rows && height % 2 != 0))) {
+    return false;
+  }
 
   board__set_x(height, board);
   board__set_y(width, board);
+  board->board_guard = guard;
+  board->board_stride = width + 2 * guard;
+  board->board_layout = layout;
+  board->board_tiles_per_row = (width + 2 + BOARD_TILE_SIZE - 1) / BOARD_TILE_SIZE;
+  board->board_pool = NULL;
+  board->board_scratch = NULL;
+  board->board_scratch_size = 0;
 
-  board->board_num_mines = 0;
-  board->board_num_flags = 0;
+  // The last cell of the padded board is the furthest in every layout
+  long long cells = (long long) (height + 2 * guard) * board->board_stride;
+  if (layout == BOARD_LAYOUT_TILES) {
+    cells = (long long) (height + 2 + BOARD_TILE_SIZE - 1) / BOARD_TILE_SIZE * board->board_tiles_per_row *
+            BOARD_TILE_SIZE * BOARD_TILE_SIZE;
+  } else if (layout == BOARD_LAYOUT_MORTON) {
+    cells = height + 2 > 0xFFFF || width + 2 > 0xFFFF ? -1 : (long long) board__index(height, width, board) + 1;
+  }
+  if (cells < 0 || cells > 0x7FFFFFFF) {
+    return false;
+  }
+  board->board_cells = (int) cells;
+  board->board_allocator = *allocator;
+  board->board_alloc_stats = (struct AllocStats){0};
+
+  // Build arrays for mines, game board and reveal tracking
+  size_t tiles = (size_t) height * width;
+  board->mine_pointer = (bool *)board__allocate(cells * sizeof(bool), board);
+  board->board_pointer = (char *)board__allocate(cells * sizeof(char), board);
+  board->reveal_pointer = (bool *)board__allocate(cells * sizeof(bool), board);
+
+  // Build journal and history of changed cells
+  board->changed_cells = (int *)board__allocate(tiles * sizeof(int), board);
+  board->history = (int *)board__allocate(tiles * sizeof(int), board);
+  board->history_head = 0;
+  board->board_generation = 0;
+
+  // Build adjacent mine counts and opening labels
+  board->count_pointer = (unsigned char *)board__allocate(cells * sizeof(unsigned char), board);
+  board->opening_pointer = (int *)board__allocate(cells * sizeof(int), board);
+  board->opening_parent = (int *)board__allocate(cells * sizeof(int), board);
+  board->opening_start = (int *)board__allocate((tiles + 1) * sizeof(int), board);
+  board->opening_cells = (int *)board__allocate(tiles * sizeof(int), board);
+
+  // Build the guard cell table of a torus
+  board->wrap_pointer = topology->wrap ? (int *)board__allocate(cells * sizeof(int), board) : NULL;
+
+  if (board->mine_pointer == NULL || board->board_pointer == NULL || board->reveal_pointer == NULL ||
+      board->changed_cells == NULL || board->history == NULL || board->count_pointer == NULL ||
+      board->opening_pointer == NULL || board->opening_parent == NULL || board->opening_start == NULL ||
+      board->opening_cells == NULL || (topology->wrap && board->wrap_pointer == NULL)) {
+    board__destruct(board);
+    return false;
+  }
+
+  board__init_neighbors(topology, board);
+  board->board_preset = BOARD_PRESET_NONE;
+  if (board->board_square && layout == BOARD_LAYOUT_ROWS) {
+#define BOARD_PRESET_MATCH(NAME, name, rows, cols, mines)                                                   \
+    if (height == rows && width == cols) {                                                                 \
+      board->board_preset = BOARD_PRESET_##NAME;                                                           \
+    }
+    BOARD_PRESETS(BOARD_PRESET_MATCH)
+#undef BOARD_PRESET_MATCH
+  }
+  board__reset(board);
   
   return true;
 }
 
 /**
- * This function takes a board struct and frees all the arrays from memory.
+ * This function takes a specified height and width and builds the passed
+ * in board's arrays. This function returns a boolean to specify if the
+ * build was successful.
+ *
+ * @param width the width of the board
+ * @param height the height of the board
+ * @param board the board struct to be built
+ *
+ * @return false if height OR width < 2 or out of memory; true otherwise
+ */
+bool board__build_array(int width, int height, struct Board *board) {
+  return board__build(width, height, BOARD_LAYOUT_ROWS, &BOARD_TOPOLOGY_SQUARE, &ALLOC_SYSTEM, board);
+}
+
+/**
+ * This function builds a board whose grids are ordered in memory by the
+ * given layout. Every board function works the same in every layout;
+ * only where a cell and its neighbors sit in memory changes. Tiles and
+ * Morton order keep the rows above and below a cell close, at the cost
+ * of looking neighbors up through board__neighbor and, for Morton order,
+ * padding the grids up to a power of two. Games, and callers that copy
+ * whole rows out of board_pointer, use BOARD_LAYOUT_ROWS.
+ *
+ * @param width the width of the board
+ * @param height the height of the board
+ * @param layout the order of the cells in memory
+ * @param board the board struct to be built
+ *
+ * @return false if height OR width < 2, the board is too large for the
+ *         layout or out of memory; true otherwise
+ */
+bool board__build_array_layout(int width, int height, enum BoardLayout layout, struct Board *board) {
+  return board__build(width, height, layout, &BOARD_TOPOLOGY_SQUARE, &ALLOC_SYSTEM, board);
+}
+
+/**
+ * This function builds a row-major board with another topology: a torus,
+ * a hex grid, the knight's neighborhood or any custom one. The topology
+ * is turned into neighbor offsets once, here, so counting and revealing
+ * step through a fixed list of offsets like on the square board. On a
+ * torus a step off the board goes through a table from guard cells to
+ * the tiles on the other side, and on a hex grid the offsets of odd rows
+ * differ from those of even rows.
+ *
+ * @param width the width of the board
+ * @param height the height of the board
+ * @param topology which tiles are neighbors, copied
+ * @param board the board struct to be built
+ *
+ * @return false if height OR width < 2, the topology is invalid, a torus
+ *         is too small for its steps or has an odd number of offset rows,
+ *         or out of memory; true otherwise
+ */
+bool board__build_array_topology(int width, int height, const struct BoardTopology *topology, struct Board *board) {
+  return board__build(width, height, BOARD_LAYOUT_ROWS, topology, &ALLOC_SYSTEM, board);
+}
+
+/**
+ * This function builds a square row-major board, like
+ * board__build_array, whose grids come from the given allocator. The
+ * board calls nothing else to allocate, and board__memory_size tells
+ * how much it takes.
+ *
+ * @param width the width of the board
+ * @param height the height of the board
+ * @param allocator where the grids are allocated from, copied
+ * @param board the board struct to be built
+ *
+ * @return false if height OR width < 2 or the allocator is out of
+ *         memory; true otherwise
+ */
+bool board__build_array_allocator(int width, int height, const struct Allocator *allocator, struct Board *board) {
+  return board__build(width, height, BOARD_LAYOUT_ROWS, &BOARD_TOPOLOGY_SQUARE, allocator, board);
+}
+
+/**
+ * This function returns how much memory board__build_array_allocator
+ * takes for a board of the given size, each grid rounded up as an arena
+ * rounds it.
+ *
+ * @param width the width of the board
+ * @param height the height of the board
+ *
+ * @return the size in bytes
+ */
+size_t board__memory_size(int width, int height) {
+  size_t cells = (size_t) (height + 2) * (width + 2);
+  size_t tiles = (size_t) height * width;
+
+  return 3 * alloc__round(cells * sizeof(bool)) + alloc__round(cells * sizeof(unsigned char)) +
+         2 * alloc__round(cells * sizeof(int)) + 3 * alloc__round(tiles * sizeof(int)) +
+         alloc__round((tiles + 1) * sizeof(int));
+}
+
+/**
+ * This function takes a board struct and gives all the arrays back to
+ * its allocator. With MINESWEEPER_ALLOC_DEBUG defined, a board that
+ * still holds memory afterwards is reported as a leak.
  *
  * @param board the board to be freed
  */
 void board__destruct(struct Board *board) {
-  // free mine_pointer
-  for (int i = 0; i < 4; ++i) {
-    free(board->mine_pointer[i]);
+  size_t cells = (size_t) board->board_cells;
+  size_t tiles = (size_t) board->board_x * board->board_y;
+
+  board__release(board->mine_pointer, cells * sizeof(bool), board);
+  board__release(board->board_pointer, cells * sizeof(char), board);
+  board__release(board->reveal_pointer, cells * sizeof(bool), board);
+  board__release(board->changed_cells, tiles * sizeof(int), board);
+  board__release(board->history, tiles * sizeof(int), board);
+  board__release(board->count_pointer, cells * sizeof(unsigned char), board);
+  board__release(board->opening_pointer, cells * sizeof(int), board);
+  board__release(board->opening_parent, cells * sizeof(int), board);
+  board__release(board->opening_start, (tiles + 1) * sizeof(int), board);
+  board__release(board->opening_cells, tiles * sizeof(int), board);
+  board__release(board->wrap_pointer, cells * sizeof(int), board);
+  board__release(board->board_scratch, board->board_scratch_size * sizeof(int), board);
+  alloc__check_leaks("board", &board->board_alloc_stats);
+
+  board->mine_pointer = NULL;
+  board->board_pointer = NULL;
+  board->reveal_pointer = NULL;
+  board->changed_cells = NULL;
+  board->history = NULL;
+  board->count_pointer = NULL;
+  board->opening_pointer = NULL;
+  board->opening_parent = NULL;
+  board->opening_start = NULL;
+  board->opening_cells = NULL;
+  board->wrap_pointer = NULL;
+  board->board_scratch = NULL;
+  board->board_scratch_size = 0;
+  board->board_pool = NULL;
+}
+
+/**
+ * This function takes a built board and clears it back to the state
+ * board__build_array leaves it in, without freeing or allocating. Used
+ * to play many games of the same size on one board. The generation
+ * moves on and the history before it is dropped, so observers read
+ * their views whole again.
+ *
+ * @param board the board to be cleared
+ */
+void board__reset(struct Board *board) {
+  board__init_grids(board);
+
+  board->num_changed = 0;
+  board->board_generation++;
+  board->board_reset_generation = board->board_generation;
+  board->board_num_mines = 0;
+  board->board_num_flags = 0;
+  board->board_num_revealed = 0;
+  board->counts_ready = false;
+  board->openings_ready = false;
+  board->board_num_openings = 0;
+  board->board_3bv = 0;
+}
+
+//---------------------------//
+//   LAYOUTS / TOPOLOGIES   //
+//---------------------------//
+
+/**
+ * This function finds neighbor k of a tile on boards that are not
+ * uniform, for board__neighbor. Row-major boards take the offsets of the
+ * row's parity and, on a torus, look the guard cell up in wrap_pointer.
+ * The tiled and Morton layouts hold square boards: inside a tile the
+ * neighbors are at fixed offsets, and across tile edges the cell is
+ * decoded and encoded again. In Morton order a step is an add or
+ * subtract on the bits of one coordinate, carried past the bits of the
+ * other.
+ *
+ * @param index the grid index of a tile, not in the guard ring
+ * @param k the neighbor, below BOARD_NUM_NEIGHBORS
+ * @param board the board to look in
+ *
+ * @return the grid index of the neighbor
+ */
+int board__find_neighbor(int index, int k, const struct Board *board) {
+  if (board->board_layout == BOARD_LAYOUT_ROWS) {
+    bool odd = (index / board->board_stride - board->board_guard) & 1;
+    int neighbor = index + (odd ? board->board_odd_neighbors[k] : board->board_neighbors[k]);
+    return board->wrap_pointer != NULL ? board->wrap_pointer[neighbor] : neighbor;
   }
-  
-  free(board->mine_pointer);
 
-  // free board_pointer
-  for (int i = 0; i < 4; ++i) {
-    free(board->board_pointer[i]);
+  int dx = BOARD_TOPOLOGY_SQUARE.steps[0][k][0];
+  int dy = BOARD_TOPOLOGY_SQUARE.steps[0][k][1];
+
+  if (board->board_layout == BOARD_LAYOUT_TILES) {
+    int local_x = ((index >> BOARD_TILE_SHIFT) & (BOARD_TILE_SIZE - 1)) + dx;
+    int local_y = (index & (BOARD_TILE_SIZE - 1)) + dy;
+    if ((unsigned) local_x < BOARD_TILE_SIZE && (unsigned) local_y < BOARD_TILE_SIZE) {
+      return index + dx * BOARD_TILE_SIZE + dy;
+    }
+    return board__index(board__index_x(index, board) + dx, board__index_y(index, board) + dy, board);
   }
-  
-  free(board->board_pointer);
 
-  // free reveal_pointer
-  for (int i = 0; i < 4; ++i) {
-    free(board->reveal_pointer[i]);
+  // x is in the odd bits, y in the even bits
+  unsigned x_bits = 0xAAAAAAAAu;
+  unsigned y_bits = 0x55555555u;
+  unsigned cell = (unsigned) index;
+  if (dx > 0) {
+    cell = (((cell | y_bits) + 2) & x_bits) | (cell & y_bits);
+  } else if (dx < 0) {
+    cell = (((cell & x_bits) - 2) & x_bits) | (cell & y_bits);
   }
-  
-  free(board->reveal_pointer);
+  if (dy > 0) {
+    cell = (((cell | x_bits) + 1) & y_bits) | (cell & x_bits);
+  } else if (dy < 0) {
+    cell = (((cell & y_bits) - 1) & y_bits) | (cell & x_bits);
+  }
+  return (int) cell;
+}
+
+/**
+ * This function returns the neighbor offsets of a tile of a row-major
+ * board, which only change with the parity of its row. The neighbors
+ * are at index + offsets[k], through wrap_pointer on a torus.
+ *
+ * @param index the grid index of the tile
+ * @param board the row-major board
+ *
+ * @return the offsets of the neighbors
+ */
+static const int *board__row_neighbors(int index, const struct Board *board) {
+  if (board->board_uniform || ((index / board->board_stride - board->board_guard) & 1) == 0) {
+    return board->board_neighbors;
+  }
+  return board->board_odd_neighbors;
 }
 
 //-----------------------//
@@ -156,6 +633,42 @@ void board__set_no_fog(bool no_fog, struct Board *board) {
   board->board_no_fog = no_fog;
 }
 
+/**
+ * This function gives the board a thread pool to label huge boards and
+ * reveal large openings on, and allocates the scratch space of parallel
+ * reveals. The results are the same as without one. A pool without
+ * workers, or a machine with one core, keeps the board on the serial
+ * path, which is the faster one there. Pass NULL to go back to the
+ * serial path. The pool must outlive its use by the board. Returns false,
+ * leaving the board on the serial path, if out of memory.
+ *
+ * @param pool the thread pool, or NULL
+ * @param board the board to be configured
+ *
+ * @return true if set; false otherwise
+ */
+bool board__set_pool(struct ThreadPool *pool, struct Board *board) {
+  board__release(board->board_scratch, board->board_scratch_size * sizeof(int), board);
+  board->board_scratch = NULL;
+  board->board_scratch_size = 0;
+  board->board_pool = NULL;
+  if (pool == NULL || pool->num_threads == 0 || thread__hardware_concurrency() < 2 || !board->board_square) {
+    return true;
+  }
+
+  // every slice may reach one row and tile before its first zero tile and after its last, see board__reveal_slice
+  size_t reach = (size_t) board->board_stride + board->board_guard;
+  size_t size = (size_t) (board->board_x + 2 * board->board_guard) * board->board_stride +
+                BOARD_PARALLEL_TASKS * (2 * reach + 1);
+  board->board_scratch = (int *)board__allocate(size * sizeof(int), board);
+  if (board->board_scratch == NULL) {
+    return false;
+  }
+  board->board_scratch_size = size;
+  board->board_pool = pool;
+  return true;
+}
+
 /**
  * This function returns the max x value of the passed in board.
  *
@@ -211,221 +724,422 @@ int board__get_num_flags(struct Board *board) {
   return board->board_num_flags;
 }
 
-//-----------------------------//
-//   USER COMMAND PROCESSORS   //
-//-----------------------------//
-
 /**
- * This function replaces the specified position with a flag (F).
- * This function returns true if operation can be completed, ie. 
- * the spot has yet to be revealed. Returns false otherwise.
+ * This function returns the number of revealed tiles.
  *
- * @param x the x coordinate
- * @param y the y coordinate
- * @param board the board to be modified
+ * @param board the board to return the value on
  *
- * @return true if flag is successful; false otherwise
+ * @return the number of revealed tiles
  */
-bool board__flag(int x, int y, struct Board *board) {
-  if (board->reveal_pointer[x][y] == false) {
-    board->board_pointer[x][y] = 'F';
-    board->board_num_flags++;
-    return true;
-  } else {
-    return false;
-  }
+int board__get_num_revealed(struct Board *board) {
+  return board->board_num_revealed;
 }
 
 /**
- * This function reveals the specified position. This function
- * will only change the specified square to reveal either a loss
- * or a number of mines adjacent. The function game__reveal will
- * handle recursive reveal operations. Returns true if reveal is
- * successful, ie. the spot has yet to be revealed. Returns false
- * otherwise.
+ * This function checks if a coordinate is on the board. It is the one
+ * place coordinates from players are validated; every other board
+ * function expects coordinates that passed this check.
  *
  * @param x the x coordinate
  * @param y the y coordinate
- * @param board the board to be modified
- * 
- * @return true if reveal is succesful; false otherwise
+ * @param board the board to check against
+ *
+ * @return true if (x, y) is on the board; false otherwise
  */
-bool board__reveal(int x, int y, struct Board *board) {
-  if (board->reveal_pointer[x][y] == false) {
-    if (x >= board__get_x(board)) {
-      return false;
-    } else if (y >= board__get_y(board)) {
-      return false;
-    }
-
-    if (board->board_pointer[x][y] == 'F') {
-      board->board_num_flags--;
-    }
-    board->board_pointer[x][y] = board__count_num_adjacent(x, y, board) + '0';
-    board->reveal_pointer[x][y] = true;
-
-    if (board__count_num_adjacent(x, y, board) == 0) {
-      bool x_left = x - 1 >= 0;
-      bool x_right = x + 1 < board__get_x(board);
-      bool y_top = y + 1 < board__get_y(board);
-      bool y_bottom = y - 1 >= 0;
-      // reveal right column
-      if (x_right) {
-        if (y_top) {
-          board__reveal(x + 1, y + 1, board);
-        }
-        if (y_bottom) {
-          board__reveal(x + 1, y - 1, board);
-        }
-        board__reveal(x + 1, y, board);
-      }
-      // reveal left column
-      if (x_left) {
-        if (y_top) {
-          board__reveal(x - 1, y + 1, board);
-        }
-        if (y_bottom) {
-          board__reveal(x - 1, y - 1, board);
-        }
-        board__reveal(x - 1, y, board);
-      }
-      // reveal tile above
-      if (y_top) {
-        board__reveal(x, y + 1, board);
-      }
-      // reveal tile below
-      if (y_bottom) {
-        board__reveal(x, y - 1, board);
-      }
-    }
-    
-    return true;
-  } else {
-    return false;
-  }
+bool board__in_bounds(int x, int y, struct Board *board) {
+  return (unsigned) x < (unsigned) board__get_x(board) && (unsigned) y < (unsigned) board__get_y(board);
 }
 
 /**
- * This function places a guess marker on the specified position.
- * This function will only do this if the spot has yet to be revealed.
- * Returns true if successful, false otherwise.
+ * This function returns the visible value of a tile: '0' to '8' once
+ * revealed, otherwise '*', 'F' or '?'.
  *
  * @param x the x coordinate
  * @param y the y coordinate
- * @param board the board to be modified
+ * @param board the board to read
  *
- * @return true if successful; false otherwise
+ * @return the visible value
  */
-bool board__guess(int x, int y, struct Board *board) {
-  /* Check if the spot has already been revealed */
-  if (board->reveal_pointer[x][y] == true) {
-    // TODO: Change when game design is finalized
-    printf("\nTile already revealed\n");
-    return false;
-  } else {
-    board->board_pointer[x][y] = '?';
-    return true;
-  }
+char board__get_cell(int x, int y, struct Board *board) {
+  return board->board_pointer[board__index(x, y, board)];
 }
 
-//-----------------//
-//   MINE PLACER   //
-//-----------------//
-
 /**
- * This function takes an x and y coordinate and places
- * the mine on the mine_pointer array to keep track of the mines.
- * Returns true if mine was placed, returns false otherwise.
+ * This function returns whether a tile has been revealed.
  *
  * @param x the x coordinate
  * @param y the y coordinate
- * @board the board for the mine to be placed on
+ * @param board the board to read
  *
- * @return true if mine is placed; false otherwise
+ * @return true if revealed; false otherwise
  */
-bool board__place_mine(int x, int y, struct Board *board) {
-  if (board->mine_pointer[x][y] == false) {
-    board->mine_pointer[x][y] = true;
-    board->board_num_mines++;
-    return true;
-  } else {
-    return false;
-  }
+bool board__is_revealed(int x, int y, struct Board *board) {
+  return board->reveal_pointer[board__index(x, y, board)];
 }
 
 //--------------------//
-//   REVEAL UTILITY   //
+//   CHANGE JOURNAL   //
 //--------------------//
 
 /**
- * This function takes in an x and y and counts the number of mines
- * in the adjacent tiles. Returns this value.
- *
- * @param x the x coordinate
- * @param y the y coordinate
- * @param the board to check
+ * This function records that the visible value of a cell changed. Once
+ * the journal is full, further changes are dropped until it is cleared.
  *
- * @return the number of mines adjacent to this square
+ * @param index the grid index of the cell
+ * @param board the board that changed
  */
-int board__count_num_adjacent(int x, int y, struct Board *board) {
-  int count = 0;
+static void board__record_change(int index, struct Board *board) {
+  int tiles = board__get_x(board) * board__get_y(board);
 
-  bool x_left = (x - 1) >= 0;
-  bool x_right = (x + 1) < board__get_x(board);
-  bool y_top = (y + 1) < board__get_y(board);
-  bool y_bottom = (y - 1) >= 0;
-  
-  // Left Column
-  if (x_left) {
-    if (y_top) { // left top
-      if (board->mine_pointer[x - 1][y + 1] == true) {
-        count++;
-      }
-    }
-    if (y_bottom) { // left bottom
-      if (board->mine_pointer[x - 1][y - 1] == true) {
-        count++;
-      }
-    }
-    // left center
-    if (board->mine_pointer[x - 1][y] == true) {
-      count++;
-    }
+  if (board->num_changed < tiles) {
+    board->changed_cells[board->num_changed++] = index;
   }
+  board->history[board->history_head] = index;
+  board->history_head = board->history_head + 1 < tiles ? board->history_head + 1 : 0;
+  board->board_generation++;
+}
 
-  // Right Column
-  if (x_right) {
-    if (y_top) { // right top
-      if (board->mine_pointer[x + 1][y + 1] == true) {
-        count++;
-      }
+/**
+ * This function empties the change journal of the board. Call it before
+ * an action to collect only the cells that action changes.
+ *
+ * @param board the board to clear the journal of
+ */
+void board__clear_changes(struct Board *board) {
+  board->num_changed = 0;
+}
+
+/**
+ * This function returns the number of cells changed since the journal
+ * was last cleared.
+ *
+ * @param board the board to return the value on
+ *
+ * @return the number of changed cells
+ */
+int board__get_num_changes(struct Board *board) {
+  return board->num_changed;
+}
+
+//---------------------//
+//   READ-ONLY VIEWS   //
+//---------------------//
+
+/**
+ * This function fills in a view of the visible grid of a row-major
+ * board, pointing into the board itself: nothing is copied, and the view
+ * shows every later change as it happens until the board is destructed.
+ * The generation is the board's at the time of the call, to pass to
+ * board__get_changes_since later. Boards stored in tiles or Morton order
+ * have no rows to point at and give no view.
+ *
+ * @param view the view to fill in
+ * @param board the board to view
+ *
+ * @return true if filled in; false if the board is not row-major
+ */
+bool board__get_view(struct BoardView *view, const struct Board *board) {
+  if (board->board_layout != BOARD_LAYOUT_ROWS) {
+    return false;
+  }
+  view->cells = board->board_pointer + board__index(0, 0, board);
+  view->rows = board->board_x;
+  view->cols = board->board_y;
+  view->stride = board->board_stride;
+  view->generation = board->board_generation;
+  return true;
+}
+
+/**
+ * This function returns the generation of the board, the number of
+ * visible changes and resets since it was built.
+ *
+ * @param board the board to return the value on
+ *
+ * @return the generation
+ */
+uint64_t board__get_generation(const struct Board *board) {
+  return board->board_generation;
+}
+
+/**
+ * This function lists the cells whose visible value changed since the
+ * given generation, oldest first, as offsets into the cells of a
+ * struct BoardView. A cell changed twice is listed twice. At most
+ * max_offsets are listed; the generation to ask from next is the given
+ * one plus the count returned. Returns -1 if the changes are no longer
+ * kept, because the board was reset since or more than board_x *
+ * board_y changes happened; the caller then reads its whole view again.
+ * Like views, offsets are only given on row-major boards.
+ *
+ * @param generation the generation the caller last saw
+ * @param offsets where to list the cells, x * stride + y
+ * @param max_offsets the room in offsets
+ * @param board the board to look at
+ *
+ * @return the number of cells listed, or -1
+ */
+int board__get_changes_since(uint64_t generation, int *offsets, int max_offsets, const struct Board *board) {
+  uint64_t tiles = (uint64_t) board->board_x * board->board_y;
+  uint64_t pending = board->board_generation - generation;
+  int base = board__index(0, 0, board);
+
+  if (board->board_layout != BOARD_LAYOUT_ROWS || generation < board->board_reset_generation ||
+      generation > board->board_generation || pending > tiles) {
+    return -1;
+  }
+
+  int count = pending < (uint64_t) max_offsets ? (int) pending : max_offsets;
+  // the newest change sits just before history_head
+  int entry = (int) (((uint64_t) board->history_head + tiles - pending) % tiles);
+  for (int i = 0; i < count; i++) {
+    offsets[i] = board->history[entry] - base;
+    entry = entry + 1 < (int) tiles ? entry + 1 : 0;
+  }
+  return count;
+}
+
+//-----------------------------//
+//   USER COMMAND PROCESSORS   //
+//-----------------------------//
+
+/**
+ * This function replaces the specified position with a flag (F).
+ * This function returns true if operation can be completed, ie. 
+ * the spot has yet to be revealed. Returns false otherwise.
+ *
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param board the board to be modified
+ *
+ * @return true if flag is successful; false otherwise
+ */
+bool board__flag(int x, int y, struct Board *board) {
+  int index = board__index(x, y, board);
+
+  if (board->reveal_pointer[index] == false) {
+    board->board_pointer[index] = 'F';
+    board->board_num_flags++;
+    board__record_change(index, board);
+    return true;
+  } else {
+    return false;
+  }
+}
+
+/**
+ * This function counts the mines around a tile from the mine grid.
+ *
+ * @param index the grid index of the tile
+ * @param board the board to check
+ *
+ * @return the number of adjacent mines
+ */
+static int board__count_mines_around(int index, struct Board *board) {
+  int count = 0;
+
+  for (int k = 0; k < BOARD_NUM_NEIGHBORS; k++) {
+    count += board->mine_pointer[board__neighbor(index, k, board)];
+  }
+
+  return count;
+}
+
+/**
+ * This function reveals one tile that is not revealed yet and shows its
+ * number of adjacent mines. A flag on the tile is taken off.
+ *
+ * @param index the grid index of the tile
+ * @param count the number of adjacent mines
+ * @param board the board to be modified
+ */
+static void board__reveal_tile(int index, int count, struct Board *board) {
+  if (board->board_pointer[index] == 'F') {
+    board->board_num_flags--;
+  }
+  board->board_pointer[index] = (char) ('0' + count);
+  board->reveal_pointer[index] = true;
+  board->board_num_revealed++;
+  board__record_change(index, board);
+}
+
+/**
+ * This function reveals the specified position. If the tile has no
+ * adjacent mines, the whole opening and its border are revealed too, in
+ * one pass over the zero tiles of the opening and their neighbors.
+ * Returns true if reveal is successful, ie. the spot has yet to be
+ * revealed. Returns false otherwise.
+ *
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param board the board to be modified
+ * 
+ * @return true if reveal is succesful; false otherwise
+ */
+bool board__reveal(int x, int y, struct Board *board) {
+  int index = board__index(x, y, board);
+
+  if (board->reveal_pointer[index] == true) {
+    return false;
+  }
+
+  if (!board->openings_ready) {
+    board__label_openings(board);
+  }
+
+  int opening = board->opening_pointer[index];
+  if (opening < 0) {
+    board__reveal_tile(index, board->count_pointer[index], board);
+    return true;
+  }
+  if (board->board_pool != NULL && board->board_square &&
+      board->opening_start[opening + 1] - board->opening_start[opening] >= BOARD_PARALLEL_MIN_TILES) {
+    board__reveal_opening_parallel(opening, board);
+    return true;
+  }
+
+  // an opening is revealed all at once, so only its border can be revealed already
+  bool row_major = board->board_layout == BOARD_LAYOUT_ROWS;
+  const int *wrap = board->wrap_pointer;
+  for (int i = board->opening_start[opening]; i < board->opening_start[opening + 1]; i++) {
+    int cell = board->opening_cells[i];
+    if (!board->reveal_pointer[cell]) {
+      board__reveal_tile(cell, 0, board);
     }
-    if (y_bottom) { // right bottom
-      if (board->mine_pointer[x + 1][y - 1] == true) {
-        count++;
+    const int *neighbors = row_major ? board__row_neighbors(cell, board) : NULL;
+    for (int k = 0; k < BOARD_NUM_NEIGHBORS; k++) {
+      int neighbor = !row_major ? board__find_neighbor(cell, k, board)
+                     : wrap != NULL ? wrap[cell + neighbors[k]]
+                                    : cell + neighbors[k];
+      if (!board->reveal_pointer[neighbor]) {
+        board__reveal_tile(neighbor, board->count_pointer[neighbor], board);
       }
     }
-    // right center
-    if (board->mine_pointer[x + 1][y] == true) {
-      count++;
-    }
   }
+    
+  return true;
+}
 
-  // Tile Above
-  if (y_top) {
-    if (board->mine_pointer[x][y + 1] == true) {
-      count++;
+/**
+ * This function places a guess marker on the specified position.
+ * This function will only do this if the spot has yet to be revealed.
+ * A flag on the tile is taken off. Returns true if successful, false
+ * otherwise.
+ *
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param board the board to be modified
+ *
+ * @return true if successful; false otherwise
+ */
+bool board__guess(int x, int y, struct Board *board) {
+  int index = board__index(x, y, board);
+
+  /* Check if the spot has already been revealed */
+  if (board->reveal_pointer[index] == true) {
+    return false;
+  } else {
+    if (board->board_pointer[index] == 'F') {
+      board->board_num_flags--;
     }
+    board->board_pointer[index] = '?';
+    board__record_change(index, board);
+    return true;
   }
+}
+
+//-----------------//
+//   MINE PLACER   //
+//-----------------//
 
-  // Tile Below
-  if (y_bottom) {
-    if (board->mine_pointer[x][y - 1] == true) {
-      count++;
+/**
+ * This function takes an x and y coordinate and places
+ * the mine on the mine_pointer array to keep track of the mines.
+ * Returns true if mine was placed, returns false otherwise.
+ *
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @board the board for the mine to be placed on
+ *
+ * @return true if mine is placed; false otherwise
+ */
+bool board__place_mine(int x, int y, struct Board *board) {
+  int index = board__index(x, y, board);
+
+  if (board->mine_pointer[index] == false) {
+    board->mine_pointer[index] = true;
+    board->board_num_mines++;
+    board->counts_ready = false;
+    board->openings_ready = false;
+    return true;
+  } else {
+    return false;
+  }
+}
+
+/**
+ * This function moves a mine to a tile without one. If the adjacent mine
+ * counts are in use, only the counts of the tiles around the two places
+ * are patched, so a move costs the same on any size of board. The
+ * openings are labeled again on the next reveal. Flags are left alone;
+ * the number of unflagged mines is for the caller to adjust. Returns
+ * true if the mine was moved, false otherwise.
+ *
+ * @param from_x the x coordinate of the mine
+ * @param from_y the y coordinate of the mine
+ * @param to_x the x coordinate to move it to
+ * @param to_y the y coordinate to move it to
+ * @param board the board to be modified
+ *
+ * @return true if the mine is moved; false if there is no mine to move or
+ *         the tile to move it to already has one
+ */
+bool board__move_mine(int from_x, int from_y, int to_x, int to_y, struct Board *board) {
+  int from = board__index(from_x, from_y, board);
+  int to = board__index(to_x, to_y, board);
+  unsigned char *counts = board->count_pointer;
+
+  if (!board->mine_pointer[from] || board->mine_pointer[to]) {
+    return false;
+  }
+
+  board->mine_pointer[from] = false;
+  board->mine_pointer[to] = true;
+  board->openings_ready = false;
+
+  if (board->counts_ready) {
+    // mines and the guard ring keep BOARD_NOT_ZERO
+    for (int k = 0; k < BOARD_NUM_NEIGHBORS; k++) {
+      int neighbor = board__neighbor(from, k, board);
+      counts[neighbor] -= counts[neighbor] != BOARD_NOT_ZERO;
     }
+    for (int k = 0; k < BOARD_NUM_NEIGHBORS; k++) {
+      int neighbor = board__neighbor(to, k, board);
+      counts[neighbor] += counts[neighbor] != BOARD_NOT_ZERO;
+    }
+    counts[to] = BOARD_NOT_ZERO;
+    counts[from] = board__count_mines_around(from, board);
   }
 
-  return count;
+  return true;
+}
+
+//--------------------//
+//   REVEAL UTILITY   //
+//--------------------//
+
+/**
+ * This function takes in an x and y and counts the number of mines
+ * in the adjacent tiles. Returns this value.
+ *
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param the board to check
+ *
+ * @return the number of mines adjacent to this square
+ */
+int board__count_num_adjacent(int x, int y, struct Board *board) {
+  return board__count_mines_around(board__index(x, y, board), board);
 }
 
 /**
@@ -439,119 +1153,855 @@ int board__count_num_adjacent(int x, int y, struct Board *board) {
  * @return true if the spot contains a mine; false otherwise
  */
 bool board__contains_mine(int x, int y, struct Board *board) {
-  if (board->mine_pointer[x][y] == true) {
-    return true;
+  return board->mine_pointer[board__index(x, y, board)];
+}
+
+//--------------//
+//   OPENINGS   //
+//--------------//
+
+/**
+ * This function finds the root of a tile in the union-find forest,
+ * halving the path on the way up.
+ *
+ * @param index the grid index of a zero tile
+ * @param parent the union-find forest
+ *
+ * @return the grid index of the root
+ */
+static int board__find_root(int index, int *parent) {
+  while (parent[index] != index) {
+    parent[index] = parent[parent[index]];
+    index = parent[index];
+  }
+
+  return index;
+}
+
+/**
+ * This function returns where a cell comes in row order. In
+ * BOARD_LAYOUT_ROWS that is its grid index.
+ *
+ * @param index the grid index of the cell
+ * @param board the board to check
+ *
+ * @return a number that orders cells row after row
+ */
+static int board__order(int index, struct Board *board) {
+  if (board->board_layout == BOARD_LAYOUT_ROWS) {
+    return index;
+  }
+  return (board__index_x(index, board) + board->board_guard) * board->board_stride + board__index_y(index, board) +
+         board->board_guard;
+}
+
+/**
+ * This function joins the trees of two zero tiles. The root that comes
+ * first in row order stays root, so a root comes before the rest of its
+ * opening.
+ *
+ * @param first the grid index of a zero tile
+ * @param second the grid index of another zero tile
+ * @param board the board being labeled
+ */
+static void board__join_roots(int first, int second, struct Board *board) {
+  int *parent = board->opening_parent;
+  int first_root = board__find_root(first, parent);
+  int second_root = board__find_root(second, parent);
+
+  if (board__order(first_root, board) < board__order(second_root, board)) {
+    parent[second_root] = first_root;
   } else {
-    return false;
+    parent[first_root] = second_root;
   }
 }
 
-//---------------------//
-//   PRINT FUNCTIONS   //
-//---------------------//
+/**
+ * This function counts the mines around every tile of some rows.
+ *
+ * @param first_row the first row
+ * @param last_row the row after the last one
+ * @param board the board to be counted
+ */
+static void board__count_rows(int first_row, int last_row, struct Board *board) {
+  unsigned char *counts = board->count_pointer;
+  const bool *mines = board->mine_pointer;
+  const int *wrap = board->wrap_pointer;
+  int cols = board__get_y(board);
+  int neighbors[BOARD_NUM_NEIGHBORS];
+
+  if (board->board_layout != BOARD_LAYOUT_ROWS) {
+    for (int i = first_row; i < last_row; i++) {
+      for (int j = 0; j < cols; j++) {
+        int index = board__index(i, j, board);
+        counts[index] = mines[index] ? BOARD_NOT_ZERO : board__count_mines_around(index, board);
+      }
+    }
+    return;
+  }
+
+  for (int i = first_row; i < last_row; i++) {
+    // the counts are bytes, so copies keep stores to them from reloading the board
+    for (int k = 0; k < BOARD_NUM_NEIGHBORS; k++) {
+      neighbors[k] = i & 1 ? board->board_odd_neighbors[k] : board->board_neighbors[k];
+    }
+    int row = board__index(i, 0, board);
+    for (int index = row; index < row + cols; index++) {
+      int count = 0;
+      if (wrap != NULL) {
+        for (int k = 0; k < BOARD_NUM_NEIGHBORS; k++) {
+          count += mines[wrap[index + neighbors[k]]];
+        }
+      } else {
+        for (int k = 0; k < BOARD_NUM_NEIGHBORS; k++) {
+          count += mines[index + neighbors[k]];
+        }
+      }
+      counts[index] = mines[index] ? BOARD_NOT_ZERO : count;
+    }
+  }
+}
 
 /**
- * This function takes in a board and prints the board to the screen.
+ * This function joins each zero tile of some rows with every zero tile
+ * next to it that comes before it in row order, for any topology.
  *
- * @param board the board to be printed
+ * @param first_row the first row
+ * @param last_row the row after the last one
+ * @param board the board to be labeled
  */
-void board__print_board(struct Board *board) {
-  for (int i = board__get_x(board) - 1; i >= 0; i--) {
-    if (i >= 10) {
-      printf("%d ", i);
-    } else {
-      printf(" %d ", i);
+static void board__join_any(int first_row, int last_row, struct Board *board) {
+  const unsigned char *counts = board->count_pointer;
+  const int *wrap = board->wrap_pointer;
+  int *parent = board->opening_parent;
+  int num_neighbors = board->board_num_neighbors;
+
+  if (board->board_layout == BOARD_LAYOUT_ROWS) {
+    // row order is grid order, and the offsets only change with the parity of the row
+    for (int i = first_row; i < last_row; i++) {
+      const int *neighbors = i & 1 ? board->board_odd_neighbors : board->board_neighbors;
+      int row = board__index(i, 0, board);
+      for (int index = row; index < row + board__get_y(board); index++) {
+        if (counts[index] != 0) {
+          continue;
+        }
+        parent[index] = index;
+        for (int k = 0; k < num_neighbors; k++) {
+          int neighbor = wrap != NULL ? wrap[index + neighbors[k]] : index + neighbors[k];
+          if (counts[neighbor] == 0 && neighbor < index) {
+            board__join_roots(neighbor, index, board);
+          }
+        }
+      }
     }
+    return;
+  }
+
+  for (int i = first_row; i < last_row; i++) {
     for (int j = 0; j < board__get_y(board); j++) {
-      char c = board->board_pointer[i][j];
-      const char *bg = "\033[100m"; // Gray
-      if (c == '0') {
-        bg = "\033[42m"; // Green
-      } else if (c == '1' || c == '2') {
-        bg = "\033[43m"; // Yellow
-      } else if (c == '3' || c == '4') {
-        bg = "\033[48;5;208m"; // Orange
-      } else if (c == '5' || c == '6') {
-        bg = "\033[45m"; // Purple
-      } else if (c == '7' || c == '8') {
-        bg = "\033[41m"; // Red
-      } else if (c != '*') {
-        bg = "\033[0m"; // Black
+      int index = board__index(i, j, board);
+      if (counts[index] != 0) {
+        continue;
       }
-      if (board__get_y(board) > 10) {
-        printf("%s[ %c ]\033[0m", bg, c);
-      } else {
-        printf("%s[%c]\033[0m", bg, c);
+      board->opening_parent[index] = index;
+      for (int k = 0; k < board->board_num_neighbors; k++) {
+        int neighbor = board__neighbor(index, k, board);
+        if (counts[neighbor] == 0 && board__order(neighbor, board) < board__order(index, board)) {
+          board__join_roots(neighbor, index, board);
+        }
       }
     }
-    printf("\n");
   }
+}
+
+/**
+ * This function joins each zero tile of some rows with the zero tiles
+ * before it on the square board. The first row is only joined along itself, unless it is the
+ * first row of the board, whose row above is the guard ring; the rows
+ * above it are joined by board__join_seam.
+ *
+ * @param first_row the first row
+ * @param last_row the row after the last one
+ * @param board the board to be labeled
+ */
+static void board__join_rows(int first_row, int last_row, struct Board *board) {
+  const unsigned char *counts = board->count_pointer;
+  int *parent = board->opening_parent;
+  int cols = board__get_y(board);
+  bool row_major = board->board_layout == BOARD_LAYOUT_ROWS;
+
+  if (!board->board_square) {
+    board__join_any(first_row, last_row, board);
+    return;
+  }
+
+  if (first_row > 0) {
+    for (int j = 0; j < cols; j++) {
+      int index = board__index(first_row, j, board);
+      int left = board__neighbor(index, 3, board);
+      if (counts[index] == 0) {
+        parent[index] = counts[left] == 0 ? left : index;
+      }
+    }
+    first_row++;
+  }
+
+  // the one above touches the other three, and only the two above corners can be apart
+  for (int i = first_row; i < last_row; i++) {
+    int row = board__index(i, 0, board);
+    for (int j = 0; j < cols; j++) {
+      int index = row_major ? row + j : board__index(i, j, board);
+      if (counts[index] != 0) {
+        continue;
+      }
+      int up_left = board__neighbor(index, 0, board);
+      int up = board__neighbor(index, 1, board);
+      int up_right = board__neighbor(index, 2, board);
+      int left = board__neighbor(index, 3, board);
+      int joined = index;
+      if (counts[up] == 0) {
+        joined = up;
+      } else if (counts[up_right] == 0) {
+        joined = up_right;
+        if (counts[up_left] == 0) {
+          board__join_roots(up_left, joined, board);
+        } else if (counts[left] == 0) {
+          board__join_roots(left, joined, board);
+        }
+      } else if (counts[up_left] == 0) {
+        joined = up_left;
+      } else if (counts[left] == 0) {
+        joined = left;
+      }
+      parent[index] = joined;
+    }
+  }
+}
+
+/**
+ * This function joins the zero tiles of a row with the zero tiles above
+ * them, once both rows are joined along themselves.
+ *
+ * @param row_x the x coordinate of the row
+ * @param board the board to be labeled
+ */
+static void board__join_seam(int row_x, struct Board *board) {
+  const unsigned char *counts = board->count_pointer;
+
+  for (int j = 0; j < board__get_y(board); j++) {
+    int index = board__index(row_x, j, board);
+    if (counts[index] != 0) {
+      continue;
+    }
+    for (int k = 0; k < 3; k++) {
+      int neighbor = board__neighbor(index, k, board);
+      if (counts[neighbor] == 0) {
+        board__join_roots(neighbor, index, board);
+      }
+    }
+  }
+}
+
+//-------------------//
+//   PARALLEL PATH   //
+//-------------------//
+
+/**
+ * This function returns whether work of a size goes to the thread pool
+ * of the board.
+ *
+ * @param work the number of tiles the work touches
+ * @param board the board to check
+ *
+ * @return true if the work is split across the pool; false otherwise
+ */
+static bool board__parallel(int work, struct Board *board) {
+  return board->board_pool != NULL && board->board_square && work >= BOARD_PARALLEL_MIN_CELLS;
+}
+
+/**
+ * This function returns the number of row bands board__run_bands splits
+ * the board into: one on the serial path.
+ *
+ * @param board the board to check
+ *
+ * @return the number of bands
+ */
+static int board__num_bands(struct Board *board) {
+  if (!board__parallel(board__get_x(board) * board__get_y(board), board)) {
+    return 1;
+  }
+  return board__get_x(board) < BOARD_PARALLEL_TASKS ? board__get_x(board) : BOARD_PARALLEL_TASKS;
+}
+
+/**
+ * This function returns the first row of a band.
+ *
+ * @param band the band, from 0 to board__num_bands inclusive
+ * @param board the board to check
+ *
+ * @return the x coordinate of the row
+ */
+static int board__band_row(int band, struct Board *board) {
+  return (int) ((long long) band * board__get_x(board) / board__num_bands(board));
+}
 
-  if (board__get_y(board) > 10) {
-    printf("     "); 
+/**
+ * This function counts the mines around the tiles of one band, as a
+ * thread pool task.
+ *
+ * @param context the board
+ * @param band the band
+ */
+static void board__count_band(void *context, int band) {
+  struct Board *board = (struct Board *)context;
+  board__count_rows(board__band_row(band, board), board__band_row(band + 1, board), board);
+}
+
+/**
+ * This function joins the zero tiles of one band, as a thread pool task.
+ * The trees of a band stay inside it.
+ *
+ * @param context the board
+ * @param band the band
+ */
+static void board__join_band(void *context, int band) {
+  struct Board *board = (struct Board *)context;
+  board__join_rows(board__band_row(band, board), board__band_row(band + 1, board), board);
+}
+
+/**
+ * This function runs a task on every band of the board, on the thread
+ * pool if the board is large enough and has one.
+ *
+ * @param task the task to run on each band
+ * @param board the board to work on
+ */
+static void board__run_bands(ThreadPoolTask task, struct Board *board) {
+  int num_bands = board__num_bands(board);
+
+  if (num_bands == 1) {
+    task(board, 0);
   } else {
-    printf("    "); 
+    thread_pool__run(num_bands, task, board, board->board_pool);
   }
-  
-  for (int i = 0; i < board__get_y(board); i++) {
-    if (board__get_y(board) > 10) {
-      if (i < 10) {
-        printf("%d    ", i);
-      } else {
-        printf("%d   ", i);
+}
+
+/**
+ * The state of a parallel reveal, shared by its slices.
+ */
+struct BoardReveal {
+    struct Board* board;
+    int           opening;
+    int           scratch[BOARD_PARALLEL_TASKS];    // scratch entry of the first tile each slice lists
+    int           emitted[BOARD_PARALLEL_TASKS];    // tiles each slice reveals
+    int           unflagged[BOARD_PARALLEL_TASKS];  // flags each slice takes off
+    int           offset[BOARD_PARALLEL_TASKS];     // tiles revealed by the slices before each one
+};
+
+/**
+ * This function is board__reveals for the layouts other than
+ * BOARD_LAYOUT_ROWS, where grid order is not row order.
+ *
+ * @param index the grid index of the tile, not in the guard ring
+ * @param cell the grid index of a zero tile that is or touches it
+ * @param opening the opening of the zero tile
+ * @param board the board being revealed
+ *
+ * @return true if the zero tile reveals the tile; false otherwise
+ */
+static bool board__reveals_in_layout(int index, int cell, int opening, struct Board *board) {
+  int order = board__order(cell, board);
+
+  for (int k = 0; k < BOARD_NUM_NEIGHBORS; k++) {
+    int neighbor = board__find_neighbor(index, k, board);
+    if (k == BOARD_NUM_NEIGHBORS / 2 && board__order(index, board) < order && board->count_pointer[index] == 0 &&
+        board->opening_pointer[index] == opening) {
+      return false;
+    }
+    if (board__order(neighbor, board) >= order) {
+      return true;
+    }
+    if (board->count_pointer[neighbor] == 0 && board->opening_pointer[neighbor] == opening) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * This function returns whether a zero tile is the first zero tile of
+ * its opening that is or touches a tile, the one that reveals the tile
+ * on the serial path. The tile list of an opening is in row order, so
+ * only the zero tiles before the zero tile need to be looked at.
+ *
+ * @param index the grid index of the tile, not in the guard ring
+ * @param cell the grid index of a zero tile that is or touches it
+ * @param opening the opening of the zero tile
+ * @param board the board being revealed
+ *
+ * @return true if the zero tile reveals the tile; false otherwise
+ */
+static bool board__reveals(int index, int cell, int opening, struct Board *board) {
+  if (board->board_layout != BOARD_LAYOUT_ROWS) {
+    return board__reveals_in_layout(index, cell, opening, board);
+  }
+
+  // the neighbors go in grid order, and the tile itself sits between the fourth and fifth
+  for (int k = 0; k < BOARD_NUM_NEIGHBORS; k++) {
+    int neighbor = index + board->board_neighbors[k];
+    if (k == BOARD_NUM_NEIGHBORS / 2 && index < cell && board->count_pointer[index] == 0 &&
+        board->opening_pointer[index] == opening) {
+      return false;
+    }
+    if (neighbor >= cell) {
+      return true;
+    }
+    if (board->count_pointer[neighbor] == 0 && board->opening_pointer[neighbor] == opening) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * This function reveals the tiles of one slice of the tile list of an
+ * opening, as a thread pool task, and lists them in the slice's region
+ * of the scratch space in the order the serial path reveals them. A
+ * tile within reach of the zero tiles of an earlier slice is revealed
+ * only by the first zero tile of the list next to it; a tile beyond that
+ * only this slice can reach, so it is revealed by the first zero tile of
+ * the slice to find it hidden, as on the serial path. Either way a tile
+ * is only read and written by the slice revealing it, so slices never
+ * race.
+ *
+ * @param context the parallel reveal
+ * @param slice the slice
+ */
+static void board__reveal_slice(void *context, int slice) {
+  struct BoardReveal *reveal = (struct BoardReveal *)context;
+  struct Board *board = reveal->board;
+  int begin = board->opening_start[reveal->opening];
+  int length = board->opening_start[reveal->opening + 1] - begin;
+  int first = begin + (int) ((long long) slice * length / BOARD_PARALLEL_TASKS);
+  int last = begin + (int) ((long long) (slice + 1) * length / BOARD_PARALLEL_TASKS);
+  int reach = board->board_stride + board->board_guard;
+  int shared = first == begin ? -1 : board__order(board->opening_cells[first - 1], board) + reach;
+  int *listed = board->board_scratch + reveal->scratch[slice];
+  bool row_major = board->board_layout == BOARD_LAYOUT_ROWS;
+  int emitted = 0;
+  int unflagged = 0;
+
+  for (int i = first; i < last; i++) {
+    int cell = board->opening_cells[i];
+    for (int k = -1; k < BOARD_NUM_NEIGHBORS; k++) {
+      int tile = k < 0 ? cell : row_major ? cell + board->board_neighbors[k] : board__find_neighbor(cell, k, board);
+      // the guard ring is never revealed; checking it first keeps the lookups in the grid
+      if (board->count_pointer[tile] == BOARD_NOT_ZERO ||
+          (board__order(tile, board) <= shared && !board__reveals(tile, cell, reveal->opening, board)) ||
+          board->reveal_pointer[tile]) {
+        continue;
       }
-    } else {
-      printf("%d  ", i);
+      unflagged += board->board_pointer[tile] == 'F';
+      board->board_pointer[tile] = (char) ('0' + board->count_pointer[tile]);
+      board->reveal_pointer[tile] = true;
+      listed[emitted++] = tile;
     }
   }
+  reveal->emitted[slice] = emitted;
+  reveal->unflagged[slice] = unflagged;
+}
+
+/**
+ * This function copies the tiles one slice of a parallel reveal listed
+ * into the journal and the history, after those of the slices before it,
+ * as a thread pool task.
+ *
+ * @param context the parallel reveal
+ * @param slice the slice
+ */
+static void board__journal_slice(void *context, int slice) {
+  struct BoardReveal *reveal = (struct BoardReveal *)context;
+  struct Board *board = reveal->board;
+  const int *listed = board->board_scratch + reveal->scratch[slice];
+  int capacity = board__get_x(board) * board__get_y(board);
+  int count = reveal->emitted[slice];
+
+  // the journal keeps the first capacity changes of an action
+  int entry = board->num_changed + reveal->offset[slice];
+  int journaled = entry >= capacity ? 0 : count < capacity - entry ? count : capacity - entry;
+  memcpy(board->changed_cells + entry, listed, journaled * sizeof(int));
+
+  // the history keeps the last capacity changes, wrapping around
+  for (int copied = 0; copied < count;) {
+    int position = (int) (((long long) board->history_head + reveal->offset[slice] + copied) % capacity);
+    int run = count - copied < capacity - position ? count - copied : capacity - position;
+    memcpy(board->history + position, listed + copied, run * sizeof(int));
+    copied += run;
+  }
 }
 
 /**
- * This function takes in a board and prints the board to the screen
- * with mines visable to the user.
+ * This function reveals an opening and its border on the thread pool of
+ * the board, with the same result as the serial walk in board__reveal.
+ * Each slice gets a scratch region as long as the stretch of the board
+ * its zero tiles reach, so the regions never overlap.
  *
- * @param board the board to print
+ * @param opening the opening to reveal
+ * @param board the board to be modified
  */
-void board__print_no_fog(struct Board *board) {
-  for (int i = board__get_x(board) - 1; i >= 0; i--) {
-    if (i >= 10) {
-      printf("%d ", i);
-    } else {
-      printf(" %d ", i);
+static void board__reveal_opening_parallel(int opening, struct Board *board) {
+  struct BoardReveal reveal;
+  int begin = board->opening_start[opening];
+  int length = board->opening_start[opening + 1] - begin;
+  int base = board__order(board->opening_cells[begin], board);
+  int reach = board->board_stride + board->board_guard;
+  int revealed = 0;
+
+  reveal.board = board;
+  reveal.opening = opening;
+  for (int slice = 0; slice < BOARD_PARALLEL_TASKS; slice++) {
+    int first = begin + (int) ((long long) slice * length / BOARD_PARALLEL_TASKS);
+    reveal.scratch[slice] = board__order(board->opening_cells[first], board) - base + slice * (2 * reach + 1);
+  }
+  thread_pool__run(BOARD_PARALLEL_TASKS, board__reveal_slice, &reveal, board->board_pool);
+
+  for (int slice = 0; slice < BOARD_PARALLEL_TASKS; slice++) {
+    reveal.offset[slice] = revealed;
+    revealed += reveal.emitted[slice];
+    board->board_num_flags -= reveal.unflagged[slice];
+  }
+  thread_pool__run(BOARD_PARALLEL_TASKS, board__journal_slice, &reveal, board->board_pool);
+
+  board->board_num_revealed += revealed;
+  board->num_changed += revealed;
+  if (board->num_changed > board__get_x(board) * board__get_y(board)) {
+    board->num_changed = board__get_x(board) * board__get_y(board);
+  }
+  board->history_head = (board->history_head + revealed) % (board__get_x(board) * board__get_y(board));
+  board->board_generation += revealed;
+}
+
+/**
+ * This function labels the openings of the board once its mines are
+ * placed. It stores the adjacent mine count of every tile, unless the
+ * counts are still up to date from before a mine was moved, joins the
+ * zero tiles into openings with union-find and lists the zero tiles of
+ * each opening together, for board__reveal. It also works out the 3BV of
+ * the board: one click per opening plus one per numbered tile that
+ * borders no opening. Nothing is allocated.
+ *
+ * @param board the board to be labeled
+ */
+void board__label_openings(struct Board *board) {
+  if (board->board_preset != BOARD_PRESET_NONE) {
+    board__label_preset(board);
+    return;
+  }
+
+  int *parent = board->opening_parent;
+  int *start = board->opening_start;
+  int *openings = board->opening_pointer;
+  int *cells = board->opening_cells;
+  unsigned char *counts = board->count_pointer;
+  int rows = board__get_x(board);
+  int cols = board__get_y(board);
+  int neighbors[BOARD_NUM_NEIGHBORS];
+  bool row_major = board->board_layout == BOARD_LAYOUT_ROWS;
+  bool uniform = board->board_uniform;
+  int num_openings = 0;
+  int num_zeros = 0;
+  int num_isolated = 0;
+
+  // copies keep stores to the labels from reloading the board
+  for (int k = 0; k < BOARD_NUM_NEIGHBORS; k++) {
+    neighbors[k] = board->board_neighbors[k];
+  }
+
+  // Count the mines around every tile; mines and the guard ring are not zero tiles
+  if (!board->counts_ready) {
+    memset(counts, BOARD_NOT_ZERO, board->board_cells);
+    board__run_bands(board__count_band, board);
+    board->counts_ready = true;
+  }
+
+  // Join the zero tiles into trees, band by band, then join the bands
+  board__run_bands(board__join_band, board);
+  for (int band = 1; band < board__num_bands(board); band++) {
+    board__join_seam(board__band_row(band, board), board);
+  }
+
+  // Collect the zero tiles in row order; every tile is written, only zero tiles are kept
+  for (int i = 0; i < rows; i++) {
+    int row = board__index(i, 0, board);
+    for (int j = 0; j < cols; j++) {
+      int index = row_major ? row + j : board__index(i, j, board);
+      openings[index] = BOARD_NO_OPENING;
+      cells[num_zeros] = index;
+      num_zeros += counts[index] == 0;
     }
-    for (int j = 0; j < board__get_y(board); j++) {
-      if (board__get_y(board) > 10) {
-        if (board->mine_pointer[i][j] == true) {
-          printf("[ @ ]");
-        } else {
-          printf("[ %c ]", board->board_pointer[i][j]);
+  }
+
+  // Number the openings in order of their roots and count their zero tiles
+  start[0] = 0;
+  for (int i = 0; i < num_zeros; i++) {
+    int root = board__find_root(cells[i], parent);
+    if (root == cells[i]) {
+      openings[root] = num_openings;
+      start[++num_openings] = 0;
+    }
+    openings[cells[i]] = openings[root];
+    start[openings[root] + 1]++;
+  }
+
+  // Group the zero tiles by opening, a counting sort through the forest
+  for (int i = 0; i < num_openings; i++) {
+    start[i + 1] += start[i];
+  }
+  for (int i = 0; i < num_zeros; i++) {
+    parent[start[openings[cells[i]]]++] = cells[i];
+  }
+  for (int i = num_openings; i > 0; i--) {
+    start[i] = start[i - 1];
+  }
+  start[0] = 0;
+  memcpy(cells, parent, num_zeros * sizeof(int));
+
+  // Numbered tiles next to no zero tile each take a click of their own, the rest are borders
+  memset(parent, 0, board->board_cells * sizeof(int));
+  if (uniform) {
+    for (int i = 0; i < num_zeros; i++) {
+      for (int k = 0; k < BOARD_NUM_NEIGHBORS; k++) {
+        parent[cells[i] + neighbors[k]] = 1;
+      }
+    }
+  } else {
+    for (int i = 0; i < num_zeros; i++) {
+      const int *offsets = row_major ? board__row_neighbors(cells[i], board) : NULL;
+      for (int k = 0; k < board->board_num_neighbors; k++) {
+        parent[!row_major ? board__find_neighbor(cells[i], k, board)
+               : board->wrap_pointer != NULL ? board->wrap_pointer[cells[i] + offsets[k]]
+                                             : cells[i] + offsets[k]] = 1;
+      }
+    }
+  }
+  for (int i = 0; i < rows; i++) {
+    int row = board__index(i, 0, board);
+    for (int j = 0; j < cols; j++) {
+      int index = row_major ? row + j : board__index(i, j, board);
+      bool numbered = (unsigned) (counts[index] - 1) < BOARD_NUM_NEIGHBORS;
+      num_isolated += numbered && parent[index] == 0;
+      openings[index] = numbered && parent[index] != 0 ? BOARD_BORDER : openings[index];
+    }
+  }
+
+  board->board_num_openings = num_openings;
+  board->board_3bv = num_openings + num_isolated;
+  board->openings_ready = true;
+}
+
+/**
+ * This function returns the number of openings on a labeled board.
+ *
+ * @param board the board to return the value on
+ *
+ * @return the number of openings
+ */
+int board__get_num_openings(struct Board *board) {
+  return board->board_num_openings;
+}
+
+/**
+ * This function returns the 3BV of a labeled board, the fewest clicks
+ * that reveal every safe tile.
+ *
+ * @param board the board to return the value on
+ *
+ * @return the 3BV
+ */
+int board__get_3bv(struct Board *board) {
+  return board->board_3bv;
+}
+
+/**
+ * This function returns the opening a tile belongs to on a labeled
+ * board. Only zero tiles belong to one; numbered tiles next to an
+ * opening are BOARD_BORDER, and mines and the other numbered tiles are
+ * BOARD_NO_OPENING.
+ *
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param board the board to check
+ *
+ * @return the opening, BOARD_BORDER or BOARD_NO_OPENING
+ */
+int board__get_opening(int x, int y, struct Board *board) {
+  return board->opening_pointer[board__index(x, y, board)];
+}
+
+//-------------//
+//   PRESETS   //
+//-------------//
+
+/**
+ * This function sets the grids of a square row-major board to the start
+ * of a game, like board__init_grids. It is inlined into each preset,
+ * where the size is a constant and the loops become fixed-size stores.
+ *
+ * @param rows the number of rows
+ * @param cols the number of columns
+ * @param board the board to be initialized
+ */
+BOARD_INLINE static void board__init_fixed(int rows, int cols, struct Board *board) {
+  int stride = cols + 2;
+
+  memset(board->mine_pointer, false, (rows + 2) * stride);
+  memset(board->board_pointer, '*', (rows + 2) * stride);
+  memset(board->reveal_pointer, true, (rows + 2) * stride);
+  for (int i = 1; i <= rows; i++) {
+    memset(board->reveal_pointer + i * stride + 1, false, cols);
+  }
+}
+
+/**
+ * This function labels a square row-major board, like
+ * board__label_openings on one band. It is inlined into each preset,
+ * where the size is a constant: the stride and the neighbor offsets are
+ * immediates and the neighbor loops unroll.
+ *
+ * @param rows the number of rows
+ * @param cols the number of columns
+ * @param board the board to be labeled
+ */
+BOARD_INLINE static void board__label_fixed(int rows, int cols, struct Board *board) {
+  int stride = cols + 2;
+  int neighbors[BOARD_NUM_NEIGHBORS] = {-stride - 1, -stride, -stride + 1, -1, 1, stride - 1, stride, stride + 1};
+  const bool *mines = board->mine_pointer;
+  unsigned char *counts = board->count_pointer;
+  int *parent = board->opening_parent;
+  int *start = board->opening_start;
+  int *openings = board->opening_pointer;
+  int *cells = board->opening_cells;
+  int num_openings = 0;
+  int num_zeros = 0;
+  int num_isolated = 0;
+
+  if (!board->counts_ready) {
+    memset(counts, BOARD_NOT_ZERO, (rows + 2) * stride);
+    for (int i = 1; i <= rows; i++) {
+      for (int index = i * stride + 1; index <= i * stride + cols; index++) {
+        int count = 0;
+        for (int k = 0; k < BOARD_NUM_NEIGHBORS; k++) {
+          count += mines[index + neighbors[k]];
         }
-      } else {
-        if (board->mine_pointer[i][j] == true) {
-          printf("[@]");
-        } else {
-          printf("[%c]", board->board_pointer[i][j]);
+        counts[index] = mines[index] ? BOARD_NOT_ZERO : count;
+      }
+    }
+    board->counts_ready = true;
+  }
+
+  // Join as board__join_rows does, then collect the zero tiles in row order
+  for (int i = 1; i <= rows; i++) {
+    for (int index = i * stride + 1; index <= i * stride + cols; index++) {
+      openings[index] = BOARD_NO_OPENING;
+      if (counts[index] != 0) {
+        continue;
+      }
+      int joined = index;
+      if (counts[index - stride] == 0) {
+        joined = index - stride;
+      } else if (counts[index - stride + 1] == 0) {
+        joined = index - stride + 1;
+        if (counts[index - stride - 1] == 0) {
+          board__join_roots(index - stride - 1, joined, board);
+        } else if (counts[index - 1] == 0) {
+          board__join_roots(index - 1, joined, board);
         }
+      } else if (counts[index - stride - 1] == 0) {
+        joined = index - stride - 1;
+      } else if (counts[index - 1] == 0) {
+        joined = index - 1;
       }
+      parent[index] = joined;
+      cells[num_zeros++] = index;
     }
-    printf("\n");
   }
 
-  if (board__get_y(board) > 10) {
-    printf("     "); 
-  } else {
-    printf("    "); 
+  // Number the openings and group their zero tiles, as board__label_openings does
+  start[0] = 0;
+  for (int i = 0; i < num_zeros; i++) {
+    int root = board__find_root(cells[i], parent);
+    if (root == cells[i]) {
+      openings[root] = num_openings;
+      start[++num_openings] = 0;
+    }
+    openings[cells[i]] = openings[root];
+    start[openings[root] + 1]++;
   }
-  
-  for (int i = 0; i < board__get_y(board); i++) {
-    if (board__get_y(board) > 10) {
-      if (i < 10) {
-        printf("%d    ", i);
-      } else {
-        printf("%d   ", i);
-      }
-    } else {
-      printf("%d  ", i);
+  for (int i = 0; i < num_openings; i++) {
+    start[i + 1] += start[i];
+  }
+  for (int i = 0; i < num_zeros; i++) {
+    parent[start[openings[cells[i]]]++] = cells[i];
+  }
+  for (int i = num_openings; i > 0; i--) {
+    start[i] = start[i - 1];
+  }
+  start[0] = 0;
+  memcpy(cells, parent, num_zeros * sizeof(int));
+
+  memset(parent, 0, (rows + 2) * stride * sizeof(int));
+  for (int i = 0; i < num_zeros; i++) {
+    for (int k = 0; k < BOARD_NUM_NEIGHBORS; k++) {
+      parent[cells[i] + neighbors[k]] = 1;
+    }
+  }
+  for (int i = 1; i <= rows; i++) {
+    for (int index = i * stride + 1; index <= i * stride + cols; index++) {
+      bool numbered = (unsigned) (counts[index] - 1) < BOARD_NUM_NEIGHBORS;
+      num_isolated += numbered && parent[index] == 0;
+      openings[index] = numbered && parent[index] != 0 ? BOARD_BORDER : openings[index];
     }
   }
+
+  board->board_num_openings = num_openings;
+  board->board_3bv = num_openings + num_isolated;
+  board->openings_ready = true;
+}
+
+// One copy of the code above per preset, with its size built in
+#define BOARD_PRESET_FUNCTIONS(NAME, name, rows, cols, mines)                                              \
+  static void board__init_##name(struct Board *board) {                                                    \
+    board__init_fixed(rows, cols, board);                                                                  \
+  }                                                                                                        \
+  static void board__label_##name(struct Board *board) {                                                   \
+    board__label_fixed(rows, cols, board);                                                                 \
+  }
+BOARD_PRESETS(BOARD_PRESET_FUNCTIONS)
+#undef BOARD_PRESET_FUNCTIONS
+
+#define BOARD_PRESET_CODE(NAME, name, rows, cols, mines) {board__init_##name, board__label_##name},
+static const struct {
+  void (*init)(struct Board *board);
+  void (*label)(struct Board *board);
+} BOARD_PRESET_CODE_TABLE[BOARD_NUM_PRESETS] = {BOARD_PRESETS(BOARD_PRESET_CODE)};
+#undef BOARD_PRESET_CODE
+
+/**
+ * This function sets the grids of a preset board to the start of a
+ * game with the code built for its size.
+ *
+ * @param board the board to be initialized
+ */
+static void board__init_preset(struct Board *board) {
+  BOARD_PRESET_CODE_TABLE[board->board_preset].init(board);
+}
+
+/**
+ * This function labels a preset board with the code built for its size.
+ *
+ * @param board the board to be labeled
+ */
+static void board__label_preset(struct Board *board) {
+  BOARD_PRESET_CODE_TABLE[board->board_preset].label(board);
 }
@@ -6,31 +6,224 @@
 #define BOARD_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "alloc/alloc.h"
+
+#define BOARD_NUM_NEIGHBORS 8 // the most neighbors a tile can have
+
+// board__get_opening of tiles outside every opening
+#define BOARD_NO_OPENING -1 // a mine, or a numbered tile that takes a click of its own
+#define BOARD_BORDER     -2 // a numbered tile on the border of an opening
+
+#define BOARD_TILE_SHIFT 3 // BOARD_LAYOUT_TILES stores 8x8 tiles
+#define BOARD_TILE_SIZE  (1 << BOARD_TILE_SHIFT)
+
+struct ThreadPool;
+
+// which tiles are neighbors: a tile is counted by and revealed with its neighbors
+struct BoardTopology {
+    int  num_neighbors;                          // at most BOARD_NUM_NEIGHBORS
+    int  steps[2][BOARD_NUM_NEIGHBORS][2];       // (x, y) step to each neighbor, from even and from odd rows
+    bool wrap;                                   // a torus: steps off one edge come back on the opposite one
+};
+
+extern const struct BoardTopology BOARD_TOPOLOGY_SQUARE; // the 8 tiles around, the classic board
+extern const struct BoardTopology BOARD_TOPOLOGY_TORUS;  // the 8 tiles around, edges wrapped
+extern const struct BoardTopology BOARD_TOPOLOGY_HEX;    // 6 tiles around, odd rows shifted half a tile right
+extern const struct BoardTopology BOARD_TOPOLOGY_KNIGHT; // the 8 tiles a chess knight jumps to
+
+// the classic presets as (NAME, name, rows, cols, mines): square row-major
+// boards of their size are reset and labeled by code built for that size
+#define BOARD_PRESETS(X)                      \
+    X(BEGINNER, beginner, 9, 9, 10)           \
+    X(INTERMEDIATE, intermediate, 16, 16, 40) \
+    X(EXPERT, expert, 16, 30, 99)
+
+#define BOARD_PRESET_ENUM(NAME, name, rows, cols, mines) BOARD_PRESET_##NAME,
+enum BoardPreset {
+    BOARD_PRESET_NONE = -1,
+    BOARD_PRESETS(BOARD_PRESET_ENUM)
+    BOARD_NUM_PRESETS
+};
+#undef BOARD_PRESET_ENUM
+
+// how the cells of the grids are ordered in memory
+enum BoardLayout {
+    BOARD_LAYOUT_ROWS,   // row after row
+    BOARD_LAYOUT_TILES,  // square tiles row after row, each tile row after row
+    BOARD_LAYOUT_MORTON, // Morton (Z) order, the bits of x and y interleaved
+};
 
 struct Board {
-    bool** mine_pointer;
-    bool** reveal_pointer;
-    char** board_pointer;
-    int    board_x;
-    int    board_y;
-    int    board_num_mines;
-    int    board_num_flags;
-    bool   board_no_fog;
+    bool*          mine_pointer;    // the grids are padded, see board__index
+    bool*          reveal_pointer;
+    char*          board_pointer;
+    unsigned char* count_pointer;   // adjacent mines, valid while counts_ready
+    int*           opening_pointer; // opening of each zero tile, BOARD_NO_OPENING or BOARD_BORDER
+    int*           opening_parent;  // union-find forest used while labeling
+    int*           opening_start;   // opening i lists opening_cells[start[i]..start[i+1])
+    int*           opening_cells;   // zero tiles, grouped by opening
+    bool           counts_ready;    // cleared by placing a mine, moving one keeps it
+    bool           openings_ready;  // cleared by placing or moving a mine
+    int            board_num_openings;
+    int            board_3bv;
+    int*           changed_cells;   // cells whose visible value changed, as grid indexes
+    int            num_changed;
+    int*           history;         // the last board_x * board_y changes, as grid indexes, oldest overwritten
+    int            history_head;    // entry of history the next change goes to
+    uint64_t       board_generation;       // visible changes since the board was built, resets included
+    uint64_t       board_reset_generation; // generation of the last reset, older ones are gone
+    int            board_x;
+    int            board_y;
+    int            board_stride;    // board_y + 2 * board_guard, the distance between rows
+    int            board_guard;     // width of the guard ring, the longest step of the topology
+    int            board_neighbors[BOARD_NUM_NEIGHBORS];     // index offsets of the neighbors, row-major
+    int            board_odd_neighbors[BOARD_NUM_NEIGHBORS]; // the same from odd rows, for hex grids
+    int            board_num_neighbors;
+    bool           board_square;    // BOARD_TOPOLOGY_SQUARE, which labeling and the parallel path specialize
+    bool           board_uniform;   // every tile has its neighbors at index + board_neighbors[k]
+    int*           wrap_pointer;    // on a torus, the tile each guard cell stands for; NULL otherwise
+    enum BoardLayout board_layout;
+    int            board_tiles_per_row; // tiles across the padded width, for BOARD_LAYOUT_TILES
+    int            board_cells;     // cells in each grid, guard ring and layout padding included
+    enum BoardPreset board_preset;  // the preset of the board's size and shape, or BOARD_PRESET_NONE
+    int            board_num_mines;
+    int            board_num_flags;
+    int            board_num_revealed;
+    bool           board_no_fog;
+    struct ThreadPool* board_pool;  // runs labeling and large reveals in parallel, or NULL
+    int*           board_scratch;   // where the slices of a parallel reveal list their tiles, while pooled
+    size_t         board_scratch_size;
+    struct Allocator board_allocator; // where the grids came from
+    struct AllocStats board_alloc_stats;
 }; // board
 
+// the visible grid of a row-major board, read in place
+struct BoardView {
+    const char* cells;      // the visible value of (x, y) is cells[x * stride + y]
+    int         rows;
+    int         cols;
+    int         stride;
+    uint64_t    generation; // of the board when the view was taken
+};
+
+/**
+ * This function spreads the low 16 bits of a value to the even bits.
+ */
+static inline unsigned board__spread(unsigned value) {
+    value &= 0xFFFF;
+    value = (value | value << 8) & 0x00FF00FF;
+    value = (value | value << 4) & 0x0F0F0F0F;
+    value = (value | value << 2) & 0x33333333;
+    value = (value | value << 1) & 0x55555555;
+    return value;
+}
+
+/**
+ * This function gathers the even bits of a value into the low 16 bits.
+ */
+static inline unsigned board__compact(unsigned value) {
+    value &= 0x55555555;
+    value = (value | value >> 1) & 0x33333333;
+    value = (value | value >> 2) & 0x0F0F0F0F;
+    value = (value | value >> 4) & 0x00FF00FF;
+    value = (value | value >> 8) & 0x0000FFFF;
+    return value;
+}
+
+/**
+ * The grids have a guard ring around the board: no mines, already
+ * revealed. Cell (x, y) is at this index in every layout. Only in
+ * BOARD_LAYOUT_ROWS are the cells of a row next to each other, and only
+ * on uniform boards are the neighbors at index + board_neighbors[k];
+ * board__neighbor finds them on any board.
+ */
+static inline int board__index(int x, int y, const struct Board* board) {
+    int px = x + board->board_guard;
+    int py = y + board->board_guard;
+
+    if (board->board_layout == BOARD_LAYOUT_ROWS) {
+        return px * board->board_stride + py;
+    } else if (board->board_layout == BOARD_LAYOUT_TILES) {
+        int tile = (px >> BOARD_TILE_SHIFT) * board->board_tiles_per_row + (py >> BOARD_TILE_SHIFT);
+        return tile << (2 * BOARD_TILE_SHIFT) | (px & (BOARD_TILE_SIZE - 1)) << BOARD_TILE_SHIFT |
+               (py & (BOARD_TILE_SIZE - 1));
+    }
+    return (int) (board__spread((unsigned) px) << 1 | board__spread((unsigned) py));
+}
+
+static inline int board__index_x(int index, const struct Board* board) {
+    if (board->board_layout == BOARD_LAYOUT_ROWS) {
+        return index / board->board_stride - board->board_guard;
+    } else if (board->board_layout == BOARD_LAYOUT_TILES) {
+        int tile = index >> (2 * BOARD_TILE_SHIFT);
+        return (tile / board->board_tiles_per_row) * BOARD_TILE_SIZE +
+               ((index >> BOARD_TILE_SHIFT) & (BOARD_TILE_SIZE - 1)) - board->board_guard;
+    }
+    return (int) board__compact((unsigned) index >> 1) - board->board_guard;
+}
+
+static inline int board__index_y(int index, const struct Board* board) {
+    if (board->board_layout == BOARD_LAYOUT_ROWS) {
+        return index % board->board_stride - board->board_guard;
+    } else if (board->board_layout == BOARD_LAYOUT_TILES) {
+        int tile = index >> (2 * BOARD_TILE_SHIFT);
+        return (tile % board->board_tiles_per_row) * BOARD_TILE_SIZE + (index & (BOARD_TILE_SIZE - 1)) -
+               board->board_guard;
+    }
+    return (int) board__compact((unsigned) index) - board->board_guard;
+}
+
+int board__find_neighbor(int index, int k, const struct Board* board);
+
+/**
+ * Neighbor k of the tile at index, for k below BOARD_NUM_NEIGHBORS. The
+ * neighbors of the topology come first; the rest are the tile itself,
+ * so loops over all BOARD_NUM_NEIGHBORS visit it instead of a neighbor.
+ * On the square board, k goes in row order: the three cells of the row
+ * above, left, right, the three of the row below.
+ */
+static inline int board__neighbor(int index, int k, const struct Board* board) {
+    if (board->board_uniform) {
+        return index + board->board_neighbors[k];
+    }
+    return board__find_neighbor(index, k, board);
+}
+
 // constructor / destructor
 bool board__build_array(int width, int height, struct Board* board); // Default Constructor
+bool board__build_array_layout(int width, int height, enum BoardLayout layout, struct Board* board);
+bool board__build_array_topology(int width, int height, const struct BoardTopology* topology, struct Board* board);
+bool board__build_array_allocator(int width, int height, const struct Allocator* allocator, struct Board* board);
+size_t board__memory_size(int width, int height);
 void board__destruct(struct Board* board);                           // Deconstructor
+void board__reset(struct Board* board);                              // Clear for reuse
 
 // getters/setters
 void board__set_x(int x, struct Board* board);
 void board__set_y(int y, struct Board* board);
 void board__set_no_fog(bool no_fog, struct Board* board);
+bool board__set_pool(struct ThreadPool* pool, struct Board* board);
 int  board__get_x(struct Board* board);
 int  board__get_y(struct Board* board);
 bool board__get_no_fog(struct Board* board);
 int  board__get_num_mines(struct Board* board);
 int  board__get_num_flags(struct Board* board);
+int  board__get_num_revealed(struct Board* board);
+bool board__in_bounds(int x, int y, struct Board* board);
+char board__get_cell(int x, int y, struct Board* board);
+bool board__is_revealed(int x, int y, struct Board* board);
+
+// change journal
+void board__clear_changes(struct Board* board);
+int  board__get_num_changes(struct Board* board);
+
+// read-only views
+bool     board__get_view(struct BoardView* view, const struct Board* board);
+uint64_t board__get_generation(const struct Board* board);
+int      board__get_changes_since(uint64_t generation, int* offsets, int max_offsets, const struct Board* board);
 
 // user command processors
 bool board__flag(int x, int y, struct Board* board);
@@ -38,13 +231,16 @@ bool board__reveal(int x, int y, struct Board* board);
 bool board__guess(int x, int y, struct Board* board);
 // mine placer
 bool board__place_mine(int x, int y, struct Board* board);
+bool board__move_mine(int from_x, int from_y, int to_x, int to_y, struct Board* board);
 
 // reveal utility
 int  board__count_num_adjacent(int x, int y, struct Board* board);
 bool board__contains_mine(int x, int y, struct Board* board);
 
-// print functions
-void board__print_board(struct Board* board);
-void board__print_no_fog(struct Board* board);
+// openings
+void board__label_openings(struct Board* board);
+int  board__get_num_openings(struct Board* board);
+int  board__get_3bv(struct Board* board);
+int  board__get_opening(int x, int y, struct Board* board);
 
 #endif // BOARD_H
@@ -0,0 +1,393 @@
+/**
+ * @file bot_protocol.c
+ * @brief Implementation for the binary bot protocol.
+ *
+ * The bot protocol lets a program play over stdin/stdout without parsing
+ * the colored text board. Every request is a fixed size frame and every
+ * reply lists only the cells the request changed.
+ *
+ * Design Philosophy:
+ *
+ * All numbers are little endian.
+ *
+ * A request is 8 bytes: op (u8), reserved (u8), x (u16), y (u16), arg (u16).
+ *
+ *   n  new game, x = rows, y = cols, arg = mines, reserved = first click
+ *      (an enum GameFirstClick: 0 any, 1 safe tile, 2 opening)
+ *   s  seed the following games with x | y << 16 | arg << 32
+ *   r  reveal cell (x, y)
+ *   f  flag cell (x, y)
+ *   g  guess cell (x, y)
+ *   q  end the current game
+ *
+ * A reply is 8 bytes: status (u8, an enum GameStatus), 3 reserved bytes
+ * and count (u32), followed by count cell entries of 4 bytes each,
+ * (x * cols + y) << 8 | value, where value is the new visible character.
+ * A new game that could not be allocated replies GAME_STATUS_NO_MEMORY
+ * and leaves no game to play.
+ *
+ * Replies for every complete request in a read are collected in one
+ * buffer and written with one write, so a bot that pipelines requests
+ * pays one system call per batch rather than per move.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE // clock_gettime
+#endif
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bot/bot_protocol.h"
+#include "game/game.h"
+#include "server/buffer.h"
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#define bot_read(buffer, size)  _read(0, buffer, (unsigned) (size))
+#define bot_write(buffer, size) _write(1, buffer, (unsigned) (size))
+#else
+#include <unistd.h>
+#define bot_read(buffer, size)  read(0, buffer, size)
+#define bot_write(buffer, size) write(1, buffer, size)
+#endif
+
+#define BOT_PROTOCOL_READ_SIZE 65536
+
+struct BotState {
+    struct Game game;
+    bool        has_game;
+    uint64_t    seed;
+};
+
+/**
+ * This function reads a little endian u16 from a frame.
+ */
+static int bot_protocol__u16(const unsigned char *bytes) {
+  return bytes[0] | (bytes[1] << 8);
+}
+
+/**
+ * This function appends a reply header to the output buffer.
+ *
+ * @param status the status of the request
+ * @param count the number of cell entries that follow
+ * @param out the output buffer
+ */
+static void bot_protocol__reply(enum GameStatus status, uint32_t count, struct Buffer *out) {
+  unsigned char header[BOT_PROTOCOL_RESPONSE_SIZE] = {
+      (unsigned char) status,
+      0,
+      0,
+      0,
+      (unsigned char) count,
+      (unsigned char) (count >> 8),
+      (unsigned char) (count >> 16),
+      (unsigned char) (count >> 24),
+  };
+  buffer__append((const char *)header, sizeof(header), out);
+}
+
+/**
+ * This function appends the reply for a move: the status and every cell
+ * in the board's change journal.
+ *
+ * @param status the status of the move
+ * @param out the output buffer
+ * @param state the bot state
+ */
+static void bot_protocol__reply_changes(enum GameStatus status, struct Buffer *out, struct BotState *state) {
+  struct Board *board = &state->game.board;
+  int count = board__get_num_changes(board);
+
+  bot_protocol__reply(status, (uint32_t) count, out);
+  for (int i = 0; i < count; i++) {
+    int cell = board->changed_cells[i];
+    uint32_t index = (uint32_t) (board__index_x(cell, board) * board__get_y(board) + board__index_y(cell, board));
+    uint32_t entry = index << 8 | (unsigned char) board->board_pointer[cell];
+    unsigned char bytes[4] = {
+        (unsigned char) entry,
+        (unsigned char) (entry >> 8),
+        (unsigned char) (entry >> 16),
+        (unsigned char) (entry >> 24),
+    };
+    buffer__append((const char *)bytes, sizeof(bytes), out);
+  }
+}
+
+/**
+ * This function handles one request frame and appends its reply.
+ *
+ * @param frame the request frame
+ * @param out the output buffer
+ * @param state the bot state
+ */
+static void bot_protocol__handle(const unsigned char *frame, struct Buffer *out, struct BotState *state) {
+  int op = frame[0];
+  int x = bot_protocol__u16(frame + 2);
+  int y = bot_protocol__u16(frame + 4);
+  int arg = bot_protocol__u16(frame + 6);
+
+  if (op == BOT_OP_NEW) {
+    int first_click = frame[1];
+    if (x < 2 || y < 2 || (int64_t) x * y >= BOT_PROTOCOL_MAX_CELLS || arg < 1 || arg >= (int64_t) x * y ||
+        first_click > GAME_FIRST_CLICK_OPENING) {
+      bot_protocol__reply(GAME_STATUS_INVALID, 0, out);
+      return;
+    }
+    if (state->has_game) {
+      board__destruct(&state->game.board);
+      state->has_game = false;
+    }
+    if (!game__build_game_seeded(y, x, arg, state->seed++, &state->game)) {
+      bot_protocol__reply(GAME_STATUS_NO_MEMORY, 0, out);
+      return;
+    }
+    game__set_first_click((enum GameFirstClick) first_click, &state->game);
+    game__set_start_time(&state->game);
+    state->has_game = true;
+    bot_protocol__reply(GAME_STATUS_OK, 0, out);
+  } else if (op == BOT_OP_SEED) {
+    state->seed = (uint64_t) x | (uint64_t) y << 16 | (uint64_t) arg << 32;
+    bot_protocol__reply(GAME_STATUS_OK, 0, out);
+  } else if (op == BOT_OP_QUIT) {
+    if (state->has_game) {
+      game__set_end(true, &state->game);
+    }
+    bot_protocol__reply(GAME_STATUS_OK, 0, out);
+  } else if (!state->has_game) {
+    bot_protocol__reply(GAME_STATUS_ENDED, 0, out);
+  } else {
+    board__clear_changes(&state->game.board);
+    enum GameStatus status = game__apply((char) op, x, y, &state->game);
+    bot_protocol__reply_changes(status, out, state);
+  }
+}
+
+/**
+ * This function writes the whole buffer to stdout. Returns false if
+ * stdout is closed.
+ *
+ * @param out the buffer to write
+ *
+ * @return true if written; false otherwise
+ */
+static bool bot_protocol__write(struct Buffer *out) {
+  size_t written = 0;
+  while (written < out->length) {
+    long result = (long) bot_write(out->data + written, out->length - written);
+    if (result <= 0) {
+      return false;
+    }
+    written += (size_t) result;
+  }
+  out->length = 0;
+  return true;
+}
+
+/**
+ * This function runs the bot protocol on stdin/stdout until stdin is
+ * closed. Returns the exit code of the program.
+ *
+ * @return the exit code
+ */
+int bot_protocol__run() {
+  static unsigned char in[BOT_PROTOCOL_READ_SIZE];
+  struct BotState state;
+  struct Buffer out;
+  size_t length = 0;
+
+#if defined(_WIN32)
+  _setmode(0, _O_BINARY);
+  _setmode(1, _O_BINARY);
+#endif
+
+  state.has_game = false;
+  state.seed = 1;
+  buffer__init(&out);
+
+  for (;;) {
+    long received = (long) bot_read(in + length, sizeof(in) - length);
+    if (received <= 0) {
+      break;
+    }
+    length += (size_t) received;
+
+    size_t offset = 0;
+    while (length - offset >= BOT_PROTOCOL_REQUEST_SIZE) {
+      bot_protocol__handle(in + offset, &out, &state);
+      offset += BOT_PROTOCOL_REQUEST_SIZE;
+    }
+    memmove(in, in + offset, length - offset);
+    length -= offset;
+
+    if (!bot_protocol__write(&out)) {
+      break;
+    }
+  }
+
+  if (state.has_game) {
+    board__destruct(&state.game.board);
+  }
+  buffer__destruct(&out);
+  return 0;
+}
+
+//---------------//
+//   BENCHMARK   //
+//---------------//
+
+#if defined(__linux__) || defined(__APPLE__)
+
+#include <sys/wait.h>
+#include <time.h>
+
+#include "rng/rng.h"
+
+/**
+ * This function reads exactly the requested number of bytes from a
+ * file descriptor. Returns false on end of file or error.
+ */
+static bool bot_protocol__read_exact(int fd, void *data, size_t size) {
+  size_t done = 0;
+  while (done < size) {
+    ssize_t result = read(fd, (char *)data + done, size - done);
+    if (result <= 0) {
+      return false;
+    }
+    done += (size_t) result;
+  }
+  return true;
+}
+
+/**
+ * This function sends one request to the engine and reads the reply,
+ * marking every changed cell as known. Returns the status, or -1 if the
+ * engine went away.
+ */
+static int bot_protocol__roundtrip(int to_engine, int from_engine, int op, int x, int y, int arg, bool *known) {
+  unsigned char frame[BOT_PROTOCOL_REQUEST_SIZE] = {
+      (unsigned char) op, 0, (unsigned char) x, (unsigned char) (x >> 8), (unsigned char) y,
+      (unsigned char) (y >> 8), (unsigned char) arg, (unsigned char) (arg >> 8),
+  };
+  unsigned char header[BOT_PROTOCOL_RESPONSE_SIZE];
+  unsigned char entries[4096];
+
+  if (write(to_engine, frame, sizeof(frame)) != (ssize_t) sizeof(frame) ||
+      !bot_protocol__read_exact(from_engine, header, sizeof(header))) {
+    return -1;
+  }
+
+  uint32_t count = header[4] | header[5] << 8 | header[6] << 16 | (uint32_t) header[7] << 24;
+  while (count > 0) {
+    uint32_t chunk = count < sizeof(entries) / 4 ? count : sizeof(entries) / 4;
+    if (!bot_protocol__read_exact(from_engine, entries, chunk * 4)) {
+      return -1;
+    }
+    for (uint32_t i = 0; i < chunk; i++) {
+      uint32_t entry = entries[i * 4] | entries[i * 4 + 1] << 8 | entries[i * 4 + 2] << 16 |
+                       (uint32_t) entries[i * 4 + 3] << 24;
+      known[entry >> 8] = true;
+    }
+    count -= chunk;
+  }
+  return header[0];
+}
+
+/**
+ * This function measures how many moves per second a bot can play
+ * through a pipe. It starts the engine as a child process speaking the
+ * bot protocol and plays random unknown cells on expert boards, one
+ * request in flight at a time. Returns the exit code of the program.
+ *
+ * @param moves the number of moves to play
+ *
+ * @return the exit code
+ */
+int bot_protocol__bench(int moves) {
+  enum { ROWS = 16, COLS = 30, MINES = 99 };
+  int requests[2];
+  int replies[2];
+  bool known[ROWS * COLS];
+  struct Rng rng;
+  struct timespec start;
+  struct timespec end;
+
+  if (pipe(requests) < 0 || pipe(replies) < 0) {
+    perror("pipe");
+    return 1;
+  }
+  pid_t child = fork();
+  if (child == 0) {
+    dup2(requests[0], 0);
+    dup2(replies[1], 1);
+    close(requests[1]);
+    close(replies[0]);
+    exit(bot_protocol__run());
+  }
+  close(requests[0]);
+  close(replies[1]);
+
+  rng__seed(7, &rng);
+  int games = 0;
+  int played = 0;
+  bool in_game = false;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  while (played < moves) {
+    if (!in_game) {
+      memset(known, 0, sizeof(known));
+      if (bot_protocol__roundtrip(requests[1], replies[0], BOT_OP_NEW, ROWS, COLS, MINES, known) < 0) {
+        break;
+      }
+      in_game = true;
+      games++;
+    }
+
+    int cell;
+    do {
+      cell = rng__below(ROWS * COLS, &rng);
+    } while (known[cell]);
+
+    int status = bot_protocol__roundtrip(requests[1], replies[0], BOT_OP_REVEAL, cell / COLS, cell % COLS, 0, known);
+    if (status < 0) {
+      break;
+    }
+    in_game = status == GAME_STATUS_OK;
+    played++;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  close(requests[1]);
+  close(replies[0]);
+  waitpid(child, NULL, 0);
+
+  double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+  printf("Moves: %d in %d games, %.3f s\n", played, games, seconds);
+  printf("Moves/sec: %.0f\n", played / seconds);
+  return played == moves ? 0 : 1;
+}
+
+#else
+
+/**
+ * This function reports that the benchmark is not available on this
+ * platform.
+ *
+ * @param moves unused
+ *
+ * @return the exit code
+ */
+int bot_protocol__bench(int moves) {
+  (void) moves;
+  fprintf(stderr, "The bot benchmark needs fork and is not supported on this platform\n");
+  return 1;
+}
+
+#endif
@@ -0,0 +1,25 @@
+/**
+ * @file bot_protocol.h
+ * @brief The header for bot protocol.
+ */
+#ifndef BOT_PROTOCOL_H
+#define BOT_PROTOCOL_H
+
+#include <stdint.h>
+
+#define BOT_PROTOCOL_REQUEST_SIZE  8
+#define BOT_PROTOCOL_RESPONSE_SIZE 8
+#define BOT_PROTOCOL_MAX_CELLS     (1 << 24)
+
+// request ops
+#define BOT_OP_NEW    'n'
+#define BOT_OP_SEED   's'
+#define BOT_OP_REVEAL 'r'
+#define BOT_OP_FLAG   'f'
+#define BOT_OP_GUESS  'g'
+#define BOT_OP_QUIT   'q'
+
+int bot_protocol__run();
+int bot_protocol__bench(int moves);
+
+#endif // BOT_PROTOCOL_H
@@ -0,0 +1,595 @@
+/**
+ * @file cli.c
+ * @brief Implementation for the terminal game.
+ *
+ * Source code for playing a game in the terminal. This contains the game
+ * loop, the board printing and the win and loss screens.
+ *
+ * Design Philosophy:
+ *
+ * The game and the board only change state and report what happened;
+ * everything the player sees is printed from here, from the statuses the
+ * command processor returns and the events the game pushes. The terminal game is one user of the engine library, just
+ * like the server and the bots.
+ *
+ * @author daoge_cmd
+ * @date June 24, 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cli/cli.h"
+#include "game/command_processor.h"
+#include "game/game_events.h"
+#include "race/race.h"
+#include "user/user.h"
+
+static const char *WIN =
+    "  ___    ___ ________  ___  ___          ___       __   ___  ________      \n"
+    " |\\  \\  /  /|\\   __  \\|\\  \\|\\  \\        |\\  \\     |\\  \\|\\  \\|\\   ___  \\    \n"
+    " \\ \\  \\/  / | \\  \\|\\  \\ \\  \\\\\\  \\       \\ \\  \\    \\ \\  \\ \\  \\ \\  \\\\ \\  \\   \n"
+    "  \\ \\    / / \\ \\  \\\\\\  \\ \\  \\\\\\  \\       \\ \\  \\  __\\ \\  \\ \\  \\ \\  \\\\ \\  \\  \n"
+    "   \\/  /  /   \\ \\  \\\\\\  \\ \\  \\\\\\  \\       \\ \\  \\|__\\_\\  \\ \\  \\ \\  \\\\ \\  \\ \n"
+    " __/  / /      \\ \\_______\\ \\_______\\       \\ \\____________\\ \\__\\ \\__\\\\ \\__\\\n"
+    "|\\___/ /        \\|_______|\\|_______|        \\|____________|\\|__|\\|__| \\|__|\n"
+    "\\|___|/                                                                    \n"
+    "\n"
+    "Score: %f\n";
+
+static const char *LOSS =
+    "__  __               __                  \n"
+    "\\ \\/ /___  __  __   / /   ____  ________ \n"
+    " \\  / __ \\/ / / /  / /   / __ \\/ ___/ _ \\\n"
+    " / / /_/ / /_/ /  / /___/ /_/ (__  )  __/\n"
+    "/_/\\____/\\__,_/  /_____/\\____/____/\\___/ \n"
+    "                                         \n";
+
+/**
+ * This function prints the statistics of a finished game and appends
+ * them to the stats file of the player, if there is one.
+ *
+ * @param game the finished game
+ */
+static void cli__report_stats(struct Game *game) {
+  struct GameStats stats;
+  game__get_stats(game, &stats);
+
+  printf("3BV: %d/%d, 3BV/s: %.2f, Efficiency: %.0f%%\n", stats.bbbv_solved, stats.bbbv,
+         stats.bbbv_per_second, stats.efficiency * 100);
+  printf("Openings used: %d, Wasted flags: %d\n", stats.openings_used, stats.wasted_flags);
+
+  if (game->user != NULL) {
+    user__record_stats(game->user, &stats);
+  }
+}
+
+/**
+ * This function prints the win screen for the game.
+ */
+void cli__print_win(struct Game *game) {
+  // Calculate score based on time taken
+  double score = difftime(game__get_end_time(game), game__get_start_time(game));
+  printf(WIN, score);
+  cli__report_stats(game);
+
+  // Add score to the player's total score
+  if (game->user != NULL) {
+    user__add_score(game->user, (int) score);
+  }
+}
+
+/**
+ * This function prints the loss screen for the game.
+ */
+void cli__print_loss(struct Game *game) {
+  printf("%s", LOSS);
+  cli__report_stats(game);
+}
+
+/**
+ * This function prints the message for a move the game rejected.
+ *
+ * @param status the status the game returned
+ * @param x the x coordinate of the move
+ * @param game the game the move was made on
+ */
+static void cli__print_rejected(enum GameStatus status, int x, struct Game *game) {
+  if (status == GAME_STATUS_OUT_OF_BOUNDS) {
+    if (x < 0 || x >= board__get_x(&game->board)) {
+      printf("\nrow is out of bounds\n"); // TODO: Change when game design is finalized
+    } else {
+      printf("\ncolumn is out of bounds\n"); // TODO: Change when game design is finalized
+    }
+  } else if (status == GAME_STATUS_REVEALED) {
+    printf("\nTile already revealed\n"); // TODO: Change when game design is finalized
+  } else if (status == GAME_STATUS_FLAGGED) {
+    printf("\nTile already flagged\n"); // TODO: Change when game design is finalized
+  }
+}
+
+/**
+ * This function prints the help screen for the user.
+ */
+static void cli__print_help() {
+  printf("Commands:\n");
+  printf("\tr/reveal [row] [col]\tReveal a square\n");
+  printf("\tf/flag [row] [col]\tFlag a square\n");
+  printf("\tg/guess [row] [col]\tGuess a square\n");
+  printf("\th/help        \t\tPrint help\n");
+  printf("\tq/quit        \t\tQuit to menu\n");
+  printf("\tc/close       \t\tQuit the program\n");
+}
+
+/**
+ * This function prompts the user for game input. This function
+ * then passes necessary information to the command processor to
+ * be handled. Prints out invalid command information if command
+ * is invalid. Turns are counted by the game, for accepted moves only.
+ *
+ * @param game the game to process input on
+ */
+void cli__take_input(struct Game *game) {
+  //---VARIABLES---//
+  char rawInput[20];
+
+  char * input;
+  char * xChar;
+  char * yChar;
+  
+  int x;
+  int y;
+
+  // Take in command
+  printf("Enter a command: ");
+  
+  fgets(rawInput, 20, stdin);
+
+  // Parse command
+  input = strtok(rawInput, " ");
+  xChar = strtok(NULL, " ");
+  yChar = strtok(NULL, " ");
+
+  // Checks if input requiring coordinates is in form [input] [x] [y]
+  if ((xChar == NULL || yChar == NULL) &&
+      (strncmp(input, "r", 1) == 0 || strncmp(input, "f", 1) == 0 || strncmp(input, "g", 1) == 0)) {
+    // Makes input invalid
+    input = "x";
+  } else if (strncmp(input, "r", 1) == 0 || strncmp(input, "f", 1) == 0 || strncmp(input, "g", 1) == 0) {
+    // Sets x and y
+    x = atoi(xChar);
+    y = atoi(yChar);
+  }
+
+  // Processes Input by calling correct functions
+  if (strncmp(input, "r", 1) == 0 || strncmp(input, "reveal", 6) == 0) {
+    // revealing a revealed tile is allowed, it just does nothing
+    enum GameStatus status = command_processor__reveal(x, y, game);
+    if (status == GAME_STATUS_OUT_OF_BOUNDS) {
+      cli__print_rejected(status, x, game);
+    }
+  } else if (strncmp(input, "f", 1) == 0 || strncmp(input, "flag", 4) == 0) {
+    cli__print_rejected(command_processor__flag(x, y, game), x, game);
+  } else if (strncmp(input, "h", 1) == 0 || strncmp(input, "help", 4) == 0) {
+    cli__print_help();
+  } else if (strncmp(input, "g", 1) == 0 || strncmp(input, "guess", 5) == 0) {
+    cli__print_rejected(command_processor__guess(x, y, game), x, game);
+  } else if (strncmp(input, "noFog", 5) == 0) {
+    command_processor__no_fog(game);
+  } else if (strncmp(input, "q", 1) == 0 || strncmp(input, "quit", 4) == 0) {
+    command_processor__quit(game);
+  } else if (strncmp(input, "c", 1) == 0 || strncmp(input, "close", 5) == 0) {
+    command_processor__close(game);
+  } else {
+    printf("\nInvalid Command: %s\n", input); // TODO: Change when game design is finalized
+  }
+}
+
+#define CLI_EVENT_CAPACITY 1024 // events kept for the play loop, more than a turn needs unless a reveal opens a lot
+#define CLI_EVENT_BATCH    64   // events read at a time
+
+/**
+ * This function runs the play loop for the passed in game. The loop
+ * reads the game's events after every command and shows the win or loss
+ * screen when one arrives; the board itself is printed whole each turn,
+ * so cell events the ring dropped do not matter.
+ *
+ * @param game the game to be played
+ */
+void cli__play(struct Game *game) {
+  struct GameEvents events;
+  struct GameEventReader reader;
+  struct GameEvent batch[CLI_EVENT_BATCH];
+
+  if (!game_events__create(CLI_EVENT_CAPACITY, &events)) {
+    fprintf(stderr, "Out of memory\n");
+    return;
+  }
+  game__set_events(&events, game);
+  game_events__subscribe(&reader, &events);
+
+  game__set_start_time(game);
+  while (!game__get_end(game)) {
+    printf("\n");
+
+    printf("Turn: %d\n", game->turns);
+    if (board__get_no_fog(&game->board) == true) {
+      cli__print_no_fog(&game->board);
+      board__set_no_fog(false, &game->board);
+    } else {
+      cli__print_board(&game->board);
+    }
+
+    printf("\n");
+
+    cli__take_input(game);
+
+    int count;
+    while ((count = game_events__poll(batch, CLI_EVENT_BATCH, &reader, &events)) > 0) {
+      for (int i = 0; i < count; i++) {
+        if (batch[i].type == GAME_EVENT_WON) {
+          cli__print_win(game);
+        } else if (batch[i].type == GAME_EVENT_LOST) {
+          cli__print_loss(game);
+        }
+      }
+    }
+  }
+
+  game__set_events(NULL, game);
+  game_events__destruct(&events);
+}
+
+//---------------------//
+//   PRINT FUNCTIONS   //
+//---------------------//
+
+/**
+ * This function returns the background color a visible value is printed
+ * with.
+ *
+ * @param c the visible value
+ *
+ * @return the terminal escape sequence of the color
+ */
+static const char *cli__cell_color(char c) {
+  if (c == '0') {
+    return "\033[42m"; // Green
+  } else if (c == '1' || c == '2') {
+    return "\033[43m"; // Yellow
+  } else if (c == '3' || c == '4') {
+    return "\033[48;5;208m"; // Orange
+  } else if (c == '5' || c == '6') {
+    return "\033[45m"; // Purple
+  } else if (c == '7' || c == '8') {
+    return "\033[41m"; // Red
+  } else if (c != '*') {
+    return "\033[0m"; // Black
+  }
+  return "\033[100m"; // Gray
+}
+
+/**
+ * This function takes in a board and prints the board to the screen.
+ *
+ * @param board the board to be printed
+ */
+void cli__print_board(struct Board *board) {
+  for (int i = board__get_x(board) - 1; i >= 0; i--) {
+    if (i >= 10) {
+      printf("%d ", i);
+    } else {
+      printf(" %d ", i);
+    }
+    for (int j = 0; j < board__get_y(board); j++) {
+      char c = board__get_cell(i, j, board);
+      const char *bg = cli__cell_color(c);
+      if (board__get_y(board) > 10) {
+        printf("%s[ %c ]\033[0m", bg, c);
+      } else {
+        printf("%s[%c]\033[0m", bg, c);
+      }
+    }
+    printf("\n");
+  }
+
+  if (board__get_y(board) > 10) {
+    printf("     "); 
+  } else {
+    printf("    "); 
+  }
+  
+  for (int i = 0; i < board__get_y(board); i++) {
+    if (board__get_y(board) > 10) {
+      if (i < 10) {
+        printf("%d    ", i);
+      } else {
+        printf("%d   ", i);
+      }
+    } else {
+      printf("%d  ", i);
+    }
+  }
+}
+
+/**
+ * This function takes in a board and prints the board to the screen
+ * with mines visable to the user.
+ *
+ * @param board the board to print
+ */
+void cli__print_no_fog(struct Board *board) {
+  for (int i = board__get_x(board) - 1; i >= 0; i--) {
+    if (i >= 10) {
+      printf("%d ", i);
+    } else {
+      printf(" %d ", i);
+    }
+    for (int j = 0; j < board__get_y(board); j++) {
+      if (board__get_y(board) > 10) {
+        if (board__contains_mine(i, j, board) == true) {
+          printf("[ @ ]");
+        } else {
+          printf("[ %c ]", board__get_cell(i, j, board));
+        }
+      } else {
+        if (board__contains_mine(i, j, board) == true) {
+          printf("[@]");
+        } else {
+          printf("[%c]", board__get_cell(i, j, board));
+        }
+      }
+    }
+    printf("\n");
+  }
+
+  if (board__get_y(board) > 10) {
+    printf("     "); 
+  } else {
+    printf("    "); 
+  }
+  
+  for (int i = 0; i < board__get_y(board); i++) {
+    if (board__get_y(board) > 10) {
+      if (i < 10) {
+        printf("%d    ", i);
+      } else {
+        printf("%d   ", i);
+      }
+    } else {
+      printf("%d  ", i);
+    }
+  }
+}
+
+//------------------//
+//   ENDLESS GAME   //
+//------------------//
+
+#define CLI_ENDLESS_ROWS 16
+#define CLI_ENDLESS_COLS 30
+
+/**
+ * This function prints the part of an endless board in view, with the
+ * world coordinates of its rows and columns.
+ *
+ * @param top the x coordinate of the top row
+ * @param left the y coordinate of the leftmost column
+ * @param endless the endless board
+ */
+static void cli__print_endless(int64_t top, int64_t left, struct Endless *endless) {
+  for (int64_t i = top; i > top - CLI_ENDLESS_ROWS; i--) {
+    printf("%6lld ", (long long) i);
+    for (int64_t j = left; j < left + CLI_ENDLESS_COLS; j++) {
+      char c = endless__get_cell(i, j, endless);
+      printf("%s[%c]\033[0m", cli__cell_color(c), c);
+    }
+    printf("\n");
+  }
+  printf("       y: %lld .. %lld\n", (long long) left, (long long) (left + CLI_ENDLESS_COLS - 1));
+}
+
+/**
+ * This function plays an endless game in the terminal until a mine is
+ * revealed or the player quits. Besides r, f and g, the command m x y
+ * moves the view so that tile (x, y) is its top left corner. Returns the
+ * exit code of the program.
+ *
+ * @param mines_per_chunk the number of mines in every chunk
+ * @param seed the seed of the endless board
+ *
+ * @return the exit code
+ */
+int cli__play_endless(int mines_per_chunk, uint64_t seed) {
+  struct EndlessConfig config = {mines_per_chunk, seed};
+  struct Endless endless;
+  char input[64];
+  int64_t top = CLI_ENDLESS_ROWS - 1;
+  int64_t left = 0;
+
+  if (!endless__create(&config, &endless)) {
+    fprintf(stderr, "Mines per chunk must be between 0 and %d\n", ENDLESS_CHUNK_CELLS - 1);
+    return 1;
+  }
+
+  printf("Endless board, %d mines per %dx%d chunk, seed %llu\n", mines_per_chunk, ENDLESS_CHUNK_SIZE,
+         ENDLESS_CHUNK_SIZE, (unsigned long long) seed);
+  printf("Commands: r/f/g x y, m x y to move the view, q to quit\n");
+
+  while (!endless__get_end(&endless)) {
+    printf("\nTurn: %lld, Revealed: %lld, Chunks: %d\n", (long long) endless__get_turns(&endless),
+           (long long) endless__get_num_revealed(&endless), endless__get_num_chunks(&endless));
+    cli__print_endless(top, left, &endless);
+    printf("Enter a command: ");
+    if (fgets(input, sizeof(input), stdin) == NULL) {
+      break;
+    }
+
+    char command;
+    long long x;
+    long long y;
+    int fields = sscanf(input, " %c %lld %lld", &command, &x, &y);
+    if (fields >= 1 && command == 'q') {
+      break;
+    }
+    if (fields != 3) {
+      printf("\nInvalid Command: %s", input);
+      continue;
+    }
+
+    if (command == 'm') {
+      top = x;
+      left = y;
+      continue;
+    }
+    enum GameStatus status = endless__apply(command, x, y, &endless);
+    if (status == GAME_STATUS_LOSS) {
+      printf("\n%s", LOSS);
+    } else if (status == GAME_STATUS_REVEALED) {
+      printf("\nThat tile is already revealed\n");
+    } else if (status == GAME_STATUS_FLAGGED) {
+      printf("\nThat tile is already flagged\n");
+    } else if (status == GAME_STATUS_INVALID) {
+      printf("\nInvalid Command: %s", input);
+    } else if (status == GAME_STATUS_NO_MEMORY) {
+      printf("\nOut of memory, the move could not be made in full\n");
+    }
+  }
+
+  printf("Revealed %lld tiles in %lld turns\n", (long long) endless__get_num_revealed(&endless),
+         (long long) endless__get_turns(&endless));
+  endless__destruct(&endless);
+  return 0;
+}
+
+//----------//
+//   RACE   //
+//----------//
+
+#define CLI_RACE_BOT_MS 300 // time the bots take for a move when racing someone at the terminal
+
+/**
+ * This function plays the terminal player of a race until their game
+ * ends. The no fog command does nothing in a race.
+ *
+ * @param player the index of the terminal player
+ * @param race the started race
+ */
+static void cli__play_race(int player, struct Race *race) {
+  struct Game *game = &race->players[player].game;
+
+  while (!game__get_end(game)) {
+    printf("\nTurn: %d\n", game->turns);
+    cli__print_board(&game->board);
+    printf("\n");
+    cli__take_input(game);
+    board__set_no_fog(false, &game->board);
+    if (feof(stdin)) {
+      race__forfeit(player, race);
+    }
+    race__stamp(player, race);
+  }
+  cli__print_no_fog(&game->board);
+}
+
+/**
+ * This function prints the ranking of a finished race.
+ *
+ * @param order the ranking, from race__rank
+ * @param race the finished race
+ */
+static void cli__print_ranking(const int *order, struct Race *race) {
+  printf("\nRank  Player            Result  Seconds       3BV/s      3BV  Moves  ms/move\n");
+  for (int rank = 0; rank < race->num_players; rank++) {
+    struct RacePlayer *player = &race->players[order[rank]];
+    double ms_per_move = player->num_stamps > 0 ? player->finish / 1e6 / player->num_stamps : 0;
+    printf("%4d  %-16s  %-6s  %7.3f  %10.2f  %3d/%-3d  %5d  %7.3f\n", rank + 1, player->name,
+           player->stats.won ? "won" : "lost", player->stats.seconds, player->stats.bbbv_per_second,
+           player->stats.bbbv_solved, player->stats.bbbv, player->num_stamps, ms_per_move);
+  }
+}
+
+/**
+ * This function runs a race on one seeded board. Players named solver
+ * and guesser are bots, guessing at random and with the Monte Carlo
+ * guesser; any other name is a user playing at the terminal, at most one.
+ * Every player's result is credited to the user of their name. Returns
+ * the exit code of the program.
+ *
+ * @param players the names of the players, separated by commas
+ * @param width the width of the board
+ * @param height the height of the board
+ * @param mines the number of mines
+ * @param seed the seed of the board
+ * @param bot_ms the time the bots take for a move, or -1 for none unless
+ *               someone plays at the terminal
+ *
+ * @return the exit code
+ */
+int cli__race(char *players, int width, int height, int mines, uint64_t seed, int bot_ms) {
+  const char *names[RACE_MAX_PLAYERS];
+  struct RaceBot bots[RACE_MAX_PLAYERS];
+  Thread threads[RACE_MAX_PLAYERS];
+  bool running[RACE_MAX_PLAYERS] = {false};
+  int order[RACE_MAX_PLAYERS];
+  int num_players = 0;
+  int human = -1;
+  struct Race race;
+
+  for (char *name = strtok(players, ","); name != NULL; name = strtok(NULL, ",")) {
+    bool bot = strcmp(name, "solver") == 0 || strcmp(name, "guesser") == 0;
+    if (num_players == RACE_MAX_PLAYERS || (!bot && human >= 0)) {
+      fprintf(stderr, "A race has at most %d players, one of them at the terminal\n", RACE_MAX_PLAYERS);
+      return 1;
+    }
+    human = bot ? human : num_players;
+    names[num_players++] = name;
+  }
+  if (num_players < 2 || width < 2 || height < 2 || mines < 1 || mines >= width * height - 9) {
+    fprintf(stderr, "A race needs 2 players and a board with room for its mines and an opening\n");
+    return 1;
+  }
+  if (bot_ms < 0) {
+    bot_ms = human >= 0 ? CLI_RACE_BOT_MS : 0;
+  }
+
+  user__load();
+  if (!race__create(width, height, mines, seed, num_players, &race)) {
+    fprintf(stderr, "Out of memory\n");
+    return 1;
+  }
+  for (int i = 0; i < num_players; i++) {
+    race__set_player(i, names[i], user__get_user(names[i]), &race);
+    if (i == human) {
+      continue;
+    }
+    bots[i] = (struct RaceBot) {&race, i, strcmp(names[i], "guesser") == 0, bot_ms, seed + 1 + i};
+    running[i] = thread__create(race__bot, &bots[i], &threads[i]);
+    if (!running[i]) {
+      race__forfeit(i, &race);
+    }
+  }
+
+  printf("Race of %d players on %dx%d with %d mines, seed %llu\n", num_players, width, height, mines,
+         (unsigned long long) seed);
+  race__start(&race);
+  if (human >= 0) {
+    cli__play_race(human, &race);
+    printf("\nWaiting for the others to finish...\n");
+  }
+  race__wait_finish(&race);
+  for (int i = 0; i < num_players; i++) {
+    if (running[i]) {
+      thread__join(&threads[i]);
+    }
+  }
+
+  race__rank(order, &race);
+  race__award(order, &race);
+  cli__print_ranking(order, &race);
+  user__save();
+  race__destruct(&race);
+  return 0;
+}
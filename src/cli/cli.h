@@ -0,0 +1,28 @@
+/**
+ * @file cli.h
+ * @brief The header for cli.
+ */
+#ifndef CLI_H
+#define CLI_H
+
+#include <stdint.h>
+
+#include "endless/endless.h"
+#include "game/game.h"
+
+void cli__print_win(struct Game* game);
+void cli__print_loss(struct Game* game);
+void cli__take_input(struct Game* game);
+void cli__play(struct Game* game);
+
+// print functions
+void cli__print_board(struct Board* board);
+void cli__print_no_fog(struct Board* board);
+
+// endless game
+int  cli__play_endless(int mines_per_chunk, uint64_t seed);
+
+// race
+int  cli__race(char* players, int width, int height, int mines, uint64_t seed, int bot_ms);
+
+#endif // CLI_H
@@ -0,0 +1,391 @@
+/**
+ * @file coop.c
+ * @brief Implementation for boards played by many players at once.
+ *
+ * A cooperative board is one seeded board that several players, or a
+ * swarm of bots on their own threads, reveal and flag at the same time.
+ * The game is won when every safe tile is revealed, by whoever reveals
+ * the last one, and lost when anyone reveals a mine.
+ *
+ * Design Philosophy:
+ *
+ * Where the mines are, the counts and the openings are worked out once,
+ * by a struct Game that makes the first reveal before play starts, and
+ * are only read after that. What changes during play is one packed
+ * 32 bit word per cell: the visible value, whether it is revealed, and
+ * the player who changed it last. Every move is a compare-and-swap of
+ * that word from the state the player saw, so no move takes a lock, two
+ * players reveal or flag the same tile exactly once between them, and a
+ * reader always sees a value together with the player who set it.
+ *
+ * Revealing a zero tile reveals its opening from the precomputed tile
+ * list, as board__reveal does. The first player to reach an opening
+ * takes it on with an atomic exchange of its flag and walks the list;
+ * anyone reaching it later leaves it to them. The borders of two
+ * openings, and tiles clicked one by one, are settled by the swap of
+ * each word, so two cascades meeting never reveal a tile twice.
+ *
+ * Winning and losing are each decided by one atomic. Whoever reveals
+ * safe tiles takes them off the count of hidden ones in one subtraction,
+ * and the player who takes it to zero has won; a mine ends the game the
+ * same way. Only the first end swaps the state, so a board that is both
+ * completed and blown up at once ends one way for everyone. The game's
+ * own rule, every mine flagged and no flag wasted, needs two counters
+ * to agree at the same instant, so a cooperative board is won by its
+ * safe tiles instead.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#include "coop/coop.h"
+
+/**
+ * This function packs a cell word.
+ *
+ * @param value the visible value
+ * @param revealed whether the tile is revealed
+ * @param player the player who changed it
+ *
+ * @return the word
+ */
+static uint32_t coop__pack(char value, bool revealed, int player) {
+  return (uint32_t) (unsigned char) value | (revealed ? COOP_REVEALED : 0) | (uint32_t) player << COOP_PLAYER_SHIFT;
+}
+
+//------------------------------//
+//   CONSTRUCTOR / DESTRUCTOR   //
+//------------------------------//
+
+/**
+ * This function builds a cooperative board on a seeded square board,
+ * with the opening in the middle already revealed so that nobody's
+ * first click moves the mines under the others.
+ *
+ * @param width the width of the board
+ * @param height the height of the board
+ * @param mines the number of mines
+ * @param seed the seed of the board
+ * @param coop the board to build
+ *
+ * @return true if built; false if out of memory
+ */
+bool coop__create(int width, int height, int mines, uint64_t seed, struct Coop *coop) {
+  return coop__create_allocator(width, height, mines, seed, &ALLOC_SYSTEM, coop);
+}
+
+/**
+ * This function builds a cooperative board, like coop__create, whose
+ * board and cell words come from the given allocator. The cell words
+ * are counted in the coop's alloc_stats, the grids in the board's.
+ *
+ * @param width the width of the board
+ * @param height the height of the board
+ * @param mines the number of mines
+ * @param seed the seed of the board
+ * @param allocator where the memory comes from, copied
+ * @param coop the board to build
+ *
+ * @return true if built; false if out of memory
+ */
+bool coop__create_allocator(int width, int height, int mines, uint64_t seed, const struct Allocator *allocator,
+                            struct Coop *coop) {
+  if (!game__build_game_allocator(width, height, mines, seed, allocator, &coop->game)) {
+    return false;
+  }
+
+  struct Board *board = &coop->game.board;
+  game__set_first_click(GAME_FIRST_CLICK_OPENING, &coop->game);
+  game__apply('r', board__get_x(board) / 2, board__get_y(board) / 2, &coop->game);
+
+  int num_openings = board__get_num_openings(board);
+  coop->allocator = *allocator;
+  coop->alloc_stats = (struct AllocStats) {0};
+  coop->num_opened = num_openings > 0 ? num_openings : 1;
+  coop->cells = (_Atomic(uint32_t) *)alloc__allocate(board->board_cells * sizeof(_Atomic(uint32_t)),
+                                                     &coop->allocator, &coop->alloc_stats);
+  coop->opened = (atomic_uchar *)alloc__allocate(coop->num_opened * sizeof(atomic_uchar), &coop->allocator,
+                                                 &coop->alloc_stats);
+  if (coop->cells == NULL || coop->opened == NULL) {
+    coop__destruct(coop);
+    return false;
+  }
+
+  // the guard ring counts as revealed, so the walks over openings skip it
+  for (int i = 0; i < board->board_cells; i++) {
+    atomic_init(&coop->cells[i], coop__pack(board->board_pointer[i], board->reveal_pointer[i], 0));
+  }
+  for (int i = 0; i < num_openings; i++) {
+    atomic_init(&coop->opened[i], board->reveal_pointer[board->opening_cells[board->opening_start[i]]]);
+  }
+  int hidden = board__get_x(board) * board__get_y(board) - mines - board__get_num_revealed(board);
+  atomic_init(&coop->hidden, hidden);
+  atomic_init(&coop->state, hidden == 0 ? COOP_WON : COOP_PLAYING);
+  atomic_init(&coop->flags, 0);
+  atomic_init(&coop->wasted_flags, 0);
+  return true;
+}
+
+/**
+ * This function frees the board. Nobody may be playing it anymore. With
+ * MINESWEEPER_ALLOC_DEBUG defined, memory still held afterwards is
+ * reported as a leak.
+ *
+ * @param coop the board to be freed
+ */
+void coop__destruct(struct Coop *coop) {
+  alloc__release(coop->cells, coop->game.board.board_cells * sizeof(_Atomic(uint32_t)), &coop->allocator,
+                 &coop->alloc_stats);
+  alloc__release(coop->opened, coop->num_opened * sizeof(atomic_uchar), &coop->allocator, &coop->alloc_stats);
+  alloc__check_leaks("coop", &coop->alloc_stats);
+  coop->cells = NULL;
+  coop->opened = NULL;
+  board__destruct(&coop->game.board);
+}
+
+//-----------//
+//   MOVES   //
+//-----------//
+
+/**
+ * This function takes a flag off the counts, for a flagged tile another
+ * move has just changed.
+ *
+ * @param index the grid index of the tile
+ * @param coop the board
+ */
+static void coop__unflag(int index, struct Coop *coop) {
+  if (coop->game.board.mine_pointer[index]) {
+    atomic_fetch_sub_explicit(&coop->flags, 1, memory_order_relaxed);
+  } else {
+    atomic_fetch_sub_explicit(&coop->wasted_flags, 1, memory_order_relaxed);
+  }
+}
+
+/**
+ * This function reveals a tile unless someone has already, by swapping
+ * its word from whatever hidden state it is in. A flag on it is taken
+ * off.
+ *
+ * @param index the grid index of the tile
+ * @param player the player revealing
+ * @param coop the board
+ *
+ * @return true if this call revealed it; false if it was revealed
+ */
+static bool coop__claim(int index, int player, struct Coop *coop) {
+  uint32_t revealed = coop__pack((char) ('0' + coop->game.board.count_pointer[index]), true, player);
+  uint32_t word = atomic_load_explicit(&coop->cells[index], memory_order_relaxed);
+
+  do {
+    if (word & COOP_REVEALED) {
+      return false;
+    }
+  } while (!atomic_compare_exchange_weak_explicit(&coop->cells[index], &word, revealed, memory_order_acq_rel,
+                                                  memory_order_relaxed));
+  if ((word & COOP_VALUE_MASK) == 'F') {
+    coop__unflag(index, coop);
+  }
+  return true;
+}
+
+/**
+ * This function ends the game, if nobody ended it first.
+ *
+ * @param state COOP_WON or COOP_LOST
+ * @param coop the board
+ *
+ * @return true if this call ended it
+ */
+static bool coop__end(enum CoopState state, struct Coop *coop) {
+  int playing = COOP_PLAYING;
+  return atomic_compare_exchange_strong_explicit(&coop->state, &playing, state, memory_order_acq_rel,
+                                                 memory_order_acquire);
+}
+
+/**
+ * This function reveals a tile. A zero tile reveals its opening too,
+ * unless another player has taken the opening on already. Safe tiles
+ * revealed here come off the hidden count at once, and the move that
+ * takes it to zero wins.
+ *
+ * @param index the grid index of the tile
+ * @param player the player revealing
+ * @param coop the board
+ *
+ * @return the status of the move
+ */
+static enum GameStatus coop__reveal(int index, int player, struct Coop *coop) {
+  struct Board *board = &coop->game.board;
+
+  if (board->mine_pointer[index]) {
+    if (!coop__end(COOP_LOST, coop)) {
+      return GAME_STATUS_ENDED;
+    }
+    atomic_store_explicit(&coop->cells[index], coop__pack('*', true, player), memory_order_release);
+    return GAME_STATUS_LOSS;
+  }
+
+  int opening = board->opening_pointer[index];
+  int revealed = 0;
+  if (opening < 0) {
+    if (!coop__claim(index, player, coop)) {
+      return GAME_STATUS_REVEALED;
+    }
+    revealed = 1;
+  } else if (!atomic_exchange_explicit(&coop->opened[opening], 1, memory_order_acq_rel)) {
+    for (int i = board->opening_start[opening]; i < board->opening_start[opening + 1]; i++) {
+      int cell = board->opening_cells[i];
+      revealed += coop__claim(cell, player, coop);
+      for (int k = 0; k < BOARD_NUM_NEIGHBORS; k++) {
+        revealed += coop__claim(board__neighbor(cell, k, board), player, coop);
+      }
+    }
+  }
+
+  if (revealed > 0 && atomic_fetch_sub_explicit(&coop->hidden, revealed, memory_order_acq_rel) == revealed &&
+      coop__end(COOP_WON, coop)) {
+    return GAME_STATUS_WIN;
+  }
+  return GAME_STATUS_OK;
+}
+
+/**
+ * This function flags or guesses a hidden tile, by swapping its word
+ * from the hidden state the player saw.
+ *
+ * @param index the grid index of the tile
+ * @param value F or ?
+ * @param player the player marking
+ * @param coop the board
+ *
+ * @return the status of the move
+ */
+static enum GameStatus coop__mark(int index, char value, int player, struct Coop *coop) {
+  uint32_t marked = coop__pack(value, false, player);
+  uint32_t word = atomic_load_explicit(&coop->cells[index], memory_order_relaxed);
+
+  do {
+    if (word & COOP_REVEALED) {
+      return GAME_STATUS_REVEALED;
+    }
+    if (value == 'F' && (word & COOP_VALUE_MASK) == 'F') {
+      return GAME_STATUS_FLAGGED;
+    }
+  } while (!atomic_compare_exchange_weak_explicit(&coop->cells[index], &word, marked, memory_order_acq_rel,
+                                                  memory_order_relaxed));
+
+  if ((word & COOP_VALUE_MASK) == 'F') {
+    coop__unflag(index, coop);
+  }
+  if (value == 'F') {
+    atomic_fetch_add_explicit(coop->game.board.mine_pointer[index] ? &coop->flags : &coop->wasted_flags, 1,
+                              memory_order_relaxed);
+  }
+  return GAME_STATUS_OK;
+}
+
+/**
+ * This function applies a reveal (r), flag (f) or guess (g) of a player
+ * to the board, and returns what happened, like game__apply. Any thread
+ * may call it at any time. Moves once the game has ended are rejected,
+ * but a move already under way when another player ends it finishes.
+ *
+ * @param command the command character, one of r, f or g
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param player the player, 0 to COOP_MAX_PLAYERS
+ * @param coop the board
+ *
+ * @return the status of the move
+ */
+enum GameStatus coop__apply(char command, int x, int y, int player, struct Coop *coop) {
+  struct Board *board = &coop->game.board;
+
+  if (atomic_load_explicit(&coop->state, memory_order_acquire) != COOP_PLAYING) {
+    return GAME_STATUS_ENDED;
+  }
+  if (command != 'r' && command != 'f' && command != 'g') {
+    return GAME_STATUS_INVALID;
+  }
+  if (!board__in_bounds(x, y, board)) {
+    return GAME_STATUS_OUT_OF_BOUNDS;
+  }
+
+  int index = board__index(x, y, board);
+  if (atomic_load_explicit(&coop->cells[index], memory_order_relaxed) & COOP_REVEALED) {
+    return GAME_STATUS_REVEALED;
+  }
+  if (command == 'r') {
+    return coop__reveal(index, player, coop);
+  }
+  return coop__mark(index, command == 'f' ? 'F' : '?', player, coop);
+}
+
+//-------------//
+//   GETTERS   //
+//-------------//
+
+/**
+ * This function returns the visible value of a tile, as on a board.
+ *
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param coop the board
+ *
+ * @return the value
+ */
+char coop__get_cell(int x, int y, struct Coop *coop) {
+  uint32_t word = atomic_load_explicit(&coop->cells[board__index(x, y, &coop->game.board)], memory_order_relaxed);
+  return (char) (word & COOP_VALUE_MASK);
+}
+
+/**
+ * This function returns the player who changed a tile last.
+ *
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param coop the board
+ *
+ * @return the player, 0 for tiles nobody changed
+ */
+int coop__get_player(int x, int y, struct Coop *coop) {
+  uint32_t word = atomic_load_explicit(&coop->cells[board__index(x, y, &coop->game.board)], memory_order_relaxed);
+  return (int) (word >> COOP_PLAYER_SHIFT);
+}
+
+/**
+ * This function returns whether a tile is revealed.
+ *
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param coop the board
+ *
+ * @return true if revealed
+ */
+bool coop__is_revealed(int x, int y, struct Coop *coop) {
+  uint32_t word = atomic_load_explicit(&coop->cells[board__index(x, y, &coop->game.board)], memory_order_relaxed);
+  return (word & COOP_REVEALED) != 0;
+}
+
+/**
+ * This function returns whether the game is on, won or lost.
+ *
+ * @param coop the board
+ *
+ * @return the state
+ */
+enum CoopState coop__get_state(struct Coop *coop) {
+  return (enum CoopState) atomic_load_explicit(&coop->state, memory_order_acquire);
+}
+
+/**
+ * This function returns the number of safe tiles not revealed yet.
+ *
+ * @param coop the board
+ *
+ * @return the number of hidden safe tiles
+ */
+int coop__get_hidden(struct Coop *coop) {
+  return atomic_load_explicit(&coop->hidden, memory_order_relaxed);
+}
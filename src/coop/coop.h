@@ -0,0 +1,53 @@
+/**
+ * @file coop.h
+ * @brief The header for coop.
+ */
+#ifndef COOP_H
+#define COOP_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "game/game.h"
+
+// a cell word packs the visible value, whether it is revealed and who changed it last
+#define COOP_VALUE_MASK    0xFFu
+#define COOP_REVEALED      0x100u
+#define COOP_PLAYER_SHIFT  16
+#define COOP_MAX_PLAYERS   0xFFFF
+
+enum CoopState {
+    COOP_PLAYING,
+    COOP_WON,
+    COOP_LOST,
+};
+
+// one board played by many players at once, from any threads
+struct Coop {
+    struct Game        game;       // the mines, counts and openings; never written once play starts
+    _Atomic(uint32_t)* cells;      // the packed word of each cell, by grid index
+    atomic_uchar*      opened;     // whether someone took on revealing each opening
+    int                num_opened; // entries of opened, at least one
+    atomic_int         hidden;     // safe tiles not revealed yet
+    atomic_int         state;      // enum CoopState
+    atomic_int         flags;      // flags placed on mines
+    atomic_int         wasted_flags;
+    struct Allocator   allocator;  // where cells and opened came from
+    struct AllocStats  alloc_stats;
+};
+
+bool            coop__create(int width, int height, int mines, uint64_t seed, struct Coop* coop);
+bool            coop__create_allocator(int width, int height, int mines, uint64_t seed,
+                                       const struct Allocator* allocator, struct Coop* coop);
+void            coop__destruct(struct Coop* coop);
+enum GameStatus coop__apply(char command, int x, int y, int player, struct Coop* coop);
+
+// getters
+char            coop__get_cell(int x, int y, struct Coop* coop);
+int             coop__get_player(int x, int y, struct Coop* coop);
+bool            coop__is_revealed(int x, int y, struct Coop* coop);
+enum CoopState  coop__get_state(struct Coop* coop);
+int             coop__get_hidden(struct Coop* coop);
+
+#endif // COOP_H
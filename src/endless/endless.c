@@ -0,0 +1,569 @@
+/**
+ * @file endless.c
+ * @brief Implementation for the endless board.
+ *
+ * An endless board has no edges. It is an unbounded set of square chunks
+ * of tiles, and only the chunks a game has touched exist in memory.
+ *
+ * Design Philosophy:
+ *
+ * A struct Board sizes its grids up front, so it cannot grow. Here the
+ * tiles live in chunks of ENDLESS_CHUNK_SIZE by ENDLESS_CHUNK_SIZE, kept
+ * in a hash map keyed by the chunk coordinates. A chunk is made the first
+ * time anything looks at one of its tiles, and its mines are placed from
+ * a seed mixed from the game seed and the chunk coordinates. So a chunk
+ * has the same mines whenever and in whatever order it is reached, and
+ * the whole endless board is fixed by its seed.
+ *
+ * Reveals flood fill across chunk edges like on a normal board, looking
+ * tiles up through the map; the chunk of the last lookup is remembered,
+ * since most lookups land in the same chunk. At low densities an opening
+ * can go on forever, so one reveal uncovers at most ENDLESS_MAX_REVEAL
+ * tiles and leaves the rest of the opening for later clicks.
+ *
+ * Running out of memory is reported as GAME_STATUS_NO_MEMORY. A tile is
+ * only revealed once every chunk around it exists, so its number is
+ * never short of a mine; a flood fill that runs out stops there, with
+ * the tiles it revealed so far showing the right numbers.
+ *
+ * The map, the chunks and the work list all come from the allocator the
+ * board was created with and are counted in its alloc_stats, so a long
+ * game shows how much of the plane it holds.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#include <string.h>
+
+#include "endless/endless.h"
+
+#define ENDLESS_INITIAL_CAPACITY 64
+
+static const int ENDLESS_DX[8] = {-1, -1, -1, 0, 0, 1, 1, 1};
+static const int ENDLESS_DY[8] = {-1, 0, 1, -1, 1, -1, 0, 1};
+
+//------------------//
+//   CHUNK LOOKUP   //
+//------------------//
+
+/**
+ * This function returns the chunk coordinate of a tile coordinate,
+ * rounding down for negative coordinates too.
+ *
+ * @param value the tile coordinate
+ *
+ * @return the chunk coordinate
+ */
+static int64_t endless__chunk_of(int64_t value) {
+  return value >= 0 ? value / ENDLESS_CHUNK_SIZE : -((-value + ENDLESS_CHUNK_SIZE - 1) / ENDLESS_CHUNK_SIZE);
+}
+
+/**
+ * This function hashes chunk coordinates. The hash also seeds the mines
+ * of the chunk, mixed with the game seed.
+ *
+ * @param cx the chunk x coordinate
+ * @param cy the chunk y coordinate
+ *
+ * @return the hash
+ */
+static uint64_t endless__hash(int64_t cx, int64_t cy) {
+  return rng__mix((uint64_t) cx * 0x9E3779B97F4A7C15ull ^ (uint64_t) cy);
+}
+
+/**
+ * This function looks up a chunk without making it.
+ *
+ * @param cx the chunk x coordinate
+ * @param cy the chunk y coordinate
+ * @param endless the endless board
+ *
+ * @return the chunk, or NULL if it was never touched
+ */
+static struct EndlessChunk *endless__find(int64_t cx, int64_t cy, struct Endless *endless) {
+  if (endless->last != NULL && endless->last->cx == cx && endless->last->cy == cy) {
+    return endless->last;
+  }
+
+  int mask = endless->capacity - 1;
+  for (int slot = (int) (endless__hash(cx, cy) & mask);; slot = (slot + 1) & mask) {
+    struct EndlessChunk *chunk = endless->chunks[slot];
+    if (chunk == NULL) {
+      return NULL;
+    }
+    if (chunk->cx == cx && chunk->cy == cy) {
+      endless->last = chunk;
+      return chunk;
+    }
+  }
+}
+
+/**
+ * This function allocates from the allocator of an endless board.
+ *
+ * @param size the size of the block in bytes
+ * @param endless the endless board
+ *
+ * @return the block, or NULL
+ */
+static void *endless__allocate(size_t size, struct Endless *endless) {
+  return alloc__allocate(size, &endless->allocator, &endless->alloc_stats);
+}
+
+/**
+ * This function gives a block back to the allocator of an endless board.
+ *
+ * @param pointer the block, or NULL
+ * @param size the size the block was allocated with
+ * @param endless the endless board
+ */
+static void endless__release(void *pointer, size_t size, struct Endless *endless) {
+  alloc__release(pointer, size, &endless->allocator, &endless->alloc_stats);
+}
+
+/**
+ * This function allocates an empty map.
+ *
+ * @param capacity the number of slots
+ * @param endless the endless board
+ *
+ * @return the slots, all NULL, or NULL if out of memory
+ */
+static struct EndlessChunk **endless__allocate_map(int capacity, struct Endless *endless) {
+  struct EndlessChunk **chunks = (struct EndlessChunk **)endless__allocate(capacity * sizeof(struct EndlessChunk *),
+                                                                           endless);
+  if (chunks != NULL) {
+    memset(chunks, 0, capacity * sizeof(struct EndlessChunk *));
+  }
+  return chunks;
+}
+
+/**
+ * This function puts a chunk into a map with a free slot for it.
+ *
+ * @param chunk the chunk to insert
+ * @param chunks the slots of the map
+ * @param capacity the number of slots, a power of two
+ */
+static void endless__insert(struct EndlessChunk *chunk, struct EndlessChunk **chunks, int capacity) {
+  int slot = (int) (endless__hash(chunk->cx, chunk->cy) & (capacity - 1));
+  while (chunks[slot] != NULL) {
+    slot = (slot + 1) & (capacity - 1);
+  }
+  chunks[slot] = chunk;
+}
+
+/**
+ * This function doubles the map. Returns false if out of memory.
+ *
+ * @param endless the endless board
+ *
+ * @return true if grown; false otherwise
+ */
+static bool endless__grow(struct Endless *endless) {
+  int capacity = endless->capacity * 2;
+  struct EndlessChunk **chunks = endless__allocate_map(capacity, endless);
+  if (chunks == NULL) {
+    return false;
+  }
+
+  for (int i = 0; i < endless->capacity; i++) {
+    if (endless->chunks[i] != NULL) {
+      endless__insert(endless->chunks[i], chunks, capacity);
+    }
+  }
+  endless__release(endless->chunks, endless->capacity * sizeof(struct EndlessChunk *), endless);
+  endless->chunks = chunks;
+  endless->capacity = capacity;
+  return true;
+}
+
+/**
+ * This function looks up a chunk and makes it on first touch, with its
+ * mines placed from the seed of the chunk.
+ *
+ * @param cx the chunk x coordinate
+ * @param cy the chunk y coordinate
+ * @param endless the endless board
+ *
+ * @return the chunk, or NULL if out of memory
+ */
+static struct EndlessChunk *endless__touch(int64_t cx, int64_t cy, struct Endless *endless) {
+  struct EndlessChunk *chunk = endless__find(cx, cy, endless);
+  if (chunk != NULL) {
+    return chunk;
+  }
+
+  // keep the map at most half full
+  if (2 * (endless->num_chunks + 1) > endless->capacity && !endless__grow(endless)) {
+    return NULL;
+  }
+  chunk = (struct EndlessChunk *)endless__allocate(sizeof(struct EndlessChunk), endless);
+  if (chunk == NULL) {
+    return NULL;
+  }
+
+  chunk->cx = cx;
+  chunk->cy = cy;
+  for (int i = 0; i < ENDLESS_CHUNK_CELLS; i++) {
+    chunk->mines[i] = false;
+    chunk->cells[i] = '*';
+  }
+
+  struct Rng rng;
+  rng__seed(rng__mix(endless->seed ^ endless__hash(cx, cy)), &rng);
+  for (int i = 0; i < endless->mines_per_chunk; i++) {
+    int cell;
+    do {
+      cell = rng__below(ENDLESS_CHUNK_CELLS, &rng);
+    } while (chunk->mines[cell]);
+    chunk->mines[cell] = true;
+  }
+
+  endless__insert(chunk, endless->chunks, endless->capacity);
+  endless->num_chunks++;
+  endless->last = chunk;
+  return chunk;
+}
+
+/**
+ * This function finds the chunk of a tile, making it if needed, and the
+ * index of the tile within it.
+ *
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param index receives the index of the tile in its chunk
+ * @param endless the endless board
+ *
+ * @return the chunk, or NULL if out of memory
+ */
+static struct EndlessChunk *endless__locate(int64_t x, int64_t y, int *index, struct Endless *endless) {
+  int64_t cx = endless__chunk_of(x);
+  int64_t cy = endless__chunk_of(y);
+
+  *index = (int) ((x - cx * ENDLESS_CHUNK_SIZE) * ENDLESS_CHUNK_SIZE + (y - cy * ENDLESS_CHUNK_SIZE));
+  return endless__touch(cx, cy, endless);
+}
+
+//------------------------------//
+//   CONSTRUCTOR / DESTRUCTOR   //
+//------------------------------//
+
+/**
+ * This function starts an endless game. No chunk exists until a tile is
+ * looked at. Returns false if the configuration is invalid or out of
+ * memory.
+ *
+ * @param config the mines per chunk and the seed
+ * @param endless the endless board to be built
+ *
+ * @return true if built; false otherwise
+ */
+bool endless__create(const struct EndlessConfig *config, struct Endless *endless) {
+  return endless__create_allocator(config, &ALLOC_SYSTEM, endless);
+}
+
+/**
+ * This function starts an endless game, like endless__create, whose map,
+ * chunks and work list come from the given allocator.
+ *
+ * @param config the mines per chunk and the seed
+ * @param allocator where the memory comes from, copied
+ * @param endless the endless board to be built
+ *
+ * @return true if built; false otherwise
+ */
+bool endless__create_allocator(const struct EndlessConfig *config, const struct Allocator *allocator,
+                               struct Endless *endless) {
+  if (config->mines_per_chunk < 0 || config->mines_per_chunk >= ENDLESS_CHUNK_CELLS) {
+    return false;
+  }
+
+  endless->allocator = *allocator;
+  endless->alloc_stats = (struct AllocStats) {0};
+  endless->capacity = ENDLESS_INITIAL_CAPACITY;
+  endless->chunks = endless__allocate_map(endless->capacity, endless);
+  endless->stack_capacity = 2 * ENDLESS_CHUNK_CELLS;
+  endless->stack = (int64_t *)endless__allocate(endless->stack_capacity * sizeof(int64_t), endless);
+  if (endless->chunks == NULL || endless->stack == NULL) {
+    endless__release(endless->chunks, endless->capacity * sizeof(struct EndlessChunk *), endless);
+    endless__release(endless->stack, endless->stack_capacity * sizeof(int64_t), endless);
+    return false;
+  }
+
+  endless->num_chunks = 0;
+  endless->last = NULL;
+  endless->mines_per_chunk = config->mines_per_chunk;
+  endless->seed = config->seed;
+  endless->end = false;
+  endless->turns = 0;
+  endless->num_revealed = 0;
+  return true;
+}
+
+/**
+ * This function frees every chunk of an endless game. With
+ * MINESWEEPER_ALLOC_DEBUG defined, memory still held afterwards is
+ * reported as a leak.
+ *
+ * @param endless the endless board to be freed
+ */
+void endless__destruct(struct Endless *endless) {
+  for (int i = 0; i < endless->capacity; i++) {
+    endless__release(endless->chunks[i], sizeof(struct EndlessChunk), endless);
+  }
+  endless__release(endless->chunks, endless->capacity * sizeof(struct EndlessChunk *), endless);
+  endless__release(endless->stack, endless->stack_capacity * sizeof(int64_t), endless);
+  alloc__check_leaks("endless", &endless->alloc_stats);
+
+  endless->chunks = NULL;
+  endless->stack = NULL;
+  endless->capacity = 0;
+  endless->num_chunks = 0;
+  endless->last = NULL;
+}
+
+//-------------//
+//   REVEALS   //
+//-------------//
+
+/**
+ * This function returns whether a visible value is a revealed number.
+ *
+ * @param cell the visible value
+ *
+ * @return true if revealed; false otherwise
+ */
+static bool endless__is_revealed(char cell) {
+  return cell >= '0' && cell <= '8';
+}
+
+/**
+ * This function reveals one tile that is not revealed yet and returns
+ * its number of adjacent mines. Counting may make the chunks around it;
+ * if one cannot be made, the tile is left as it was.
+ *
+ * @param chunk the chunk of the tile
+ * @param index the index of the tile in its chunk
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param endless the endless board
+ *
+ * @return the number of adjacent mines, or -1 if out of memory
+ */
+static int endless__reveal_tile(struct EndlessChunk *chunk, int index, int64_t x, int64_t y,
+                                struct Endless *endless) {
+  int count = 0;
+
+  for (int k = 0; k < 8; k++) {
+    int neighbor_index;
+    struct EndlessChunk *neighbor = endless__locate(x + ENDLESS_DX[k], y + ENDLESS_DY[k], &neighbor_index, endless);
+    if (neighbor == NULL) {
+      return -1;
+    }
+    count += neighbor->mines[neighbor_index];
+  }
+
+  chunk->cells[index] = (char) ('0' + count);
+  endless->num_revealed++;
+  return count;
+}
+
+/**
+ * This function pushes a tile on the flood fill work list, growing it
+ * when full. Returns false if out of memory.
+ *
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param top the number of entries on the list
+ * @param endless the endless board
+ *
+ * @return true if pushed; false otherwise
+ */
+static bool endless__push(int64_t x, int64_t y, int64_t *top, struct Endless *endless) {
+  if (*top + 2 > endless->stack_capacity) {
+    int64_t *stack = (int64_t *)endless__allocate(2 * endless->stack_capacity * sizeof(int64_t), endless);
+    if (stack == NULL) {
+      return false;
+    }
+    memcpy(stack, endless->stack, *top * sizeof(int64_t));
+    endless__release(endless->stack, endless->stack_capacity * sizeof(int64_t), endless);
+    endless->stack = stack;
+    endless->stack_capacity *= 2;
+  }
+
+  endless->stack[(*top)++] = x;
+  endless->stack[(*top)++] = y;
+  return true;
+}
+
+/**
+ * This function reveals a safe tile and, if it has no adjacent mines,
+ * flood fills the opening around it across chunk edges, until the
+ * opening ends or ENDLESS_MAX_REVEAL tiles are uncovered. Out of memory
+ * the fill stops where it is; if the tile itself could not be revealed,
+ * nothing changed.
+ *
+ * @param chunk the chunk of the tile
+ * @param index the index of the tile in its chunk
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param endless the endless board
+ *
+ * @return true if revealed; false if out of memory
+ */
+static bool endless__reveal(struct EndlessChunk *chunk, int index, int64_t x, int64_t y, struct Endless *endless) {
+  int64_t top = 0;
+  int64_t budget = ENDLESS_MAX_REVEAL - 1;
+
+  int count = endless__reveal_tile(chunk, index, x, y, endless);
+  if (count < 0 || (count == 0 && !endless__push(x, y, &top, endless))) {
+    return false;
+  }
+
+  // every tile is pushed at most once, right after it is revealed
+  while (top > 0 && budget > 0) {
+    int64_t current_y = endless->stack[--top];
+    int64_t current_x = endless->stack[--top];
+    for (int k = 0; k < 8 && budget > 0; k++) {
+      int64_t nx = current_x + ENDLESS_DX[k];
+      int64_t ny = current_y + ENDLESS_DY[k];
+      int neighbor_index;
+      struct EndlessChunk *neighbor = endless__locate(nx, ny, &neighbor_index, endless);
+      if (neighbor == NULL) {
+        return false;
+      }
+      if (endless__is_revealed(neighbor->cells[neighbor_index])) {
+        continue;
+      }
+      budget--;
+      count = endless__reveal_tile(neighbor, neighbor_index, nx, ny, endless);
+      if (count < 0 || (count == 0 && !endless__push(nx, ny, &top, endless))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * This function applies a reveal (r), flag (f) or guess (g) to the
+ * endless game and returns what happened, with the same rules as
+ * game__apply except that there is no win: the game goes on until a mine
+ * is revealed. Rejected moves do not count a turn. Out of memory the
+ * move returns GAME_STATUS_NO_MEMORY, and counts a turn only if its
+ * reveal uncovered tiles before running out.
+ *
+ * @param command the command character, one of r, f or g
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param endless the endless board
+ *
+ * @return the status of the move
+ */
+enum GameStatus endless__apply(char command, int64_t x, int64_t y, struct Endless *endless) {
+  if (endless->end) {
+    return GAME_STATUS_ENDED;
+  }
+  if (command != 'r' && command != 'f' && command != 'g') {
+    return GAME_STATUS_INVALID;
+  }
+
+  int index;
+  struct EndlessChunk *chunk = endless__locate(x, y, &index, endless);
+  if (chunk == NULL) {
+    return GAME_STATUS_NO_MEMORY;
+  }
+  if (endless__is_revealed(chunk->cells[index])) {
+    return GAME_STATUS_REVEALED;
+  }
+  if (command == 'f' && chunk->cells[index] == 'F') {
+    return GAME_STATUS_FLAGGED;
+  }
+
+  endless->turns++;
+  if (command == 'r') {
+    if (chunk->mines[index]) {
+      endless->end = true;
+      return GAME_STATUS_LOSS;
+    }
+    int64_t revealed = endless->num_revealed;
+    if (!endless__reveal(chunk, index, x, y, endless)) {
+      endless->turns -= endless->num_revealed == revealed;
+      return GAME_STATUS_NO_MEMORY;
+    }
+  } else {
+    chunk->cells[index] = command == 'f' ? 'F' : '?';
+  }
+  return GAME_STATUS_OK;
+}
+
+//-------------//
+//   GETTERS   //
+//-------------//
+
+/**
+ * This function returns the visible value of a tile. Tiles of chunks
+ * never touched are hidden, and looking at them does not make the chunk.
+ *
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param endless the endless board
+ *
+ * @return the visible value
+ */
+char endless__get_cell(int64_t x, int64_t y, struct Endless *endless) {
+  int64_t cx = endless__chunk_of(x);
+  int64_t cy = endless__chunk_of(y);
+  struct EndlessChunk *chunk = endless__find(cx, cy, endless);
+
+  if (chunk == NULL) {
+    return '*';
+  }
+  return chunk->cells[(x - cx * ENDLESS_CHUNK_SIZE) * ENDLESS_CHUNK_SIZE + (y - cy * ENDLESS_CHUNK_SIZE)];
+}
+
+/**
+ * This function returns whether the endless game has ended.
+ *
+ * @param endless the endless board
+ *
+ * @return true if a mine was revealed; false otherwise
+ */
+bool endless__get_end(struct Endless *endless) {
+  return endless->end;
+}
+
+/**
+ * This function returns the number of accepted moves.
+ *
+ * @param endless the endless board
+ *
+ * @return the number of turns
+ */
+int64_t endless__get_turns(struct Endless *endless) {
+  return endless->turns;
+}
+
+/**
+ * This function returns the number of revealed tiles.
+ *
+ * @param endless the endless board
+ *
+ * @return the number of revealed tiles
+ */
+int64_t endless__get_num_revealed(struct Endless *endless) {
+  return endless->num_revealed;
+}
+
+/**
+ * This function returns the number of chunks in memory.
+ *
+ * @param endless the endless board
+ *
+ * @return the number of chunks
+ */
+int endless__get_num_chunks(struct Endless *endless) {
+  return endless->num_chunks;
+}
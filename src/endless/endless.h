@@ -0,0 +1,60 @@
+/**
+ * @file endless.h
+ * @brief The header for endless.
+ */
+#ifndef ENDLESS_H
+#define ENDLESS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "alloc/alloc.h"
+#include "game/game.h"
+#include "rng/rng.h"
+
+#define ENDLESS_CHUNK_SIZE  32 // tiles per chunk side
+#define ENDLESS_CHUNK_CELLS (ENDLESS_CHUNK_SIZE * ENDLESS_CHUNK_SIZE)
+#define ENDLESS_MAX_REVEAL  (1 << 20) // tiles a single reveal may uncover
+
+struct EndlessConfig {
+    int      mines_per_chunk;
+    uint64_t seed;
+};
+
+struct EndlessChunk {
+    int64_t cx;                        // chunk coordinates, tile (x, y) is in chunk
+    int64_t cy;                        // (floor(x / size), floor(y / size))
+    bool    mines[ENDLESS_CHUNK_CELLS];
+    char    cells[ENDLESS_CHUNK_CELLS]; // visible values, as on a board
+};
+
+struct Endless {
+    struct EndlessChunk** chunks;     // hash map by chunk coordinates, open addressing
+    int                   capacity;   // a power of two
+    int                   num_chunks;
+    struct EndlessChunk*  last;       // chunk of the last lookup
+    int                   mines_per_chunk;
+    uint64_t              seed;
+    bool                  end;
+    int64_t               turns;
+    int64_t               num_revealed;
+    int64_t*              stack;      // flood fill work list, x and y of each tile
+    int64_t               stack_capacity;
+    struct Allocator      allocator;  // where the map, chunks and work list came from
+    struct AllocStats     alloc_stats;
+};
+
+bool endless__create(const struct EndlessConfig* config, struct Endless* endless);
+bool endless__create_allocator(const struct EndlessConfig* config, const struct Allocator* allocator,
+                               struct Endless* endless);
+void endless__destruct(struct Endless* endless);
+enum GameStatus endless__apply(char command, int64_t x, int64_t y, struct Endless* endless);
+
+// getters
+char    endless__get_cell(int64_t x, int64_t y, struct Endless* endless);
+bool    endless__get_end(struct Endless* endless);
+int64_t endless__get_turns(struct Endless* endless);
+int64_t endless__get_num_revealed(struct Endless* endless);
+int     endless__get_num_chunks(struct Endless* endless);
+
+#endif // ENDLESS_H
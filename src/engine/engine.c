@@ -0,0 +1,367 @@
+/**
+ * @file engine.c
+ * @brief Implementation for the public engine API.
+ *
+ * Source code for the stable C API of the library. Every function here
+ * is a thin wrapper over a struct Game.
+ *
+ * Design Philosophy:
+ *
+ * The engine hides struct Game behind an opaque pointer and reports
+ * moves as status codes and events. The events of a move are read from
+ * the board's change journal, which the engine clears before every move,
+ * plus one closing event when the move won or lost the game. Polling
+ * drains them; they stay available until the next move or reset.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "engine/engine.h"
+#include "game/game.h"
+
+struct Engine {
+    struct Game game;
+    struct Allocator allocator;    // where the engine itself came from
+    struct AllocStats alloc_stats; // of the engine itself; the board counts its grids
+    int         next_event;    // next journal entry to poll
+    bool        ending_queued; // the closing event has not been polled yet
+    int         ending_type;
+    int         ending_x;
+    int         ending_y;
+};
+
+static_assert((int) ENGINE_STATUS_INVALID == (int) GAME_STATUS_INVALID, "engine and game statuses must match");
+
+/**
+ * This function checks an engine configuration.
+ *
+ * @param config the size, mine count and seed of the game
+ *
+ * @return true if valid; false otherwise
+ */
+static bool engine__valid_config(const struct EngineConfig *config) {
+  return config->rows >= 2 && config->cols >= 2 && config->mines >= 1 &&
+         (int64_t) config->rows * config->cols <= 1 << 28 && config->mines < config->rows * config->cols;
+}
+
+/**
+ * This function returns the version of the API the library implements.
+ *
+ * @return ENGINE_API_VERSION of the library
+ */
+int engine__api_version(void) {
+  return ENGINE_API_VERSION;
+}
+
+/**
+ * This function builds an engine with a new game. Returns NULL if the
+ * configuration is invalid or out of memory.
+ *
+ * @param config the size, mine count and seed of the game
+ *
+ * @return the engine, or NULL
+ */
+struct Engine *engine__create(const struct EngineConfig *config) {
+  struct EngineAllocator allocator = {ALLOC_SYSTEM.allocate, ALLOC_SYSTEM.release, ALLOC_SYSTEM.context};
+  return engine__create_with_allocator(config, &allocator);
+}
+
+/**
+ * This function builds an engine whose memory, its game's included,
+ * comes from the given allocator. Once built, resets and moves allocate
+ * nothing, so an allocator over a block of engine__memory_size bytes
+ * runs a game without calling malloc. Returns NULL if the configuration
+ * is invalid or the allocator is out of memory.
+ *
+ * @param config the size, mine count and seed of the game
+ * @param allocator where the memory comes from, copied
+ *
+ * @return the engine, or NULL
+ */
+struct Engine *engine__create_with_allocator(const struct EngineConfig *config,
+                                             const struct EngineAllocator *allocator) {
+  struct Allocator hooks = {allocator->allocate, allocator->release, allocator->context};
+  struct AllocStats stats = {0};
+
+  if (!engine__valid_config(config)) {
+    return NULL;
+  }
+
+  struct Engine *engine = (struct Engine *)alloc__allocate(sizeof(struct Engine), &hooks, &stats);
+  if (engine == NULL) {
+    return NULL;
+  }
+  memset(engine, 0, sizeof(struct Engine));
+  engine->allocator = hooks;
+  engine->alloc_stats = stats;
+  if (!game__build_game_allocator(config->cols, config->rows, config->mines, config->seed, &hooks, &engine->game)) {
+    alloc__release(engine, sizeof(struct Engine), &hooks, &stats);
+    return NULL;
+  }
+  return engine;
+}
+
+/**
+ * This function returns how much memory an engine takes, as an arena
+ * with ALLOC_ALIGNMENT rounds it, or 0 if the configuration is invalid.
+ *
+ * @param config the size, mine count and seed of the game
+ *
+ * @return the size in bytes
+ */
+size_t engine__memory_size(const struct EngineConfig *config) {
+  if (!engine__valid_config(config)) {
+    return 0;
+  }
+  return alloc__round(sizeof(struct Engine)) + board__memory_size(config->cols, config->rows);
+}
+
+/**
+ * This function frees an engine and its game.
+ *
+ * @param engine the engine to be freed
+ */
+void engine__destroy(struct Engine *engine) {
+  if (engine == NULL) {
+    return;
+  }
+  struct Allocator allocator = engine->allocator;
+  struct AllocStats stats = engine->alloc_stats;
+
+  board__destruct(&engine->game.board);
+  alloc__release(engine, sizeof(struct Engine), &allocator, &stats);
+  alloc__check_leaks("engine", &stats);
+}
+
+/**
+ * This function starts a new game of the same size and mine count.
+ *
+ * @param seed the seed of the new game
+ * @param engine the engine
+ *
+ * @return ENGINE_STATUS_OK
+ */
+enum EngineStatus engine__reset(uint64_t seed, struct Engine *engine) {
+  game__reset_game(game__get_flags(&engine->game), seed, &engine->game);
+  engine->next_event = 0;
+  engine->ending_queued = false;
+  return ENGINE_STATUS_OK;
+}
+
+/**
+ * This function applies a move and queues its events.
+ *
+ * @param action reveal, flag or guess
+ * @param x the row of the cell
+ * @param y the column of the cell
+ * @param engine the engine
+ *
+ * @return the status of the move
+ */
+enum EngineStatus engine__act(enum EngineAction action, int x, int y, struct Engine *engine) {
+  board__clear_changes(&engine->game.board);
+  engine->next_event = 0;
+  engine->ending_queued = false;
+
+  enum GameStatus status = game__apply((char) action, x, y, &engine->game);
+  if (status == GAME_STATUS_WIN || status == GAME_STATUS_LOSS) {
+    engine->ending_queued = true;
+    engine->ending_type = status == GAME_STATUS_WIN ? ENGINE_EVENT_WON : ENGINE_EVENT_LOST;
+    engine->ending_x = x;
+    engine->ending_y = y;
+  }
+  return (enum EngineStatus) status;
+}
+
+/**
+ * This function copies up to max_events queued events of the last move
+ * and removes them from the queue. Cell events come first, in the order
+ * the cells changed, then the closing event if any.
+ *
+ * @param events where to copy the events
+ * @param max_events the room in events
+ * @param engine the engine
+ *
+ * @return the number of events copied
+ */
+int engine__poll_events(struct EngineEvent *events, int max_events, struct Engine *engine) {
+  struct Board *board = &engine->game.board;
+  int count = 0;
+
+  while (count < max_events && engine->next_event < board__get_num_changes(board)) {
+    int cell = board->changed_cells[engine->next_event++];
+    events[count].type = ENGINE_EVENT_CELL;
+    events[count].x = board__index_x(cell, board);
+    events[count].y = board__index_y(cell, board);
+    events[count].value = board->board_pointer[cell];
+    count++;
+  }
+  if (count < max_events && engine->ending_queued) {
+    events[count].type = engine->ending_type;
+    events[count].x = engine->ending_x;
+    events[count].y = engine->ending_y;
+    events[count].value = 0;
+    engine->ending_queued = false;
+    count++;
+  }
+  return count;
+}
+
+//-------------//
+//   GETTERS   //
+//-------------//
+
+/**
+ * This function returns the number of rows of the board.
+ *
+ * @param engine the engine
+ *
+ * @return the number of rows
+ */
+int engine__get_rows(const struct Engine *engine) {
+  return engine->game.board.board_x;
+}
+
+/**
+ * This function returns the number of columns of the board.
+ *
+ * @param engine the engine
+ *
+ * @return the number of columns
+ */
+int engine__get_cols(const struct Engine *engine) {
+  return engine->game.board.board_y;
+}
+
+/**
+ * This function returns the number of mines on the board.
+ *
+ * @param engine the engine
+ *
+ * @return the number of mines
+ */
+int engine__get_mines(const struct Engine *engine) {
+  return engine->game.flags_needed;
+}
+
+/**
+ * This function returns the number of accepted moves so far.
+ *
+ * @param engine the engine
+ *
+ * @return the number of turns
+ */
+int engine__get_turns(const struct Engine *engine) {
+  return engine->game.turns;
+}
+
+/**
+ * This function returns whether the game was won, lost or quit.
+ *
+ * @param engine the engine
+ *
+ * @return true if the game is over; false otherwise
+ */
+bool engine__is_over(const struct Engine *engine) {
+  return engine->game.end;
+}
+
+/**
+ * This function returns the visible value of a cell: '0' to '8', '*'
+ * for hidden, 'F' for flagged or '?' for guessed. Returns 0 if the cell
+ * is out of bounds.
+ *
+ * @param x the row of the cell
+ * @param y the column of the cell
+ * @param engine the engine
+ *
+ * @return the visible value
+ */
+char engine__get_cell(int x, int y, const struct Engine *engine) {
+  struct Board *board = (struct Board *)&engine->game.board;
+
+  if (!board__in_bounds(x, y, board)) {
+    return 0;
+  }
+  return board__get_cell(x, y, board);
+}
+
+/**
+ * This function copies the visible board row by row into out. Returns
+ * the number of bytes needed, rows * cols; nothing is copied if size is
+ * smaller than that.
+ *
+ * @param out where to copy the board
+ * @param size the room in out
+ * @param engine the engine
+ *
+ * @return rows * cols
+ */
+int engine__copy_board(char *out, int size, const struct Engine *engine) {
+  int rows = engine__get_rows(engine);
+  int cols = engine__get_cols(engine);
+
+  if (size >= rows * cols) {
+    for (int i = 0; i < rows; i++) {
+      memcpy(out + i * cols, engine->game.board.board_pointer + board__index(i, 0, &engine->game.board), cols);
+    }
+  }
+  return rows * cols;
+}
+
+/**
+ * This function fills in a view of the visible board, pointing into the
+ * engine: nothing is copied, and the view shows every later move as it
+ * happens. Visible values are those of engine__get_cell.
+ *
+ * @param view the view to fill in
+ * @param engine the engine
+ */
+void engine__get_view(struct EngineView *view, const struct Engine *engine) {
+  struct BoardView board;
+
+  board__get_view(&board, &engine->game.board);
+  view->cells = board.cells;
+  view->rows = board.rows;
+  view->cols = board.cols;
+  view->stride = board.stride;
+  view->generation = board.generation;
+}
+
+/**
+ * This function lists the cells changed since a generation of the view,
+ * as offsets into its cells, see board__get_changes_since. Returns -1
+ * once the changes are no longer kept, after a reset or more changes
+ * than the board has cells; the caller then reads the whole view again.
+ *
+ * @param generation the generation the caller last saw
+ * @param offsets where to list the cells, x * stride + y
+ * @param max_offsets the room in offsets
+ * @param engine the engine
+ *
+ * @return the number of cells listed, or -1
+ */
+int engine__get_changes_since(uint64_t generation, int32_t *offsets, int max_offsets, const struct Engine *engine) {
+  static_assert(sizeof(int32_t) == sizeof(int), "offsets are listed as int");
+
+  return board__get_changes_since(generation, (int *)offsets, max_offsets, &engine->game.board);
+}
+
+/**
+ * This function reports what the game of an engine holds and has held.
+ *
+ * @param stats the counters to fill in
+ * @param engine the engine
+ */
+void engine__get_alloc_stats(struct EngineAllocStats *stats, const struct Engine *engine) {
+  const struct AllocStats *board = &engine->game.board.board_alloc_stats;
+
+  stats->bytes = board->bytes;
+  stats->peak_bytes = board->peak_bytes;
+  stats->allocations = (uint64_t) board->allocations;
+  stats->releases = (uint64_t) board->releases;
+}
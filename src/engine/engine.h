@@ -0,0 +1,124 @@
+/**
+ * @file engine.h
+ * @brief The public header of the minesweeper library.
+ *
+ * This is the stable C API of libminesweeper. It does no I/O: every call
+ * returns a status code, and what a move changed is read back as events.
+ * The engine struct is opaque, so programs built against this header
+ * keep working when the library changes its internals.
+ */
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define ENGINE_API_VERSION 3 // 2 added allocator hooks, 3 read-only board views
+
+#if defined(MINESWEEPER_SHARED) && defined(_WIN32)
+#if defined(MINESWEEPER_BUILDING)
+#define ENGINE_API __declspec(dllexport)
+#else
+#define ENGINE_API __declspec(dllimport)
+#endif
+#elif defined(MINESWEEPER_SHARED)
+#define ENGINE_API __attribute__((visibility("default")))
+#else
+#define ENGINE_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum EngineStatus {
+    ENGINE_STATUS_OK            = 0,
+    ENGINE_STATUS_WIN           = 1,
+    ENGINE_STATUS_LOSS          = 2,
+    ENGINE_STATUS_OUT_OF_BOUNDS = 3,
+    ENGINE_STATUS_REVEALED      = 4,
+    ENGINE_STATUS_FLAGGED       = 5,
+    ENGINE_STATUS_ENDED         = 6,
+    ENGINE_STATUS_INVALID       = 7,
+};
+
+enum EngineAction {
+    ENGINE_ACTION_REVEAL = 'r',
+    ENGINE_ACTION_FLAG   = 'f',
+    ENGINE_ACTION_GUESS  = 'g',
+};
+
+enum EngineEventType {
+    ENGINE_EVENT_CELL = 0, // a cell changed its visible value
+    ENGINE_EVENT_WON  = 1,
+    ENGINE_EVENT_LOST = 2, // x and y are the mine that was hit
+};
+
+struct EngineEvent {
+    int32_t type;  // enum EngineEventType
+    int32_t x;
+    int32_t y;
+    int32_t value; // the new visible character of a cell event
+};
+
+struct EngineConfig {
+    int32_t  rows;
+    int32_t  cols;
+    int32_t  mines;
+    uint64_t seed;
+};
+
+// where an engine gets its memory from; the library calls nothing else to allocate
+struct EngineAllocator {
+    void* (*allocate)(size_t size, void* context);               // NULL when out of memory
+    void  (*release)(void* pointer, size_t size, void* context); // size as allocated
+    void*  context;
+};
+
+// what the game of an engine holds, counted as it is allocated
+struct EngineAllocStats {
+    uint64_t bytes;
+    uint64_t peak_bytes;
+    uint64_t allocations;
+    uint64_t releases;
+};
+
+// the visible board of an engine, read in place; valid until the engine is destroyed
+struct EngineView {
+    const char* cells;      // the visible value of (x, y) is cells[x * stride + y]
+    int32_t     rows;
+    int32_t     cols;
+    int32_t     stride;
+    uint64_t    generation; // of the board when the view was taken
+};
+
+struct Engine;
+
+ENGINE_API int               engine__api_version(void);
+ENGINE_API struct Engine*    engine__create(const struct EngineConfig* config);
+ENGINE_API struct Engine*    engine__create_with_allocator(const struct EngineConfig* config,
+                                                           const struct EngineAllocator* allocator);
+ENGINE_API size_t            engine__memory_size(const struct EngineConfig* config);
+ENGINE_API void              engine__destroy(struct Engine* engine);
+ENGINE_API enum EngineStatus engine__reset(uint64_t seed, struct Engine* engine);
+ENGINE_API enum EngineStatus engine__act(enum EngineAction action, int x, int y, struct Engine* engine);
+ENGINE_API int               engine__poll_events(struct EngineEvent* events, int max_events, struct Engine* engine);
+
+ENGINE_API int  engine__get_rows(const struct Engine* engine);
+ENGINE_API int  engine__get_cols(const struct Engine* engine);
+ENGINE_API int  engine__get_mines(const struct Engine* engine);
+ENGINE_API int  engine__get_turns(const struct Engine* engine);
+ENGINE_API bool engine__is_over(const struct Engine* engine);
+ENGINE_API char engine__get_cell(int x, int y, const struct Engine* engine);
+ENGINE_API int  engine__copy_board(char* out, int size, const struct Engine* engine);
+ENGINE_API void engine__get_view(struct EngineView* view, const struct Engine* engine);
+ENGINE_API int  engine__get_changes_since(uint64_t generation, int32_t* offsets, int max_offsets,
+                                          const struct Engine* engine);
+ENGINE_API void engine__get_alloc_stats(struct EngineAllocStats* stats, const struct Engine* engine);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ENGINE_H
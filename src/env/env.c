@@ -0,0 +1,297 @@
+/**
+ * @file env.c
+ * @brief Implementation for the reinforcement learning environment.
+ *
+ * The environment steps a batch of games in one call for training agents
+ * in process. It is built on the same struct Game and game__apply as the
+ * terminal game.
+ *
+ * Design Philosophy:
+ *
+ * An action is a number per game: a in [0, cells) reveals cell a and
+ * a in [cells, 2 * cells) flags cell a - cells, where cells are numbered
+ * x * cols + y. After every step each game writes its whole visible board
+ * into the caller's observation tensor, one byte per cell (0 to 8 for
+ * numbers, ENV_CELL_* otherwise), laid out [env][row][col].
+ *
+ * A revealing step is rewarded with the fraction of safe cells it opened.
+ * Revealing every safe cell, or winning by flags, gives ENV_REWARD_WIN;
+ * hitting a mine gives ENV_REWARD_LOSS; moves the game rejects give
+ * ENV_REWARD_INVALID. A finished game sets its done flag and is reset
+ * right away with the next seed, so the observation of a done game is
+ * already the first one of its next episode.
+ *
+ * Every allocation happens in env__create: games are reset in place and
+ * the thread pool is started once. The boards of all games are built
+ * from one arena, one block instead of nine allocations per game. The
+ * games, the episode counts and that block come from ALLOC_SYSTEM and
+ * are counted in the env's alloc_stats. Boards are seeded from the
+ * config seed, the env number and the episode number, so results do not
+ * depend on the number of threads.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#include <string.h>
+
+#include "env/env.h"
+#include "rng/rng.h"
+
+#define ENV_TASKS_PER_THREAD 4
+
+static const uint8_t ENV_CELL_VALUES[256] = {
+    ['0'] = 0,
+    ['1'] = 1,
+    ['2'] = 2,
+    ['3'] = 3,
+    ['4'] = 4,
+    ['5'] = 5,
+    ['6'] = 6,
+    ['7'] = 7,
+    ['8'] = 8,
+    ['*'] = ENV_CELL_HIDDEN,
+    ['F'] = ENV_CELL_FLAG,
+    ['?'] = ENV_CELL_GUESS,
+};
+
+/**
+ * This function returns the seed of an episode of an env.
+ *
+ * @param index the number of the env
+ * @param episode the number of the episode
+ * @param env the environment
+ *
+ * @return the seed
+ */
+static uint64_t env__seed(int index, uint64_t episode, struct Env *env) {
+  return rng__mix(env->config.seed ^ rng__mix(((uint64_t) index << 40) + episode));
+}
+
+/**
+ * This function writes the visible board of a game into its slice of
+ * the observation tensor.
+ *
+ * @param game the game to observe
+ * @param out the first byte of the game's observation
+ */
+static void env__observe(struct Game *game, uint8_t *out) {
+  struct Board *board = &game->board;
+  int cols = board__get_y(board);
+
+  for (int i = 0; i < board__get_x(board); i++) {
+    const char *row = board->board_pointer + board__index(i, 0, board);
+    for (int j = 0; j < cols; j++) {
+      out[j] = ENV_CELL_VALUES[(unsigned char) row[j]];
+    }
+    out += cols;
+  }
+}
+
+/**
+ * This function starts the next episode of one env.
+ *
+ * @param index the number of the env
+ * @param env the environment
+ */
+static void env__reset_one(int index, struct Env *env) {
+  game__reset_game(env->config.mines, env__seed(index, env->episodes[index]++, env), &env->games[index]);
+}
+
+/**
+ * This function steps one env with its action and fills in its reward,
+ * done flag and observation.
+ *
+ * @param index the number of the env
+ * @param env the environment, holding the arguments of the step
+ */
+static void env__step_one(int index, struct Env *env) {
+  struct Game *game = &env->games[index];
+  int cells = env->config.rows * env->config.cols;
+  int safe = cells - env->config.mines;
+  int32_t action = env->actions[index];
+  float reward;
+  bool done = false;
+
+  if (action < 0 || action >= 2 * cells) {
+    reward = ENV_REWARD_INVALID;
+  } else {
+    int cell = action % cells;
+    int revealed = board__get_num_revealed(&game->board);
+    char command = action < cells ? 'r' : 'f';
+
+    switch (game__apply(command, cell / env->config.cols, cell % env->config.cols, game)) {
+    case GAME_STATUS_OK:
+      reward = (float) (board__get_num_revealed(&game->board) - revealed) / (float) safe;
+      if (board__get_num_revealed(&game->board) == safe) {
+        reward += ENV_REWARD_WIN;
+        done = true;
+      }
+      break;
+    case GAME_STATUS_WIN:
+      reward = ENV_REWARD_WIN;
+      done = true;
+      break;
+    case GAME_STATUS_LOSS:
+      reward = ENV_REWARD_LOSS;
+      done = true;
+      break;
+    default:
+      reward = ENV_REWARD_INVALID;
+      break;
+    }
+  }
+
+  if (done) {
+    env__reset_one(index, env);
+  }
+  env->rewards[index] = reward;
+  env->dones[index] = done;
+  env__observe(game, env->observations + (size_t) index * cells);
+}
+
+/**
+ * This function is the thread pool task of a step: it steps one
+ * contiguous range of envs.
+ *
+ * @param context the environment
+ * @param task the number of the range
+ */
+static void env__step_task(void *context, int task) {
+  struct Env *env = (struct Env *)context;
+  int start = (int) ((long long) env->num_envs * task / env->num_tasks);
+  int end = (int) ((long long) env->num_envs * (task + 1) / env->num_tasks);
+
+  for (int i = start; i < end; i++) {
+    env__step_one(i, env);
+  }
+}
+
+/**
+ * This function gives the games, the episode counts and the block of
+ * the boards back to ALLOC_SYSTEM. With MINESWEEPER_ALLOC_DEBUG defined,
+ * memory still held afterwards is reported as a leak.
+ *
+ * @param env the environment
+ */
+static void env__release(struct Env *env) {
+  alloc__release(env->games, env->num_envs * sizeof(struct Game), &ALLOC_SYSTEM, &env->alloc_stats);
+  alloc__release(env->episodes, env->num_envs * sizeof(uint64_t), &ALLOC_SYSTEM, &env->alloc_stats);
+  alloc__release(env->memory, env->memory_size, &ALLOC_SYSTEM, &env->alloc_stats);
+  alloc__check_leaks("env", &env->alloc_stats);
+  env->games = NULL;
+  env->episodes = NULL;
+  env->memory = NULL;
+}
+
+/**
+ * This function builds a batch of games with the same configuration and
+ * starts the worker threads. Returns false if the configuration is
+ * invalid or out of memory.
+ *
+ * @param num_envs the number of games in the batch
+ * @param config the configuration of every game
+ * @param env the environment to be built
+ *
+ * @return true if built; false otherwise
+ */
+bool env__create(int num_envs, const struct EnvConfig *config, struct Env *env) {
+  if (num_envs < 1 || config->rows < 2 || config->cols < 2 || config->mines < 1 ||
+      config->mines >= config->rows * config->cols || config->threads < 0) {
+    return false;
+  }
+
+  env->num_envs = num_envs;
+  env->config = *config;
+  env->alloc_stats = (struct AllocStats) {0};
+  env->memory_size = num_envs * board__memory_size(config->cols, config->rows) + ALLOC_ALIGNMENT;
+  env->games = (struct Game *)alloc__allocate(num_envs * sizeof(struct Game), &ALLOC_SYSTEM, &env->alloc_stats);
+  env->episodes = (uint64_t *)alloc__allocate(num_envs * sizeof(uint64_t), &ALLOC_SYSTEM, &env->alloc_stats);
+  env->memory = alloc__allocate(env->memory_size, &ALLOC_SYSTEM, &env->alloc_stats);
+  if (env->games == NULL || env->episodes == NULL || env->memory == NULL ||
+      !thread_pool__create(config->threads, &env->pool)) {
+    env__release(env);
+    return false;
+  }
+  memset(env->games, 0, num_envs * sizeof(struct Game));
+  memset(env->episodes, 0, num_envs * sizeof(uint64_t));
+  arena__init(env->memory, env->memory_size, &env->arena);
+
+  env->num_tasks = (config->threads + 1) * ENV_TASKS_PER_THREAD;
+  if (env->num_tasks > num_envs) {
+    env->num_tasks = num_envs;
+  }
+
+  struct Allocator allocator = arena__allocator(&env->arena);
+  for (int i = 0; i < num_envs; i++) {
+    if (!game__build_game_allocator(config->cols, config->rows, config->mines, env__seed(i, 0, env), &allocator,
+                                    &env->games[i])) {
+      thread_pool__destruct(&env->pool);
+      for (int j = 0; j < i; j++) {
+        board__destruct(&env->games[j].board);
+      }
+      env__release(env);
+      return false;
+    }
+    game__set_first_click(config->first_click, &env->games[i]);
+  }
+  return true;
+}
+
+/**
+ * This function stops the worker threads and frees every game.
+ *
+ * @param env the environment to be freed
+ */
+void env__destruct(struct Env *env) {
+  thread_pool__destruct(&env->pool);
+  for (int i = 0; i < env->num_envs; i++) {
+    board__destruct(&env->games[i].board);
+  }
+  env__release(env);
+}
+
+/**
+ * This function starts a new episode in every env and writes the first
+ * observations.
+ *
+ * @param observations the tensor of num_envs * rows * cols bytes to fill
+ * @param env the environment
+ */
+void env__reset(uint8_t *observations, struct Env *env) {
+  int cells = env->config.rows * env->config.cols;
+
+  for (int i = 0; i < env->num_envs; i++) {
+    env__reset_one(i, env);
+    env__observe(&env->games[i], observations + (size_t) i * cells);
+  }
+}
+
+/**
+ * This function applies one action to every env of the batch, on the
+ * worker threads if there are any.
+ *
+ * @param actions num_envs actions
+ * @param observations the tensor of num_envs * rows * cols bytes to fill
+ * @param rewards num_envs rewards to fill
+ * @param dones num_envs done flags to fill
+ * @param env the environment
+ */
+void env__step(const int32_t *actions, uint8_t *observations, float *rewards, uint8_t *dones, struct Env *env) {
+  env->actions = actions;
+  env->observations = observations;
+  env->rewards = rewards;
+  env->dones = dones;
+  thread_pool__run(env->num_tasks, env__step_task, env, &env->pool);
+}
+
+/**
+ * This function returns the number of distinct actions of one env.
+ *
+ * @param env the environment
+ *
+ * @return the number of actions
+ */
+int env__num_actions(struct Env *env) {
+  return 2 * env->config.rows * env->config.cols;
+}
@@ -0,0 +1,57 @@
+/**
+ * @file env.h
+ * @brief The header for env.
+ */
+#ifndef ENV_H
+#define ENV_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "game/game.h"
+#include "thread/thread_pool.h"
+
+// observation values, one byte per cell; 0 to 8 are revealed numbers
+#define ENV_CELL_HIDDEN 9
+#define ENV_CELL_FLAG   10
+#define ENV_CELL_GUESS  11
+
+// rewards
+#define ENV_REWARD_WIN     1.0f
+#define ENV_REWARD_LOSS    -1.0f
+#define ENV_REWARD_INVALID -0.05f
+
+struct EnvConfig {
+    int                 rows;
+    int                 cols;
+    int                 mines;
+    int                 threads;     // worker threads besides the caller, 0 steps serially
+    uint64_t            seed;
+    enum GameFirstClick first_click; // GAME_FIRST_CLICK_ANY lets the first reveal hit a mine
+};
+
+struct Env {
+    struct Game*      games;
+    uint64_t*         episodes; // games played so far by each env
+    void*             memory;   // the boards of every game, handed out by arena
+    size_t            memory_size;
+    struct Arena      arena;
+    struct AllocStats alloc_stats; // of games, episodes and memory; the boards count their grids
+    int               num_envs;
+    int               num_tasks;
+    struct EnvConfig  config;
+    struct ThreadPool pool;
+    // arguments of the step in progress
+    const int32_t*    actions;
+    uint8_t*          observations;
+    float*            rewards;
+    uint8_t*          dones;
+};
+
+bool env__create(int num_envs, const struct EnvConfig* config, struct Env* env);
+void env__destruct(struct Env* env);
+void env__reset(uint8_t* observations, struct Env* env);
+void env__step(const int32_t* actions, uint8_t* observations, float* rewards, uint8_t* dones, struct Env* env);
+int  env__num_actions(struct Env* env);
+
+#endif // ENV_H
@@ -8,12 +8,11 @@
 
 #include "game/game.h"
 
-bool command_processor__reveal(int x, int y, struct Game* game);
-bool command_processor__flag(int x, int y, struct Game* game);
-bool command_processor__guess(int x, int y, struct Game* game);
-void command_processor__help();
-bool command_processor__no_fog(struct Game* game);
-void command_processor__quit(struct Game* game);
-void command_processor__close(struct Game* game);
+enum GameStatus command_processor__reveal(int x, int y, struct Game* game);
+enum GameStatus command_processor__flag(int x, int y, struct Game* game);
+enum GameStatus command_processor__guess(int x, int y, struct Game* game);
+bool            command_processor__no_fog(struct Game* game);
+void            command_processor__quit(struct Game* game);
+void            command_processor__close(struct Game* game);
 
 #endif // COMMAND_PROCESSOR_H
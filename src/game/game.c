@@ -7,192 +7,412 @@
  *
  * Design Philosophy:
  *
- * This file contains the functions needed to run the game. This includes
- * the game loop, print statements, and tunnels to the command processors.
+ * This file contains the rules of the game: building boards and applying
+ * moves. Nothing here reads input or prints, so the same code runs the
+ * terminal game, the server, bots and embedders of the library. The
+ * terminal game loop lives in cli.c.
  *
  * @author daoge_cmd
  * @date June 24, 2025
  */
 
-#include <stdio.h>
+#include <stdint.h>
 #include <stdlib.h>
-#include <string.h>
 #include <time.h>
 
 #include "board/board.h"
 #include "game/game.h"
-#include "game/command_processor.h"
-#include "user/user.h"
-
-static const char *WIN =
-    "  ___    ___ ________  ___  ___          ___       __   ___  ________      \n"
-    " |\\  \\  /  /|\\   __  \\|\\  \\|\\  \\        |\\  \\     |\\  \\|\\  \\|\\   ___  \\    \n"
-    " \\ \\  \\/  / | \\  \\|\\  \\ \\  \\\\\\  \\       \\ \\  \\    \\ \\  \\ \\  \\ \\  \\\\ \\  \\   \n"
-    "  \\ \\    / / \\ \\  \\\\\\  \\ \\  \\\\\\  \\       \\ \\  \\  __\\ \\  \\ \\  \\ \\  \\\\ \\  \\  \n"
-    "   \\/  /  /   \\ \\  \\\\\\  \\ \\  \\\\\\  \\       \\ \\  \\|__\\_\\  \\ \\  \\ \\  \\\\ \\  \\ \n"
-    " __/  / /      \\ \\_______\\ \\_______\\       \\ \\____________\\ \\__\\ \\__\\\\ \\__\\\n"
-    "|\\___/ /        \\|_______|\\|_______|        \\|____________|\\|__|\\|__| \\|__|\n"
-    "\\|___|/                                                                    \n"
-    "\n"
-    "Score: %f\n";
-
-static const char *LOSS =
-    "__  __               __                  \n"
-    "\\ \\/ /___  __  __   / /   ____  ________ \n"
-    " \\  / __ \\/ / / /  / /   / __ \\/ ___/ _ \\\n"
-    " / / /_/ / /_/ /  / /___/ /_/ (__  )  __/\n"
-    "/_/\\____/\\__,_/  /_____/\\____/____/\\___/ \n"
-    "                                         \n";
+#include "game/game_events.h"
+#include "rng/rng.h"
 
 /**
- * This function prints the win screen for the game.
+ * This function builds a specified game. This function builds
+ * the board to the specified size and difficulty. The won and noFog
+ * params are set to false by default. The seed is taken from the clock
+ * and the game's address, so games built in the same second still differ.
+ * Returns false, with nothing to destruct, if out of memory.
+ * 
+ * @param game the game to have it's board built
+ *
+ * @return true if built; false otherwise
  */
-void game__print_win(struct Game *game) {
-  // Calculate score based on time taken
-  double score = difftime(game__get_end_time(game), game__get_start_time(game));
-  printf(WIN, score);
-
-  // Add score to user's total score
-  struct User *current_user = user__get_current_user();
-  current_user->total_scores += (int) score;
+bool game__build_game(int x, int y, int mines, struct Game *game) {
+  uint64_t seed = rng__mix((uint64_t) time(NULL)) ^ (uint64_t) (uintptr_t) game;
+  return game__build_game_seeded(x, y, mines, seed, game);
 }
 
 /**
- * This function prints the loss screen for the game.
+ * This function builds a specified game from a seed. The same size,
+ * mine count and seed always produce the same board. The game is not
+ * tied to any user, does not request closing the program and lets the
+ * first reveal hit a mine. Returns false, with nothing to destruct, if
+ * the board could not be built.
+ *
+ * @param x the width of the board
+ * @param y the height of the board
+ * @param mines the number of mines to place
+ * @param seed the seed for mine placement
+ * @param game the game to have it's board built
+ *
+ * @return true if built; false otherwise
  */
-void game__print_loss() {
-  printf("%s", LOSS);
+bool game__build_game_seeded(int x, int y, int mines, uint64_t seed, struct Game *game) {
+  return game__build_game_allocator(x, y, mines, seed, &ALLOC_SYSTEM, game);
 }
 
 /**
- * This function builds a specified game. This function builds
- * the board to the specified size and difficulty. The won and noFog
- * params are set to false by default.
- * 
+ * This function builds a game from a seed, like game__build_game_seeded,
+ * with its board allocated from the given allocator. Playing and
+ * resetting the game allocate nothing more.
+ *
+ * @param x the width of the board
+ * @param y the height of the board
+ * @param mines the number of mines to place
+ * @param seed the seed for mine placement
+ * @param allocator where the board is allocated from
  * @param game the game to have it's board built
+ *
+ * @return true if built; false otherwise
  */
-void game__build_game(int x, int y, int mines, struct Game *game) {
+bool game__build_game_allocator(int x, int y, int mines, uint64_t seed, const struct Allocator *allocator,
+                                struct Game *game) {
+  game->user = NULL;
+  game->events = NULL;
+  game->first_click = GAME_FIRST_CLICK_ANY;
+  if (!board__build_array_allocator(x, y, allocator, &game->board)) {
+    return false;
+  }
+  game__reset_game(mines, seed, game);
+  return true;
+}
+
+/**
+ * This function starts a new game on an already built board of the same
+ * size. It clears the board, places the mines for the seed and labels
+ * the openings, without allocating, so the same struct can be replayed
+ * any number of times.
+ *
+ * @param mines the number of mines to place
+ * @param seed the seed for mine placement
+ * @param game the game to be reset
+ */
+void game__reset_game(int mines, uint64_t seed, struct Game *game) {
   game__set_end(false, game);
-  board__build_array(x, y, &game->board);
+  game->close = false;
+  game->seed = seed;
+  board__reset(&game->board);
   
   /* Place mines randomly */
-  srand(time(0)); // use time for better randomness
+  rng__seed(seed, &game->rng);
   
   for (int i = 0; i < mines; i++) { 
     bool placed = false;
     while (!placed) {
-      int x = rand() % board__get_x(&game->board);
-      int y = rand() % board__get_y(&game->board);
+      int x = rng__below(board__get_x(&game->board), &game->rng);
+      int y = rng__below(board__get_y(&game->board), &game->rng);
       placed = board__place_mine(x, y, &game->board);
     }
   }
 
   game__set_flags(mines, game);
   board__set_no_fog(false, &game->board);
+
+  /* Label openings once, so reveals and scoring do not search for them */
+  board__label_openings(&game->board);
+  game->bbbv = board__get_3bv(&game->board);
   
   game->turns = 0;
+  game->bbbv_solved = 0;
+  game->openings_used = 0;
+  game->wasted_flags = 0;
 }
 
 /**
- * This function prompts the user for game input. This function
- * then passes necessary information to the command processor to
- * be handled. Prints out invalid command information if command
- * is invalid.
+ * This function checks if the passed in game has been won, ie. every
+ * mine is flagged and there are no extra flags.
+ *
+ * @param game the game to check
  *
- * @param game the game to process input on
+ * @return true if the game is won; false otherwise
  */
-void game__take_game_input(struct Game *game) {
-  //---VARIABLES---//
-  char rawInput[20];
+bool game__check_win(struct Game *game) {
+  return board__get_num_mines(&game->board) == 0 &&
+         board__get_num_flags(&game->board) == game__get_flags(game);
+}
 
-  char * input;
-  char * xChar;
-  char * yChar;
-  
-  int x;
-  int y;
+/**
+ * This function returns the position of a tile in row order.
+ */
+static int game__row_order(int index, struct Board *board) {
+  return board__index_x(index, board) * board__get_y(board) + board__index_y(index, board);
+}
 
-  // Take in command
-  printf("Enter a command: ");
-  
-  fgets(rawInput, 20, stdin);
-
-  // Parse command
-  input = strtok(rawInput, " ");
-  xChar = strtok(NULL, " ");
-  yChar = strtok(NULL, " ");
-
-  // Checks if input requiring coordinates is in form [input] [x] [y]
-  if ((xChar == NULL || yChar == NULL) &&
-      (strncmp(input, "r", 1) == 0 || strncmp(input, "f", 1) == 0 || strncmp(input, "g", 1) == 0)) {
-    // Makes input invalid
-    input = "x";
-  } else if (strncmp(input, "r", 1) == 0 || strncmp(input, "f", 1) == 0 || strncmp(input, "g", 1) == 0) {
-    // Sets x and y
-    x = atoi(xChar);
-    y = atoi(yChar);
-  }
+/**
+ * This function lists the area the first reveal must keep clear: the
+ * revealed tile and, with a radius of 1, its neighbors in the board's
+ * topology. The area is listed in row order.
+ *
+ * @param x the x coordinate of the first reveal
+ * @param y the y coordinate of the first reveal
+ * @param radius 1 to list the neighbors too; 0 otherwise
+ * @param area the indexes of the tiles in the area
+ * @param board the board of the game
+ *
+ * @return the number of tiles in the area
+ */
+static int game__first_click_area(int x, int y, int radius, int *area, struct Board *board) {
+  int index = board__index(x, y, board);
+  int count = 0;
 
-  // Processes Input by calling correct functions
-  if (strncmp(input, "r", 1) == 0 || strncmp(input, "reveal", 6) == 0) {
-    command_processor__reveal(x, y, game);
-  } else if (strncmp(input, "f", 1) == 0 || strncmp(input, "flag", 4) == 0) {
-    command_processor__flag(x, y, game);
-  } else if (strncmp(input, "h", 1) == 0 || strncmp(input, "help", 4) == 0) {
-    command_processor__help();
-    game->turns--;
-  } else if (strncmp(input, "g", 1) == 0 || strncmp(input, "guess", 5) == 0) {
-    command_processor__guess(x, y, game);
-  } else if (strncmp(input, "noFog", 5) == 0) {
-    command_processor__no_fog(game);
-  } else if (strncmp(input, "q", 1) == 0 || strncmp(input, "quit", 4) == 0) {
-    command_processor__quit(game);
-  } else if (strncmp(input, "c", 1) == 0 || strncmp(input, "close", 5) == 0) {
-    command_processor__close(game);
-  } else {
-    printf("\nInvalid Command: %s\n", input); // TODO: Change when game design is finalized
-    game->turns--;
+  area[count++] = index;
+  for (int k = 0; radius > 0 && k < board->board_num_neighbors; k++) {
+    int neighbor = board__neighbor(index, k, board);
+    if (board__in_bounds(board__index_x(neighbor, board), board__index_y(neighbor, board), board)) {
+      area[count++] = neighbor;
+    }
   }
 
-  game->turns++;
-  
+  // row order, so the mines are moved in the same order whatever the layout
+  for (int i = 1; i < count; i++) {
+    int cell = area[i];
+    int j = i;
+    for (; j > 0 && game__row_order(area[j - 1], board) > game__row_order(cell, board); j--) {
+      area[j] = area[j - 1];
+    }
+    area[j] = cell;
+  }
+  return count;
 }
 
 /**
- * This function runs the play loop for the passed in game.
+ * This function moves the mines off the area the first reveal must keep
+ * clear, see enum GameFirstClick. Each mine goes to a random tile outside
+ * the area, and the board patches only the counts around the two places
+ * it touched. The openings and 3BV are then labeled again, which leaves
+ * the counts alone. If the rest of the board has no room for the mines of
+ * the whole area, only the revealed tile is cleared.
  *
- * @param game the game to be played
+ * @param x the x coordinate of the first reveal
+ * @param y the y coordinate of the first reveal
+ * @param game the game to be modified
  */
-void game__play(struct Game *game) {
-  game__set_start_time(game);
-  while (!game__get_end(game)) {
-    printf("\n");
-
-    printf("Turn: %d\n", game->turns);
-    if (board__get_no_fog(&game->board) == true) {
-      board__print_no_fog(&game->board);
-      board__set_no_fog(false, &game->board);
-    } else {
-      board__print_board(&game->board);
+static void game__clear_first_click(int x, int y, struct Game *game) {
+  struct Board *board = &game->board;
+  int radius = game->first_click == GAME_FIRST_CLICK_OPENING ? 1 : 0;
+  int rows = board__get_x(board);
+  int cols = board__get_y(board);
+  int area[BOARD_NUM_NEIGHBORS + 1];
+  int area_cells = 0;
+  int area_mines = 0;
+
+  for (; radius >= 0; radius--) {
+    area_cells = game__first_click_area(x, y, radius, area, board);
+    area_mines = 0;
+    for (int i = 0; i < area_cells; i++) {
+      area_mines += board->mine_pointer[area[i]];
+    }
+    // free tiles outside the area
+    if (rows * cols - area_cells - (game__get_flags(game) - area_mines) >= area_mines) {
+      break;
+    }
+  }
+  if (radius < 0 || area_mines == 0) {
+    return;
+  }
+
+  for (int i = 0; i < area_cells; i++) {
+    if (!board->mine_pointer[area[i]]) {
+      continue;
     }
+    int from_x = board__index_x(area[i], board);
+    int from_y = board__index_y(area[i], board);
+    int to_x;
+    int to_y;
+    bool in_area;
+    do {
+      to_x = rng__below(rows, &game->rng);
+      to_y = rng__below(cols, &game->rng);
+      int to = board__index(to_x, to_y, board);
+      in_area = false;
+      for (int j = 0; j < area_cells; j++) {
+        in_area |= area[j] == to;
+      }
+    } while (in_area || board__contains_mine(to_x, to_y, board));
+    board__move_mine(from_x, from_y, to_x, to_y, board);
+
+    // a flag on either tile changes which mines are unflagged and which flags are wasted
+    int moved = (board__get_cell(from_x, from_y, board) == 'F') - (board__get_cell(to_x, to_y, board) == 'F');
+    board->board_num_mines += moved;
+    game->wasted_flags += moved;
+  }
+
+  board__label_openings(board);
+  game->bbbv = board__get_3bv(board);
+}
 
-    printf("\n");
+/**
+ * This function pushes the events of an accepted move to the game's ring:
+ * one per cell the move changed, in the order they changed, then the win
+ * or loss if the move ended the game.
+ *
+ * @param x the x coordinate of the move
+ * @param y the y coordinate of the move
+ * @param status the status of the move
+ * @param game the game the move was made on
+ */
+static void game__push_events(int x, int y, enum GameStatus status, struct Game *game) {
+  struct Board *board = &game->board;
+
+  for (int i = 0; i < board__get_num_changes(board); i++) {
+    int cell = board->changed_cells[i];
+    char value = board->board_pointer[cell];
+    enum GameEventType type = value == 'F' ? GAME_EVENT_FLAGGED : value == '?' ? GAME_EVENT_GUESSED
+                                                                               : GAME_EVENT_REVEALED;
+    game_events__push(type, board__index_x(cell, board), board__index_y(cell, board), value, game->turns,
+                      game->events);
+  }
+  if (status == GAME_STATUS_WIN) {
+    game_events__push(GAME_EVENT_WON, x, y, board__get_cell(x, y, board), game->turns, game->events);
+  } else if (status == GAME_STATUS_LOSS) {
+    game_events__push(GAME_EVENT_LOST, x, y, '*', game->turns, game->events);
+  }
+}
 
-    game__take_game_input(game);
-    
-    if (board__get_num_mines(&game->board) == 0 &&
-        board__get_num_flags(&game->board) == game__get_flags(game)) {
+/**
+ * This function applies a reveal (r), flag (f) or guess (g) to the game
+ * without printing anything, and returns what happened. Moves on cells
+ * out of bounds, already revealed or, for flags, already flagged are
+ * rejected without counting a turn. A reveal on a mine or a move that wins
+ * ends the game and sets its end time, unless it is the first reveal and
+ * the game keeps that clear of mines. The counters behind
+ * game__get_stats are kept up to date move by move. If the game has an
+ * event ring, the move's events are pushed to it, see game__push_events;
+ * the board's change journal then holds the last move only.
+ *
+ * @param command the command character, one of r, f or g
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param game the game to be modified
+ *
+ * @return the status of the move
+ */
+enum GameStatus game__apply(char command, int x, int y, struct Game *game) {
+  struct Board *board = &game->board;
+
+  if (game__get_end(game)) {
+    return GAME_STATUS_ENDED;
+  }
+  if (command != 'r' && command != 'f' && command != 'g') {
+    return GAME_STATUS_INVALID;
+  }
+  if (!board__in_bounds(x, y, board)) {
+    return GAME_STATUS_OUT_OF_BOUNDS;
+  }
+  if (board__is_revealed(x, y, board)) {
+    return GAME_STATUS_REVEALED;
+  }
+  if (command == 'f' && board__get_cell(x, y, board) == 'F') {
+    return GAME_STATUS_FLAGGED;
+  }
+
+  game->turns++;
+  if (game->events != NULL) {
+    board__clear_changes(board);
+  }
+  if (command == 'r') {
+    if (game->first_click != GAME_FIRST_CLICK_ANY && board__get_num_revealed(board) == 0) {
+      game__clear_first_click(x, y, game);
+    }
+    if (board__contains_mine(x, y, board)) {
       game__set_end_time(game);
-      game__print_win(game);
       game__set_end(true, game);
+      if (game->events != NULL) {
+        game__push_events(x, y, GAME_STATUS_LOSS, game);
+      }
+      return GAME_STATUS_LOSS;
+    }
+    int opening = board__get_opening(x, y, board);
+    board__reveal(x, y, board);
+    // border tiles are revealed by their opening for free, every other reveal is a 3BV click
+    game->openings_used += opening >= 0;
+    game->bbbv_solved += opening != BOARD_BORDER;
+  } else if (command == 'f') {
+    if (board__contains_mine(x, y, board)) {
+      board->board_num_mines--;
+    } else {
+      game->wasted_flags++;
+    }
+    board__flag(x, y, board);
+  } else {
+    // a guess takes the flag off, so flagging the tile again cannot count its mine twice
+    if (board__get_cell(x, y, board) == 'F') {
+      if (board__contains_mine(x, y, board)) {
+        board->board_num_mines++;
+      } else {
+        game->wasted_flags--;
+      }
     }
+    board__guess(x, y, board);
   }
+
+  enum GameStatus status = GAME_STATUS_OK;
+  if (game__check_win(game)) {
+    game__set_end_time(game);
+    game__set_end(true, game);
+    status = GAME_STATUS_WIN;
+  }
+  if (game->events != NULL) {
+    game__push_events(x, y, status, game);
+  }
+  return status;
+}
+
+/**
+ * This function fills in the statistics of a game from the counters kept
+ * by game__apply, without looking at the board. Rates are 0 when no time
+ * or no turns have passed.
+ *
+ * @param game the game to report on
+ * @param stats the statistics to fill in
+ */
+void game__get_stats(struct Game *game, struct GameStats *stats) {
+  stats->won = game__check_win(game);
+  stats->bbbv = game->bbbv;
+  stats->bbbv_solved = game->bbbv_solved;
+  stats->turns = game->turns;
+  stats->openings_used = game->openings_used;
+  stats->wasted_flags = game->wasted_flags;
+  stats->seconds = difftime(game__get_end_time(game), game__get_start_time(game));
+  stats->bbbv_per_second = stats->seconds > 0 ? stats->bbbv_solved / stats->seconds : 0;
+  stats->efficiency = stats->turns > 0 ? (double) stats->bbbv_solved / stats->turns : 0;
 }
 
 //---------------------//
 //   GETTERS/SETTERS   //
 //---------------------//
 
+/**
+ * This function sets what the first reveal of the game is kept clear of.
+ * It only has an effect before the first tile is revealed.
+ *
+ * @param first_click the area kept clear of mines
+ * @param game the game to be configured
+ */
+void game__set_first_click(enum GameFirstClick first_click, struct Game *game) {
+  game->first_click = first_click;
+}
+
+/**
+ * This function attaches an event ring to the game, which every accepted
+ * move then pushes its events to. NULL detaches it.
+ *
+ * @param events the ring to push to, or NULL
+ * @param game the game to be configured
+ */
+void game__set_events(struct GameEvents *events, struct Game *game) {
+  game->events = events;
+}
+
 /**
  * This function takes in a bool and a game and sets
  * end status in game.
@@ -282,3 +502,15 @@ void game__set_end_time(struct Game *game) {
 time_t game__get_end_time(struct Game *game) {
   return game->end_time;
 }
+
+/**
+ * This function returns the 3BV of the game's board, the fewest clicks
+ * that reveal every safe tile.
+ *
+ * @param game the game to return the value on
+ *
+ * @return the 3BV
+ */
+int game__get_3bv(struct Game *game) {
+  return game->bbbv;
+}
@@ -6,26 +6,77 @@
 #ifndef GAME_H
 #define GAME_H
 
+#include <stdint.h>
 #include <time.h>
 
 #include "board/board.h"
+#include "rng/rng.h"
+
+struct GameEvents;
+struct User;
+
+enum GameStatus {
+    GAME_STATUS_OK,
+    GAME_STATUS_WIN,
+    GAME_STATUS_LOSS,
+    GAME_STATUS_OUT_OF_BOUNDS,
+    GAME_STATUS_REVEALED,
+    GAME_STATUS_FLAGGED,
+    GAME_STATUS_ENDED,
+    GAME_STATUS_INVALID,
+    GAME_STATUS_NO_MEMORY, // a new game, or the memory a move needed, could not be allocated
+};
+
+// what the first reveal of a game is kept clear of, by moving mines away
+enum GameFirstClick {
+    GAME_FIRST_CLICK_ANY,     // nothing, the first reveal can hit a mine
+    GAME_FIRST_CLICK_SAFE,    // the revealed tile
+    GAME_FIRST_CLICK_OPENING, // the revealed tile and its neighbors, so it opens
+};
+
+struct GameStats {
+    bool   won;
+    int    bbbv;            // 3BV of the board
+    int    bbbv_solved;     // 3BV clicks made: openings plus numbered tiles apart from them
+    int    turns;
+    int    openings_used;
+    int    wasted_flags;    // flags placed on tiles without a mine
+    double seconds;
+    double bbbv_per_second; // solved 3BV over seconds
+    double efficiency;      // solved 3BV over turns
+};
 
 struct Game {
-    struct Board board;
-    bool         end;
-    int          turns;
-    int          flags_needed;
-    time_t       start_time;
-    time_t       end_time;
+    struct Board        board;
+    struct User*        user;  // player credited with the score, NULL for anonymous sessions
+    struct GameEvents*  events; // where moves push what they did, NULL to push nothing
+    bool                end;
+    bool                close; // the player asked to close the whole program
+    enum GameFirstClick first_click;
+    int                 turns;
+    int                 flags_needed;
+    int                 bbbv;  // 3BV: the fewest clicks that solve the board
+    int                 bbbv_solved;
+    int                 openings_used;
+    int                 wasted_flags;
+    uint64_t            seed;
+    struct Rng          rng;   // mine placement, then moving mines off the first reveal
+    time_t              start_time;
+    time_t              end_time;
 };
 
-void game__print_win(struct Game* game);
-void game__print_loss();
-void game__build_game(int x, int y, int mines, struct Game* game);
-void game__take_game_input(struct Game* game);
-void game__play(struct Game* game);
+bool game__build_game(int x, int y, int mines, struct Game* game);
+bool game__build_game_seeded(int x, int y, int mines, uint64_t seed, struct Game* game);
+bool game__build_game_allocator(int x, int y, int mines, uint64_t seed, const struct Allocator* allocator,
+                                struct Game* game);
+void game__reset_game(int mines, uint64_t seed, struct Game* game);
+bool game__check_win(struct Game* game);
+enum GameStatus game__apply(char command, int x, int y, struct Game* game);
+void game__get_stats(struct Game* game, struct GameStats* stats);
 
 // getters/setters
+void   game__set_first_click(enum GameFirstClick first_click, struct Game* game);
+void   game__set_events(struct GameEvents* events, struct Game* game);
 void   game__set_end(bool end, struct Game* game);
 bool   game__get_end(struct Game* game);
 void   game__set_flags(int flags, struct Game* game);
@@ -34,6 +85,7 @@ void   game__set_start_time(struct Game* game);
 time_t game__get_start_time(struct Game* game);
 void   game__set_end_time(struct Game* game);
 time_t game__get_end_time(struct Game* game);
+int    game__get_3bv(struct Game* game);
 
 
 #endif // GAME_H
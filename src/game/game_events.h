@@ -0,0 +1,50 @@
+/**
+ * @file game_events.h
+ * @brief The header for game events.
+ */
+#ifndef GAME_EVENTS_H
+#define GAME_EVENTS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "alloc/alloc.h"
+
+enum GameEventType {
+    GAME_EVENT_REVEALED, // value is the number shown
+    GAME_EVENT_FLAGGED,
+    GAME_EVENT_GUESSED,
+    GAME_EVENT_WON,      // x and y are the winning move
+    GAME_EVENT_LOST,     // x and y are the mine that was hit
+};
+
+struct GameEvent {
+    enum GameEventType type;
+    int                x;
+    int                y;
+    char               value; // the visible character of the cell after the move
+    int                turn;  // the turn of the move, counted from 1
+};
+
+// the events of a game, newest overwriting oldest once full
+struct GameEvents {
+    struct GameEvent* events;
+    uint64_t          mask;    // capacity - 1, the capacity a power of two
+    uint64_t          written; // events pushed since the ring was built
+    struct AllocStats alloc_stats;
+};
+
+// one consumer of the events, polling at its own pace
+struct GameEventReader {
+    uint64_t next;    // sequence number of the next event to read
+    uint64_t dropped; // events overwritten before this reader got to them
+};
+
+bool game_events__create(int capacity, struct GameEvents* events);
+void game_events__destruct(struct GameEvents* events);
+void game_events__push(enum GameEventType type, int x, int y, char value, int turn, struct GameEvents* events);
+void game_events__subscribe(struct GameEventReader* reader, const struct GameEvents* events);
+int  game_events__poll(struct GameEvent* out, int max_events, struct GameEventReader* reader,
+                       const struct GameEvents* events);
+
+#endif // GAME_EVENTS_H
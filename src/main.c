@@ -11,7 +11,6 @@
 
 #include "program/program.h"
 
-int main() {
-  program__run();
-  return 0;
+int main(int argc, char **argv) {
+  return program__run(argc, argv);
 }
@@ -19,7 +19,9 @@
 #include <string.h>
 #include <math.h>
 
+#include "cli/cli.h"
 #include "menu/menu.h"
+#include "pregen/pregen.h"
 #include "user/user.h"
 
 static const char *WELCOME =
@@ -30,12 +32,26 @@ static const char *WELCOME =
     "/_/  /_/_/_/ /_/\\___/____/|__/|__/\\___/\\___/ .___/\\___/_/     \n"
     "                              coded in C  /_/ v. 0.2.0        \n";
 
+// builds the next game of the last size while the current one is played
+static struct Pregen pregen;
+static bool pregen_running = false;
+
+/**
+ * This function stops the background game generator, if it was started.
+ */
+static void menu__stop_pregen() {
+  if (pregen_running) {
+    pregen__destruct(&pregen);
+    pregen_running = false;
+  }
+}
+
 /**
  * In current implementation with simple yes/no menu, this
  * function only takes yes or no AND process the game to be run.
- * Returns true if it runs, false otherwise;
+ * Returns true if the program should keep running, false otherwise.
  *
- * @return true if yes; false otherwise 
+ * @return true if yes and the game was not closed; false otherwise 
  */
 bool menu__take_input() {
   struct Game game;
@@ -50,20 +66,29 @@ bool menu__take_input() {
       strncmp(input, "No", 2) == 0 || strncmp(input, "no", 2) == 0) {
     printf("Saving user data and exiting...\n");
     user__save();
+    menu__stop_pregen();
     return false;
   } else {
-    menu__build_board(&game);
-    return true;
+    if (!menu__build_board(&game)) {
+      return true;
+    }
+    board__destruct(&game.board);
+    if (game.close) {
+      menu__stop_pregen();
+    }
+    return !game.close;
   }
 }
 
 /**
  * This function takes in a game and asks the user for height, width and density
- * paramaters. Then it builds the game.
+ * paramaters. Then it builds the game, or takes it ready made from the
+ * background generator if that already built one of this size, and has
+ * the generator build the next one while this game is played.
  *
  * @param game the game to be built
  * 
- * @return true if runs; false otherwise
+ * @return true if runs; false if the game could not be built
  */
 bool menu__build_board(struct Game *game) {
   char input[5];
@@ -111,13 +136,24 @@ bool menu__build_board(struct Game *game) {
     }
   }
   
-  game__build_game(width, height, num_mines, game);
+  if (!pregen_running) {
+    pregen_running = pregen__create(&pregen);
+  }
+  if ((!pregen_running || !pregen__take(width, height, num_mines, game, &pregen)) &&
+      !game__build_game(width, height, num_mines, game)) {
+    printf("\nOut of memory, the game could not be built\n");
+    return false;
+  }
+  if (pregen_running) {
+    pregen__request(width, height, num_mines, &pregen);
+  }
+  game->user = user__get_current_user();
   
   // Clear the input buffer to avoid issues with leftover characters ("\n")
   int c;
   while((c = getchar()) != '\n' && c != EOF);
 
-  game__play(game);
+  cli__play(game);
 
   return true;
 }
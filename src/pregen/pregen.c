@@ -0,0 +1,191 @@
+/**
+ * @file pregen.c
+ * @brief Implementation for the background game generator.
+ *
+ * A worker thread that builds the next game while the current one is
+ * played, so starting a rematch does not wait for board generation.
+ *
+ * Design Philosophy:
+ *
+ * The player asks for the next game with pregen__request, usually with
+ * the size of the game that just started. The worker builds it on its
+ * own thread and drops it into a single slot. pregen__take swaps the slot
+ * empty with one atomic exchange and keeps the game if it has the size
+ * asked for, so handing a game over never waits on the worker, even if
+ * it is busy building. A game left in the slot by an older request is
+ * replaced by the worker and freed; a game of the wrong size is freed by
+ * pregen__take, which then tells the caller to build one itself.
+ *
+ * The mutex and condition put the worker to sleep between requests. The
+ * games in the slot come from ALLOC_SYSTEM. Either side may free them,
+ * so each side counts what it did in its own AllocStats, the worker in
+ * alloc_stats and the thread taking games in taken_stats, and neither
+ * takes a lock for it. The two are only added up in pregen__destruct,
+ * once the worker is gone.
+ * Games are seeded from the generator's own sequence, since games built
+ * in the same second at a reused address would otherwise get the same
+ * seed from game__build_game.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#include <stdint.h>
+#include <time.h>
+
+#include "pregen/pregen.h"
+#include "rng/rng.h"
+
+/**
+ * This function frees a game built by the worker.
+ *
+ * @param game the game to be freed, may be NULL
+ * @param stats the counters of the thread freeing it
+ */
+static void pregen__free_game(struct Game *game, struct AllocStats *stats) {
+  if (game != NULL) {
+    board__destruct(&game->board);
+    alloc__release(game, sizeof(struct Game), &ALLOC_SYSTEM, stats);
+  }
+}
+
+/**
+ * This function is the main loop of the worker: wait for a request,
+ * build the game for it, put it in the slot, repeat until stopped.
+ *
+ * @param arg the generator
+ */
+static void pregen__worker(void *arg) {
+  struct Pregen *pregen = (struct Pregen *)arg;
+
+  thread__mutex_lock(&pregen->mutex);
+  for (;;) {
+    while (pregen->handled == pregen->requested && !pregen->stopping) {
+      thread__cond_wait(&pregen->wake, &pregen->mutex);
+    }
+    if (pregen->stopping) {
+      break;
+    }
+    int width = pregen->width;
+    int height = pregen->height;
+    int mines = pregen->mines;
+    pregen->handled = pregen->requested;
+    thread__mutex_unlock(&pregen->mutex);
+
+    struct Game *game = (struct Game *)alloc__allocate(sizeof(struct Game), &ALLOC_SYSTEM, &pregen->alloc_stats);
+    if (game != NULL && game__build_game_seeded(width, height, mines, rng__next(&pregen->rng), game)) {
+      pregen__free_game(atomic_exchange(&pregen->slot, game), &pregen->alloc_stats);
+    } else {
+      // out of memory: the slot keeps what it has, and the menu builds its own
+      alloc__release(game, sizeof(struct Game), &ALLOC_SYSTEM, &pregen->alloc_stats);
+    }
+
+    thread__mutex_lock(&pregen->mutex);
+  }
+  thread__mutex_unlock(&pregen->mutex);
+}
+
+/**
+ * This function starts the generator with an empty slot. Returns false
+ * if the worker thread could not be started.
+ *
+ * @param pregen the generator to be started
+ *
+ * @return true if started; false otherwise
+ */
+bool pregen__create(struct Pregen *pregen) {
+  pregen->requested = 0;
+  pregen->handled = 0;
+  pregen->stopping = false;
+  pregen->alloc_stats = (struct AllocStats) {0};
+  pregen->taken_stats = (struct AllocStats) {0};
+  rng__seed(rng__mix((uint64_t) time(NULL)) ^ (uint64_t) (uintptr_t) pregen, &pregen->rng);
+  atomic_init(&pregen->slot, NULL);
+  thread__mutex_init(&pregen->mutex);
+  thread__cond_init(&pregen->wake);
+
+  if (!thread__create(pregen__worker, pregen, &pregen->thread)) {
+    thread__cond_destroy(&pregen->wake);
+    thread__mutex_destroy(&pregen->mutex);
+    return false;
+  }
+  return true;
+}
+
+/**
+ * This function stops the worker, waiting for a game in progress, and
+ * frees any game left in the slot. Call it from the thread that takes
+ * the games.
+ *
+ * @param pregen the generator to be stopped
+ */
+void pregen__destruct(struct Pregen *pregen) {
+  thread__mutex_lock(&pregen->mutex);
+  pregen->stopping = true;
+  thread__cond_broadcast(&pregen->wake);
+  thread__mutex_unlock(&pregen->mutex);
+
+  thread__join(&pregen->thread);
+  pregen__free_game(atomic_exchange(&pregen->slot, NULL), &pregen->taken_stats);
+
+  // taken_stats only releases, so its bytes wrap below zero and the sum comes back right
+  struct AllocStats total = {
+      .bytes = pregen->alloc_stats.bytes + pregen->taken_stats.bytes,
+      .peak_bytes = pregen->alloc_stats.peak_bytes,
+      .allocations = pregen->alloc_stats.allocations + pregen->taken_stats.allocations,
+      .releases = pregen->alloc_stats.releases + pregen->taken_stats.releases,
+  };
+  alloc__check_leaks("pregen", &total);
+
+  thread__cond_destroy(&pregen->wake);
+  thread__mutex_destroy(&pregen->mutex);
+}
+
+/**
+ * This function asks the worker to build a game in the background. A
+ * newer request replaces one the worker has not started yet.
+ *
+ * @param x the width of the board
+ * @param y the height of the board
+ * @param mines the number of mines to place
+ * @param pregen the generator
+ */
+void pregen__request(int x, int y, int mines, struct Pregen *pregen) {
+  thread__mutex_lock(&pregen->mutex);
+  pregen->width = x;
+  pregen->height = y;
+  pregen->mines = mines;
+  pregen->requested++;
+  thread__cond_broadcast(&pregen->wake);
+  thread__mutex_unlock(&pregen->mutex);
+}
+
+/**
+ * This function takes the game in the slot if it has the given size and
+ * mine count, moving it into the passed in game. It never waits for the
+ * worker: if the slot is empty or holds another size, it returns false
+ * and the caller builds the game itself. Only one thread may take games.
+ *
+ * @param x the width of the board
+ * @param y the height of the board
+ * @param mines the number of mines
+ * @param game receives the game
+ * @param pregen the generator
+ *
+ * @return true if a game was taken; false otherwise
+ */
+bool pregen__take(int x, int y, int mines, struct Game *game, struct Pregen *pregen) {
+  struct Game *ready = atomic_exchange(&pregen->slot, NULL);
+
+  if (ready == NULL) {
+    return false;
+  }
+  if (board__get_y(&ready->board) != x || board__get_x(&ready->board) != y || game__get_flags(ready) != mines) {
+    pregen__free_game(ready, &pregen->taken_stats);
+    return false;
+  }
+
+  *game = *ready;
+  alloc__release(ready, sizeof(struct Game), &ALLOC_SYSTEM, &pregen->taken_stats);
+  return true;
+}
@@ -0,0 +1,35 @@
+/**
+ * @file pregen.h
+ * @brief The header for pregen.
+ */
+#ifndef PREGEN_H
+#define PREGEN_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+
+#include "game/game.h"
+#include "thread/thread.h"
+
+struct Pregen {
+    Thread                thread;
+    Mutex                 mutex;     // guards width to stopping
+    Cond                  wake;
+    int                   width;     // the game to generate next, as for game__build_game
+    int                   height;
+    int                   mines;
+    unsigned long         requested; // requests made, the worker has handled up to handled
+    unsigned long         handled;
+    bool                  stopping;
+    struct Rng            rng;       // seeds of the games, used by the worker only
+    struct AllocStats     alloc_stats; // of the games, not their boards, used by the worker only
+    struct AllocStats     taken_stats; // of the games pregen__take freed, used by the taking thread only
+    _Atomic(struct Game*) slot;      // a finished game, NULL when empty
+};
+
+bool pregen__create(struct Pregen* pregen);
+void pregen__destruct(struct Pregen* pregen);
+void pregen__request(int x, int y, int mines, struct Pregen* pregen);
+bool pregen__take(int x, int y, int mines, struct Game* game, struct Pregen* pregen);
+
+#endif // PREGEN_H
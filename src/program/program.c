@@ -8,37 +8,136 @@
  * Design Philosophy:
  *
  * The code in this function will be called from main or other places to assist
- * with running the program.
+ * with running the program. Without arguments the program is the interactive
+ * terminal game; the command line flags select the other run modes.
  *
  * @author daoge_cmd
  * @date June 24, 2025
  */
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
 #include "program/program.h"
+#include "bench/bench.h"
+#include "bot/bot_protocol.h"
+#include "cli/cli.h"
 #include "menu/menu.h"
+#include "server/loadgen.h"
+#include "server/server.h"
 #include "user/user.h"
 
-/* Global Variables */
-bool running = true;
+/**
+ * This function picks the run mode from the command line arguments
+ * and runs it. Returns the exit code of the program.
+ *
+ * @param argc the number of arguments
+ * @param argv the arguments
+ *
+ * @return the exit code
+ */
+int program__run(int argc, char **argv) {
+  if (argc < 2) {
+    program__run_interactive();
+    return 0;
+  }
+
+  if (strcmp(argv[1], "--server") == 0 && argc >= 3) {
+    return server__run(argv[2]);
+  } else if (strcmp(argv[1], "--loadgen") == 0 && argc >= 3) {
+    int sessions = argc >= 4 ? atoi(argv[3]) : 10000;
+    int concurrency = argc >= 5 ? atoi(argv[4]) : 64;
+    return loadgen__run(argv[2], sessions, concurrency);
+  } else if (strcmp(argv[1], "--spectate") == 0 && argc >= 3) {
+    return loadgen__spectate(argv[2], argc >= 4 ? atoi(argv[3]) : 1000, argc >= 5 ? atoi(argv[4]) : 500);
+  } else if (strcmp(argv[1], "--bot") == 0) {
+    return bot_protocol__run();
+  } else if (strcmp(argv[1], "--bot-bench") == 0) {
+    return bot_protocol__bench(argc >= 3 ? atoi(argv[2]) : 1000000);
+  } else if (strcmp(argv[1], "--env-bench") == 0) {
+    int num_envs = argc >= 3 ? atoi(argv[2]) : 4096;
+    int threads = argc >= 4 ? atoi(argv[3]) : 0;
+    return bench__env(num_envs, threads, argc >= 5 ? atoi(argv[4]) : 10000000);
+  } else if (strcmp(argv[1], "--board-bench") == 0) {
+    return bench__board(argc >= 3 ? atoi(argv[2]) : 4000, argc >= 4 ? atoi(argv[3]) : 3);
+  } else if (strcmp(argv[1], "--layout-bench") == 0) {
+    return bench__layouts();
+  } else if (strcmp(argv[1], "--topology-bench") == 0) {
+    return bench__topologies();
+  } else if (strcmp(argv[1], "--preset-bench") == 0) {
+    return bench__presets(argc >= 3 ? atoi(argv[2]) : 1000000);
+  } else if (strcmp(argv[1], "--solver-bench") == 0) {
+    return bench__solver(argc >= 3 ? atoi(argv[2]) : 10000);
+  } else if (strcmp(argv[1], "--pattern-bench") == 0) {
+    return bench__patterns(argc >= 3 ? atoi(argv[2]) : 10000);
+  } else if (strcmp(argv[1], "--guess-bench") == 0) {
+    return bench__guesser(argc >= 3 ? atoi(argv[2]) : 1000, argc >= 4 ? atoi(argv[3]) : 3,
+                          argc >= 5 ? atoi(argv[4]) : 20);
+  } else if (strcmp(argv[1], "--endgame-bench") == 0) {
+    return bench__endgame(argc >= 3 ? atoi(argv[2]) : 1000, argc >= 4 ? atoi(argv[3]) : 32,
+                          argc >= 5 ? atoi(argv[4]) : 50);
+  } else if (strcmp(argv[1], "--sweep") == 0) {
+    return bench__sweep(argc >= 3 ? argv[2] : "8,16,24,32", argc >= 4 ? argv[3] : "0.10,0.15,0.20,0.25,0.30",
+                        argc >= 5 ? atoi(argv[4]) : 200, argc >= 6 ? atoi(argv[5]) : 3,
+                        argc >= 7 ? strtoull(argv[6], NULL, 10) : 1);
+  } else if (strcmp(argv[1], "--coop-bench") == 0) {
+    return bench__coop(argc >= 3 ? atoi(argv[2]) : 1000, argc >= 4 ? atoi(argv[3]) : 8);
+  } else if (strcmp(argv[1], "--endless") == 0) {
+    int mines_per_chunk = argc >= 3 ? atoi(argv[2]) : 160;
+    uint64_t seed = argc >= 4 ? strtoull(argv[3], NULL, 10) : (uint64_t) time(NULL);
+    return cli__play_endless(mines_per_chunk, seed);
+  } else if (strcmp(argv[1], "--race") == 0 && argc >= 3) {
+    uint64_t seed = argc >= 7 ? strtoull(argv[6], NULL, 10) : (uint64_t) time(NULL);
+    return cli__race(argv[2], argc >= 4 ? atoi(argv[3]) : 30, argc >= 5 ? atoi(argv[4]) : 16,
+                     argc >= 6 ? atoi(argv[5]) : 99, seed, argc >= 8 ? atoi(argv[7]) : -1);
+  }
+
+  program__print_usage(argv[0]);
+  return 1;
+}
 
 /**
  * This function runs the program loop to allow for
  * multiple games to be played in one run.
  */
-void program__run() {
+void program__run_interactive() {
   menu__print_welcome();
   user__init();
 
-  bool gameRan;
+  bool running = true;
   
   while(running) {
-    gameRan = menu__take_input();
-    if (gameRan == false && running == true) {
-      running = false;
-    } else if (gameRan == true && running == false) {
-      running = false;
-    } else {
-      running = true;
-    }
+    running = menu__take_input();
   }
 }
+
+/**
+ * This function prints the command line usage of the program.
+ *
+ * @param name the name the program was started with
+ */
+void program__print_usage(const char *name) {
+  printf("Usage:\n");
+  printf("\t%s\t\t\t\t\tPlay in the terminal\n", name);
+  printf("\t%s --server <addr>\t\t\tHost game sessions\n", name);
+  printf("\t%s --loadgen <addr> [sessions] [conc]\tLoad test a server\n", name);
+  printf("\t%s --spectate <addr> [spectators] [turns]\tMeasure spectator broadcast on a server\n", name);
+  printf("\t%s --bot\t\t\t\tPlay the binary bot protocol on stdin/stdout\n", name);
+  printf("\t%s --bot-bench [moves]\t\tMeasure bot moves per second\n", name);
+  printf("\t%s --env-bench [envs] [threads] [steps]\tMeasure batched env steps per second\n", name);
+  printf("\t%s --board-bench [size] [threads]\tMeasure labeling and revealing a huge board in parallel\n", name);
+  printf("\t%s --layout-bench\t\t\tCompare the memory layouts of the board\n", name);
+  printf("\t%s --topology-bench\t\t\tCompare square, torus, hex and knight boards\n", name);
+  printf("\t%s --preset-bench [games]\t\tCompare preset-specialized and generic game starts\n", name);
+  printf("\t%s --solver-bench [games]\t\tPlay expert games with the constraint solver\n", name);
+  printf("\t%s --pattern-bench [games]\t\tCompare the solver with and without the pattern table\n", name);
+  printf("\t%s --guess-bench [games] [threads] [ms]\tCompare random and Monte Carlo guesses\n", name);
+  printf("\t%s --endgame-bench [games] [cells] [ms]\tCompare guessing with and without the endgame search\n", name);
+  printf("\t%s --sweep [sizes] [densities] [games] [threads] [seed]\tWrite win rates by size and density as CSV\n", name);
+  printf("\t%s --coop-bench [size] [threads]\t\tMeasure lock-free moves on one shared board\n", name);
+  printf("\t%s --endless [mines] [seed]\t\tPlay an endless board, mines per 32x32 chunk\n", name);
+  printf("\t%s --race <players> [w] [h] [mines] [seed] [ms]\tRace solver, guesser and you on one board\n", name);
+  printf("Addresses are tcp:<port> (loopback) or unix:<path>\n");
+}
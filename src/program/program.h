@@ -7,6 +7,8 @@
 
 #include <stdbool.h>
 
-void program__run();
+int  program__run(int argc, char** argv);
+void program__run_interactive();
+void program__print_usage(const char* name);
 
 #endif // PROGRAM_H
@@ -0,0 +1,450 @@
+/**
+ * @file race.c
+ * @brief Implementation for head-to-head races.
+ *
+ * A race gives two or more players the same seeded board, each in their
+ * own game, and ranks them when all are done: the players who won by the
+ * time they took, then the rest by how much of the board they solved and
+ * their 3BV/s. Players can be people at the terminal or bots on their own
+ * threads.
+ *
+ * Design Philosophy:
+ *
+ * Every player owns their game, their move stamps and their result, so
+ * playing takes no locks at all: a move is the game's own move plus one
+ * read of the monotonic clock and one store. The only shared state is
+ * whether the race has started and how many players are done, kept under
+ * one mutex that each player takes twice, to wait for the start and to
+ * say they finished. All players measure from the same start, read once
+ * when the race starts.
+ *
+ * The first reveal moves mines off the tile clicked, so players clicking
+ * different tiles first would get different boards. The race makes the
+ * same opening for everyone before the start instead, and the boards
+ * stay identical.
+ *
+ * Results go to the users as each player finishes, from that player's
+ * thread; user.c serializes them.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE // clock_gettime
+#endif
+
+#include <stdlib.h>
+#include <time.h>
+
+#include "race/race.h"
+#include "rng/rng.h"
+#include "solver/guesser.h"
+#include "solver/patterns.h"
+#include "solver/solver.h"
+#include "user/user.h"
+
+#define RACE_BOT_SAMPLES 1000 // layouts the Monte Carlo bots draw per guess
+
+/**
+ * This function returns the race clock, a monotonic clock in
+ * nanoseconds.
+ *
+ * @return the clock
+ */
+uint64_t race__now() {
+#if defined(_WIN32)
+  LARGE_INTEGER counter;
+  LARGE_INTEGER frequency;
+  QueryPerformanceCounter(&counter);
+  QueryPerformanceFrequency(&frequency);
+  return (uint64_t) (counter.QuadPart / frequency.QuadPart * 1000000000ull +
+                     counter.QuadPart % frequency.QuadPart * 1000000000ull / frequency.QuadPart);
+#else
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t) now.tv_sec * 1000000000ull + (uint64_t) now.tv_nsec;
+#endif
+}
+
+//------------------------------//
+//   CONSTRUCTOR / DESTRUCTOR   //
+//------------------------------//
+
+/**
+ * This function builds a race: a game for every player on the same
+ * seeded board, each with the same opening already made in the middle.
+ * The players are anonymous until named with race__set_player.
+ *
+ * @param width the width of the board
+ * @param height the height of the board
+ * @param mines the number of mines
+ * @param seed the seed of the board
+ * @param num_players the number of players, 2 to RACE_MAX_PLAYERS
+ * @param race the race to build
+ *
+ * @return true if built; false if out of memory
+ */
+bool race__create(int width, int height, int mines, uint64_t seed, int num_players, struct Race *race) {
+  thread__mutex_init(&race->lock);
+  thread__cond_init(&race->changed);
+  race->started = false;
+  race->finished = 0;
+  race->start = 0;
+  race->players = (struct RacePlayer *)calloc(num_players, sizeof(struct RacePlayer));
+  race->num_players = 0;
+  if (race->players == NULL) {
+    race__destruct(race);
+    return false;
+  }
+
+  for (int i = 0; i < num_players; i++) {
+    struct RacePlayer *player = &race->players[i];
+    if (!game__build_game_seeded(width, height, mines, seed, &player->game)) {
+      race__destruct(race);
+      return false;
+    }
+    race->num_players++;
+
+    player->capacity = 2 * width * height;
+    player->stamps = (uint64_t *)malloc(player->capacity * sizeof(uint64_t));
+    if (player->stamps == NULL) {
+      race__destruct(race);
+      return false;
+    }
+    player->name = "anonymous";
+    game__set_first_click(GAME_FIRST_CLICK_OPENING, &player->game);
+    game__apply('r', board__get_x(&player->game.board) / 2, board__get_y(&player->game.board) / 2,
+                &player->game);
+    player->turns = player->game.turns;
+  }
+  return true;
+}
+
+/**
+ * This function frees the race. Its players must have stopped playing.
+ *
+ * @param race the race to be freed
+ */
+void race__destruct(struct Race *race) {
+  for (int i = 0; i < race->num_players; i++) {
+    board__destruct(&race->players[i].game.board);
+    free(race->players[i].stamps);
+  }
+  free(race->players);
+  race->players = NULL;
+  race->num_players = 0;
+  thread__cond_destroy(&race->changed);
+  thread__mutex_destroy(&race->lock);
+}
+
+/**
+ * This function names a player and the user credited with their result.
+ *
+ * @param player the index of the player
+ * @param name the name shown in the ranking, kept by reference
+ * @param user the user credited, or NULL for nobody
+ * @param race the race
+ */
+void race__set_player(int player, const char *name, struct User *user, struct Race *race) {
+  race->players[player].name = name;
+  race->players[player].user = user;
+  race->players[player].game.user = user;
+}
+
+//--------------//
+//   THE RACE   //
+//--------------//
+
+/**
+ * This function starts the clock and lets every player waiting in
+ * race__wait_start go.
+ *
+ * @param race the race to start
+ */
+void race__start(struct Race *race) {
+  thread__mutex_lock(&race->lock);
+  race->start = race__now();
+  race->started = true;
+  for (int i = 0; i < race->num_players; i++) {
+    game__set_start_time(&race->players[i].game);
+  }
+  thread__cond_broadcast(&race->changed);
+  thread__mutex_unlock(&race->lock);
+}
+
+/**
+ * This function waits until the race has started. Players call it
+ * before their first move.
+ *
+ * @param race the race
+ */
+void race__wait_start(struct Race *race) {
+  thread__mutex_lock(&race->lock);
+  while (!race->started) {
+    thread__cond_wait(&race->changed, &race->lock);
+  }
+  thread__mutex_unlock(&race->lock);
+}
+
+/**
+ * This function makes a move for a player and stamps it. Only the thread
+ * playing the player may call it.
+ *
+ * @param player the index of the player
+ * @param command the command character, one of r, f or g
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param race the race
+ *
+ * @return the status of the move
+ */
+enum GameStatus race__move(int player, char command, int x, int y, struct Race *race) {
+  enum GameStatus status = game__apply(command, x, y, &race->players[player].game);
+  race__stamp(player, race);
+  return status;
+}
+
+/**
+ * This function stamps the moves a player made on their game since the
+ * last stamp, for players whose moves are made by someone else, such as
+ * the terminal. Once the game has ended the player is done: their time
+ * is taken, their result goes to their user and the race is told. Only
+ * the thread playing the player may call it; calls once done do nothing.
+ *
+ * @param player the index of the player
+ * @param race the race
+ */
+void race__stamp(int player, struct Race *race) {
+  struct RacePlayer *racer = &race->players[player];
+
+  if (racer->done) {
+    return;
+  }
+
+  uint64_t now = race__now() - race->start;
+  if (racer->game.turns > racer->turns) {
+    if (racer->num_stamps == racer->capacity) {
+      uint64_t *stamps = (uint64_t *)realloc(racer->stamps, 2 * racer->capacity * sizeof(uint64_t));
+      if (stamps != NULL) {
+        racer->stamps = stamps;
+        racer->capacity *= 2;
+      }
+    }
+    if (racer->num_stamps < racer->capacity) {
+      racer->stamps[racer->num_stamps++] = now;
+    }
+    racer->turns = racer->game.turns;
+  }
+  if (!game__get_end(&racer->game)) {
+    return;
+  }
+
+  racer->done = true;
+  racer->finish = now;
+  game__get_stats(&racer->game, &racer->stats);
+  racer->stats.seconds = now / 1e9;
+  racer->stats.bbbv_per_second = now > 0 ? racer->stats.bbbv_solved / racer->stats.seconds : 0;
+  if (racer->user != NULL) {
+    user__record_stats(racer->user, &racer->stats);
+  }
+
+  thread__mutex_lock(&race->lock);
+  race->finished++;
+  thread__cond_broadcast(&race->changed);
+  thread__mutex_unlock(&race->lock);
+}
+
+/**
+ * This function ends a player's game where it is, as a loss unless it
+ * was already won, for players who give up or cannot play.
+ *
+ * @param player the index of the player
+ * @param race the race
+ */
+void race__forfeit(int player, struct Race *race) {
+  game__set_end(true, &race->players[player].game);
+  race__stamp(player, race);
+}
+
+/**
+ * This function waits until every player is done.
+ *
+ * @param race the race
+ */
+void race__wait_finish(struct Race *race) {
+  thread__mutex_lock(&race->lock);
+  while (race->finished < race->num_players) {
+    thread__cond_wait(&race->changed, &race->lock);
+  }
+  thread__mutex_unlock(&race->lock);
+}
+
+//-------------//
+//   RESULTS   //
+//-------------//
+
+/**
+ * This function returns whether a player ranks ahead of another: winners
+ * ahead of the rest, faster winners first, and otherwise the more 3BV
+ * solved, then the higher 3BV/s.
+ *
+ * @param a a finished player
+ * @param b another finished player
+ *
+ * @return true if a ranks ahead of b
+ */
+static bool race__ahead(const struct RacePlayer *a, const struct RacePlayer *b) {
+  if (a->stats.won != b->stats.won) {
+    return a->stats.won;
+  }
+  if (a->stats.won && a->finish != b->finish) {
+    return a->finish < b->finish;
+  }
+  if (!a->stats.won && a->stats.bbbv_solved != b->stats.bbbv_solved) {
+    return a->stats.bbbv_solved > b->stats.bbbv_solved;
+  }
+  return a->stats.bbbv_per_second > b->stats.bbbv_per_second;
+}
+
+/**
+ * This function ranks the players of a finished race.
+ *
+ * @param order where to store the indexes of the players, first place
+ *              first; room for every player
+ * @param race the finished race
+ */
+void race__rank(int *order, struct Race *race) {
+  for (int i = 0; i < race->num_players; i++) {
+    int j = i;
+    while (j > 0 && race__ahead(&race->players[i], &race->players[order[j - 1]])) {
+      order[j] = order[j - 1];
+      j--;
+    }
+    order[j] = i;
+  }
+}
+
+/**
+ * This function adds the points of a finished race to the users of its
+ * players: a win is worth a point for every player ranked below, plus
+ * one, and a loss nothing.
+ *
+ * @param order the ranking, from race__rank
+ * @param race the finished race
+ */
+void race__award(const int *order, struct Race *race) {
+  for (int rank = 0; rank < race->num_players; rank++) {
+    struct RacePlayer *player = &race->players[order[rank]];
+    if (player->user != NULL && player->stats.won) {
+      user__add_score(player->user, race->num_players - rank);
+    }
+  }
+}
+
+//---------//
+//   BOT   //
+//---------//
+
+/**
+ * This function picks the next move of a bot: a tile the solver or the
+ * pattern table proved safe is revealed and a mine they proved is
+ * flagged, since the game is only won with every mine flagged. With
+ * neither, the bot reveals the Monte Carlo guesser's pick, else a random
+ * tile not known to be a mine.
+ *
+ * @param x where to store the x coordinate
+ * @param y where to store the y coordinate
+ * @param solver the bot's solver
+ * @param patterns the bot's pattern table
+ * @param guesser the bot's guesser, or NULL to guess at random
+ * @param mines the number of mines
+ * @param rng the bot's random numbers
+ *
+ * @return the command of the move, r or f
+ */
+static char race__choose(int *x, int *y, struct Solver *solver, struct Patterns *patterns, struct Guesser *guesser,
+                         int mines, struct Rng *rng) {
+  struct Board *board = solver->board;
+  bool mine;
+
+  if (solver__next_safe(x, y, solver)) {
+    return 'r';
+  }
+  if (patterns__next(x, y, &mine, patterns)) {
+    solver__learn(*x, *y, mine, solver);
+    return mine ? 'f' : 'r';
+  }
+  solver__solve(solver);
+  if (solver__next_safe(x, y, solver)) {
+    return 'r';
+  }
+  for (int i = 0; i < board__get_x(board); i++) {
+    for (int j = 0; j < board__get_y(board); j++) {
+      if (solver__get_cell(i, j, solver) == SOLVER_MINE && board__get_cell(i, j, board) != 'F') {
+        *x = i;
+        *y = j;
+        return 'f';
+      }
+    }
+  }
+  if (guesser != NULL && guesser__choose(x, y, mines, guesser)) {
+    return 'r';
+  }
+  do {
+    *x = rng__below(board__get_x(board), rng);
+    *y = rng__below(board__get_y(board), rng);
+  } while (solver__get_cell(*x, *y, solver) != SOLVER_UNKNOWN || board__get_cell(*x, *y, board) == 'F');
+  return 'r';
+}
+
+/**
+ * This function plays one player of a race with the solver, from the
+ * start of the race until its game ends. It is a ThreadFunction taking a
+ * struct RaceBot. A bot that runs out of memory forfeits.
+ *
+ * @param arg the bot
+ */
+void race__bot(void *arg) {
+  struct RaceBot *bot = (struct RaceBot *)arg;
+  struct Race *race = bot->race;
+  struct Game *game = &race->players[bot->player].game;
+  int mines = board__get_num_mines(&game->board);
+  struct GuesserConfig config = {0, 0, RACE_BOT_SAMPLES, 0.05, bot->seed};
+  struct Solver solver;
+  struct Patterns patterns;
+  struct Guesser guesser;
+  struct Rng rng;
+
+  bool solving = solver__create(&game->board, &solver);
+  bool matching = solving && patterns__create(&solver, &patterns);
+  bool guessing = matching && bot->monte_carlo && guesser__create(&game->board, &config, &guesser);
+  rng__seed(bot->seed, &rng);
+
+  race__wait_start(race);
+  if (matching && guessing == bot->monte_carlo) {
+    while (!game__get_end(game)) {
+      int x;
+      int y;
+      solver__update(&solver);
+      patterns__update(&patterns);
+      char command = race__choose(&x, &y, &solver, &patterns, guessing ? &guesser : NULL, mines, &rng);
+      if (bot->delay_ms > 0) {
+        thread__sleep(bot->delay_ms);
+      }
+      board__clear_changes(&game->board);
+      race__move(bot->player, command, x, y, race);
+    }
+  }
+  race__forfeit(bot->player, race);
+
+  if (guessing) {
+    guesser__destruct(&guesser);
+  }
+  if (matching) {
+    patterns__destruct(&patterns);
+  }
+  if (solving) {
+    solver__destruct(&solver);
+  }
+}
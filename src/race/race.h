@@ -0,0 +1,64 @@
+/**
+ * @file race.h
+ * @brief The header for race.
+ */
+#ifndef RACE_H
+#define RACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "game/game.h"
+#include "thread/thread.h"
+
+#define RACE_MAX_PLAYERS 16
+
+// one player of a race, playing their own copy of the board
+struct RacePlayer {
+    const char*      name;
+    struct User*     user;       // credited with the result, NULL for nobody
+    struct Game      game;
+    uint64_t*        stamps;     // when each accepted move was made, ns since the start
+    int              num_stamps;
+    int              capacity;
+    int              turns;      // turns of the game the stamps cover
+    bool             done;
+    uint64_t         finish;     // ns since the start the game ended at
+    struct GameStats stats;      // timed by the race clock, once done
+};
+
+// players racing on identical boards against one clock
+struct Race {
+    struct RacePlayer* players;
+    int                num_players;
+    Mutex              lock;     // guards started and finished
+    Cond               changed;
+    bool               started;
+    int                finished;
+    uint64_t           start;    // the race clock when the race started
+};
+
+// a bot playing one player of a race on its own thread
+struct RaceBot {
+    struct Race* race;
+    int          player;
+    bool         monte_carlo; // guess with the Monte Carlo guesser rather than at random
+    int          delay_ms;    // time taken for each move
+    uint64_t     seed;
+};
+
+uint64_t        race__now();
+bool            race__create(int width, int height, int mines, uint64_t seed, int num_players, struct Race* race);
+void            race__destruct(struct Race* race);
+void            race__set_player(int player, const char* name, struct User* user, struct Race* race);
+void            race__start(struct Race* race);
+void            race__wait_start(struct Race* race);
+enum GameStatus race__move(int player, char command, int x, int y, struct Race* race);
+void            race__stamp(int player, struct Race* race);
+void            race__forfeit(int player, struct Race* race);
+void            race__wait_finish(struct Race* race);
+void            race__rank(int* order, struct Race* race);
+void            race__award(const int* order, struct Race* race);
+void            race__bot(void* arg);
+
+#endif // RACE_H
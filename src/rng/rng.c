@@ -0,0 +1,71 @@
+/**
+ * @file rng.c
+ * @brief Implementation for the random number generator.
+ *
+ * Source code for a small seedable random number generator. Every game
+ * owns one of these instead of sharing the process wide rand() state.
+ *
+ * Design Philosophy:
+ *
+ * rand() has a single hidden state for the whole program, so two games
+ * built in the same second with srand(time(0)) get the same board, and
+ * the results cannot be reproduced from a seed. The generator here is
+ * splitmix64: one 64 bit word of state, cheap to copy, and good enough
+ * for placing mines.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#include "rng/rng.h"
+
+/**
+ * This function takes a seed and a generator and resets the generator
+ * to the start of the sequence for that seed.
+ *
+ * @param seed the seed
+ * @param rng the generator to be seeded
+ */
+void rng__seed(uint64_t seed, struct Rng *rng) {
+  rng->state = seed;
+}
+
+/**
+ * This function advances the generator and returns the next 64 bit value.
+ *
+ * @param rng the generator to advance
+ *
+ * @return the next random value
+ */
+uint64_t rng__next(struct Rng *rng) {
+  rng->state += 0x9E3779B97F4A7C15ull;
+  return rng__mix(rng->state);
+}
+
+/**
+ * This function returns a random value in the range [0, bound). The
+ * multiply-shift reduction avoids the modulo and its bias towards small
+ * values.
+ *
+ * @param bound the exclusive upper bound, must be positive
+ * @param rng the generator to draw from
+ *
+ * @return a value in [0, bound)
+ */
+int rng__below(int bound, struct Rng *rng) {
+  return (int) (((rng__next(rng) >> 32) * (uint64_t) bound) >> 32);
+}
+
+/**
+ * This function scrambles a 64 bit value. It is the splitmix64 finalizer
+ * and is also used to derive independent seeds from a base seed.
+ *
+ * @param value the value to scramble
+ *
+ * @return the scrambled value
+ */
+uint64_t rng__mix(uint64_t value) {
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+  return value ^ (value >> 31);
+}
@@ -0,0 +1,19 @@
+/**
+ * @file rng.h
+ * @brief The header for rng.
+ */
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+
+struct Rng {
+    uint64_t state;
+};
+
+void     rng__seed(uint64_t seed, struct Rng* rng);
+uint64_t rng__next(struct Rng* rng);
+int      rng__below(int bound, struct Rng* rng);
+uint64_t rng__mix(uint64_t value);
+
+#endif // RNG_H
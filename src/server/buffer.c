@@ -0,0 +1,131 @@
+/**
+ * @file buffer.c
+ * @brief Implementation for the byte buffer.
+ *
+ * A growable byte buffer used to collect socket output until the socket
+ * is ready to take it.
+ *
+ * Design Philosophy:
+ *
+ * The buffer only grows, it never shrinks. A connection reuses the same
+ * storage for its whole life, so after the first few replies no more
+ * allocations happen on the hot path.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "server/buffer.h"
+
+/**
+ * This function grows the buffer so that it can hold at least the
+ * requested number of bytes. Returns false if out of memory.
+ *
+ * @param capacity the number of bytes needed
+ * @param buffer the buffer to grow
+ *
+ * @return true if the buffer is large enough; false otherwise
+ */
+static bool buffer__reserve(size_t capacity, struct Buffer *buffer) {
+  if (capacity <= buffer->capacity) {
+    return true;
+  }
+
+  size_t new_capacity = buffer->capacity == 0 ? 256 : buffer->capacity;
+  while (new_capacity < capacity) {
+    new_capacity *= 2;
+  }
+
+  char *data = (char *)realloc(buffer->data, new_capacity);
+  if (data == NULL) {
+    return false;
+  }
+  buffer->data = data;
+  buffer->capacity = new_capacity;
+  return true;
+}
+
+/**
+ * This function initializes an empty buffer.
+ *
+ * @param buffer the buffer to initialize
+ */
+void buffer__init(struct Buffer *buffer) {
+  buffer->data = NULL;
+  buffer->length = 0;
+  buffer->capacity = 0;
+}
+
+/**
+ * This function frees the storage of the buffer.
+ *
+ * @param buffer the buffer to be freed
+ */
+void buffer__destruct(struct Buffer *buffer) {
+  free(buffer->data);
+  buffer__init(buffer);
+}
+
+/**
+ * This function appends bytes to the end of the buffer.
+ *
+ * @param data the bytes to append
+ * @param length the number of bytes
+ * @param buffer the buffer to append to
+ *
+ * @return true if appended; false if out of memory
+ */
+bool buffer__append(const char *data, size_t length, struct Buffer *buffer) {
+  if (!buffer__reserve(buffer->length + length, buffer)) {
+    return false;
+  }
+  memcpy(buffer->data + buffer->length, data, length);
+  buffer->length += length;
+  return true;
+}
+
+/**
+ * This function appends printf style formatted text to the buffer.
+ *
+ * @param buffer the buffer to append to
+ * @param format the format string
+ *
+ * @return true if appended; false if out of memory
+ */
+bool buffer__printf(struct Buffer *buffer, const char *format, ...) {
+  va_list args;
+  
+  va_start(args, format);
+  int length = vsnprintf(NULL, 0, format, args);
+  va_end(args);
+  if (length < 0 || !buffer__reserve(buffer->length + length + 1, buffer)) {
+    return false;
+  }
+
+  va_start(args, format);
+  vsnprintf(buffer->data + buffer->length, length + 1, format, args);
+  va_end(args);
+  buffer->length += length;
+  return true;
+}
+
+/**
+ * This function removes bytes from the front of the buffer, ie. the
+ * bytes that have been written out.
+ *
+ * @param length the number of bytes to remove
+ * @param buffer the buffer to consume from
+ */
+void buffer__consume(size_t length, struct Buffer *buffer) {
+  if (length >= buffer->length) {
+    buffer->length = 0;
+    return;
+  }
+  memmove(buffer->data, buffer->data + length, buffer->length - length);
+  buffer->length -= length;
+}
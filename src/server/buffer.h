@@ -0,0 +1,23 @@
+/**
+ * @file buffer.h
+ * @brief The header for buffer.
+ */
+#ifndef BUFFER_H
+#define BUFFER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+struct Buffer {
+    char*  data;
+    size_t length;
+    size_t capacity;
+};
+
+void buffer__init(struct Buffer* buffer);
+void buffer__destruct(struct Buffer* buffer);
+bool buffer__append(const char* data, size_t length, struct Buffer* buffer);
+bool buffer__printf(struct Buffer* buffer, const char* format, ...);
+void buffer__consume(size_t length, struct Buffer* buffer);
+
+#endif // BUFFER_H
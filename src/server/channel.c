@@ -0,0 +1,279 @@
+/**
+ * @file channel.c
+ * @brief Implementation for the spectator channels of sessions.
+ *
+ * A channel lists the connections watching a session and encodes what
+ * they are sent: a keyframe with the whole board when they start
+ * watching, then one delta line per turn.
+ *
+ * Design Philosophy:
+ *
+ * The frames are lines of the text protocol, so a spectator reads them
+ * like any reply:
+ *
+ *   k <turn> <rows> <cols> <state> <cells>        the whole board
+ *   d <turn> <state> <runs> <pos>:<cells> ...     what the turn changed
+ *   gone                                          the session closed
+ *
+ * State is play, win, lose or quit. Cells are the visible values of the
+ * board protocol, row after row; a value repeated CHANNEL_RUN_MIN times
+ * or more is written (count)value. A delta lists the changed cells as
+ * runs of consecutive positions, pos = row * cols + col, so a flood fill
+ * costs a few runs of mostly (count)0 instead of a position per cell.
+ *
+ * A turn is encoded once, from the board's change history since the last
+ * frame, into one frame that the server hands to every watcher. Nothing
+ * is encoded for sessions nobody watches. If the history no longer
+ * reaches back to the last frame, the turn is sent as a keyframe.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#include <stdlib.h>
+
+#include "server/channel.h"
+
+/**
+ * This function initializes a channel without watchers.
+ *
+ * @param channel the channel to initialize
+ */
+void channel__init(struct Channel *channel) {
+  channel->watchers = NULL;
+  channel->num_watchers = 0;
+  channel->capacity = 0;
+  channel->generation = 0;
+  channel->state = "play";
+  channel->offsets = NULL;
+  channel->num_offsets = 0;
+  buffer__init(&channel->scratch);
+}
+
+/**
+ * This function frees the channel. The watchers themselves are left to
+ * the server.
+ *
+ * @param channel the channel to be freed
+ */
+void channel__destruct(struct Channel *channel) {
+  free(channel->watchers);
+  free(channel->offsets);
+  buffer__destruct(&channel->scratch);
+  channel__init(channel);
+}
+
+/**
+ * This function adds a watcher to the channel.
+ *
+ * @param watcher the connection to send the frames to
+ * @param channel the channel to watch
+ *
+ * @return the slot of the watcher, or -1 if out of memory
+ */
+int channel__add_watcher(struct Connection *watcher, struct Channel *channel) {
+  if (channel->num_watchers == channel->capacity) {
+    int capacity = channel->capacity == 0 ? 4 : channel->capacity * 2;
+    struct Connection **watchers =
+        (struct Connection **)realloc(channel->watchers, capacity * sizeof(struct Connection *));
+    if (watchers == NULL) {
+      return -1;
+    }
+    channel->watchers = watchers;
+    channel->capacity = capacity;
+  }
+  channel->watchers[channel->num_watchers] = watcher;
+  return channel->num_watchers++;
+}
+
+/**
+ * This function removes the watcher in a slot. The last watcher moves
+ * into the slot, and is returned so its owner can update its slot.
+ *
+ * @param slot the slot of the watcher
+ * @param channel the channel
+ *
+ * @return the watcher moved into the slot, or NULL if none moved
+ */
+struct Connection *channel__remove_watcher(int slot, struct Channel *channel) {
+  channel->num_watchers--;
+  if (slot == channel->num_watchers) {
+    return NULL;
+  }
+  channel->watchers[slot] = channel->watchers[channel->num_watchers];
+  return channel->watchers[slot];
+}
+
+// a value being repeated, not written yet
+struct ChannelRun {
+    char value;
+    int  count;
+};
+
+/**
+ * This function writes the pending repeat of a value to the frame being
+ * encoded, as (count)value if it is long enough.
+ *
+ * @param run the pending repeat, emptied
+ * @param channel the channel encoding
+ */
+static void channel__flush_run(struct ChannelRun *run, struct Channel *channel) {
+  if (run->count >= CHANNEL_RUN_MIN) {
+    buffer__printf(&channel->scratch, "(%d)%c", run->count, run->value);
+  } else {
+    char values[CHANNEL_RUN_MIN];
+    for (int i = 0; i < run->count; i++) {
+      values[i] = run->value;
+    }
+    buffer__append(values, run->count, &channel->scratch);
+  }
+  run->count = 0;
+}
+
+/**
+ * This function adds visible values to the frame being encoded. Repeats
+ * carry on from one call to the next, so a repeat going on past the end
+ * of a row is still written once.
+ *
+ * @param cells the values
+ * @param length the number of values
+ * @param run the pending repeat
+ * @param channel the channel encoding
+ */
+static void channel__append_cells(const char *cells, int length, struct ChannelRun *run, struct Channel *channel) {
+  for (int i = 0; i < length; i++) {
+    if (run->count > 0 && cells[i] == run->value) {
+      run->count++;
+    } else {
+      channel__flush_run(run, channel);
+      run->value = cells[i];
+      run->count = 1;
+    }
+  }
+}
+
+/**
+ * This function turns the frame being encoded into a frame to send.
+ *
+ * @param channel the channel encoding
+ *
+ * @return the frame, or NULL if out of memory
+ */
+static struct Frame *channel__finish(struct Channel *channel) {
+  struct Frame *frame = frame__create(channel->scratch.data, channel->scratch.length);
+
+  channel->scratch.length = 0;
+  return frame;
+}
+
+/**
+ * This function encodes a keyframe of the game: its whole visible board,
+ * row after row. A NULL game encodes an empty board. Later deltas are
+ * taken from here.
+ *
+ * @param game the watched game, or NULL if the session has none
+ * @param channel the channel of the game
+ *
+ * @return the frame, or NULL if out of memory
+ */
+struct Frame *channel__keyframe(struct Game *game, struct Channel *channel) {
+  struct BoardView view;
+
+  channel->scratch.length = 0;
+  if (game == NULL) {
+    buffer__printf(&channel->scratch, "k 0 0 0 none\n");
+    return channel__finish(channel);
+  }
+
+  struct ChannelRun run = {0};
+  board__get_view(&view, &game->board);
+  channel->generation = view.generation;
+  buffer__printf(&channel->scratch, "k %d %d %d %s ", game->turns, view.rows, view.cols, channel->state);
+  for (int x = 0; x < view.rows; x++) {
+    channel__append_cells(view.cells + x * view.stride, view.cols, &run, channel);
+  }
+  channel__flush_run(&run, channel);
+  buffer__append("\n", 1, &channel->scratch);
+  return channel__finish(channel);
+}
+
+/**
+ * This function compares two positions for qsort.
+ */
+static int channel__compare(const void *a, const void *b) {
+  int left = *(const int *)a;
+  int right = *(const int *)b;
+  return (left > right) - (left < right);
+}
+
+/**
+ * This function encodes what changed in the game since the last frame of
+ * the channel, and the state it is in now. The changed cells are sorted
+ * and joined into runs of consecutive positions, each written with the
+ * values the cells have now. Returns a keyframe instead when the board's
+ * history no longer reaches back to the last frame.
+ *
+ * @param game the watched game
+ * @param state play, win, lose or quit
+ * @param channel the channel of the game
+ *
+ * @return the frame, or NULL if out of memory
+ */
+struct Frame *channel__delta(struct Game *game, const char *state, struct Channel *channel) {
+  struct BoardView view;
+  int tiles = board__get_x(&game->board) * board__get_y(&game->board);
+
+  channel->state = state;
+  if (channel->num_offsets < tiles) {
+    int *offsets = (int *)realloc(channel->offsets, tiles * sizeof(int));
+    if (offsets == NULL) {
+      return NULL;
+    }
+    channel->offsets = offsets;
+    channel->num_offsets = tiles;
+  }
+
+  int count = board__get_changes_since(channel->generation, channel->offsets, tiles, &game->board);
+  if (count < 0) {
+    return channel__keyframe(game, channel);
+  }
+  board__get_view(&view, &game->board);
+  channel->generation += count;
+
+  // positions in row order, each once
+  for (int i = 0; i < count; i++) {
+    channel->offsets[i] = channel->offsets[i] / view.stride * view.cols + channel->offsets[i] % view.stride;
+  }
+  qsort(channel->offsets, count, sizeof(int), channel__compare);
+  int unique = 0;
+  int runs = 0;
+  for (int i = 0; i < count; i++) {
+    if (unique == 0 || channel->offsets[i] != channel->offsets[unique - 1]) {
+      runs += unique == 0 || channel->offsets[i] != channel->offsets[unique - 1] + 1;
+      channel->offsets[unique++] = channel->offsets[i];
+    }
+  }
+
+  channel->scratch.length = 0;
+  buffer__printf(&channel->scratch, "d %d %s %d", game->turns, state, runs);
+  for (int i = 0; i < unique;) {
+    int run = 1;
+    while (i + run < unique && channel->offsets[i + run] == channel->offsets[i] + run) {
+      run++;
+    }
+    struct ChannelRun values = {0};
+    buffer__printf(&channel->scratch, " %d:", channel->offsets[i]);
+    // a run may go on into the next rows, which the view does not keep next to each other
+    for (int done = 0; done < run;) {
+      int x = (channel->offsets[i] + done) / view.cols;
+      int y = (channel->offsets[i] + done) % view.cols;
+      int length = run - done < view.cols - y ? run - done : view.cols - y;
+      channel__append_cells(view.cells + x * view.stride + y, length, &values, channel);
+      done += length;
+    }
+    channel__flush_run(&values, channel);
+    i += run;
+  }
+  buffer__append("\n", 1, &channel->scratch);
+  return channel__finish(channel);
+}
@@ -0,0 +1,38 @@
+/**
+ * @file channel.h
+ * @brief The header for channel.
+ */
+#ifndef CHANNEL_H
+#define CHANNEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "game/game.h"
+#include "server/buffer.h"
+#include "server/frame.h"
+
+#define CHANNEL_RUN_MIN 4 // repeats of a value written as (count)value instead of one by one
+
+struct Connection;
+
+// the spectators of a session, and what they have been sent
+struct Channel {
+    struct Connection** watchers;
+    int                 num_watchers;
+    int                 capacity;
+    uint64_t            generation;  // of the board when the last frame was encoded
+    const char*         state;       // play, win, lose or quit
+    int*                offsets;     // cells changed since generation, for encoding
+    int                 num_offsets; // room in offsets
+    struct Buffer       scratch;     // the frame being encoded
+};
+
+void               channel__init(struct Channel* channel);
+void               channel__destruct(struct Channel* channel);
+int                channel__add_watcher(struct Connection* watcher, struct Channel* channel);
+struct Connection* channel__remove_watcher(int slot, struct Channel* channel);
+struct Frame*      channel__keyframe(struct Game* game, struct Channel* channel);
+struct Frame*      channel__delta(struct Game* game, const char* state, struct Channel* channel);
+
+#endif // CHANNEL_H
@@ -0,0 +1,170 @@
+/**
+ * @file frame.c
+ * @brief Implementation for shared output frames.
+ *
+ * A frame is a block of encoded output, such as a spectator update, that
+ * many connections send. Each connection keeps a queue of the frames it
+ * has not written yet.
+ *
+ * Design Philosophy:
+ *
+ * Output going to many connections is encoded once. The frame is counted
+ * by reference and every queue holding it points at the same bytes, so
+ * fanning it out to thousands of connections copies nothing; the socket
+ * writes read straight from the frame. The server runs on one thread, so
+ * the counts are plain ints.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "server/frame.h"
+
+/**
+ * This function creates a frame holding a copy of the given bytes, with
+ * one reference for the caller.
+ *
+ * @param data the bytes of the frame
+ * @param length the number of bytes
+ *
+ * @return the frame, or NULL if out of memory
+ */
+struct Frame *frame__create(const char *data, size_t length) {
+  struct Frame *frame = (struct Frame *)malloc(sizeof(struct Frame) + length);
+
+  if (frame == NULL) {
+    return NULL;
+  }
+  frame->refs = 1;
+  frame->length = length;
+  memcpy(frame->data, data, length);
+  return frame;
+}
+
+/**
+ * This function takes another reference to a frame.
+ *
+ * @param frame the frame
+ */
+void frame__retain(struct Frame *frame) {
+  frame->refs++;
+}
+
+/**
+ * This function gives up a reference to a frame, and frees it when it
+ * was the last one.
+ *
+ * @param frame the frame, or NULL
+ */
+void frame__release(struct Frame *frame) {
+  if (frame != NULL && --frame->refs == 0) {
+    free(frame);
+  }
+}
+
+/**
+ * This function initializes an empty queue.
+ *
+ * @param queue the queue to initialize
+ */
+void frame_queue__init(struct FrameQueue *queue) {
+  queue->frames = NULL;
+  queue->head = 0;
+  queue->count = 0;
+  queue->capacity = 0;
+  queue->offset = 0;
+}
+
+/**
+ * This function releases every frame left in the queue and frees it.
+ *
+ * @param queue the queue to be freed
+ */
+void frame_queue__destruct(struct FrameQueue *queue) {
+  for (int i = 0; i < queue->count; i++) {
+    frame__release(frame_queue__get(i, queue));
+  }
+  free(queue->frames);
+  frame_queue__init(queue);
+}
+
+/**
+ * This function adds a frame to the end of the queue, taking a reference
+ * to it.
+ *
+ * @param frame the frame to add
+ * @param queue the queue to add to
+ *
+ * @return true if added; false if out of memory
+ */
+bool frame_queue__push(struct Frame *frame, struct FrameQueue *queue) {
+  if (queue->count == queue->capacity) {
+    int capacity = queue->capacity == 0 ? 8 : queue->capacity * 2;
+    struct Frame **frames = (struct Frame **)malloc(capacity * sizeof(struct Frame *));
+    if (frames == NULL) {
+      return false;
+    }
+    for (int i = 0; i < queue->count; i++) {
+      frames[i] = frame_queue__get(i, queue);
+    }
+    free(queue->frames);
+    queue->frames = frames;
+    queue->head = 0;
+    queue->capacity = capacity;
+  }
+
+  frame__retain(frame);
+  queue->frames[(queue->head + queue->count) % queue->capacity] = frame;
+  queue->count++;
+  return true;
+}
+
+/**
+ * This function returns the frame at a position of the queue, 0 the
+ * oldest.
+ *
+ * @param i the position, below the count of the queue
+ * @param queue the queue
+ *
+ * @return the frame
+ */
+struct Frame *frame_queue__get(int i, struct FrameQueue *queue) {
+  return queue->frames[(queue->head + i) % queue->capacity];
+}
+
+/**
+ * This function marks bytes from the front of the queue as written,
+ * releasing the frames written whole.
+ *
+ * @param length the number of bytes written
+ * @param queue the queue to consume from
+ */
+void frame_queue__consume(size_t length, struct FrameQueue *queue) {
+  length += queue->offset;
+  while (queue->count > 0 && length >= queue->frames[queue->head]->length) {
+    length -= queue->frames[queue->head]->length;
+    frame__release(queue->frames[queue->head]);
+    queue->head = (queue->head + 1) % queue->capacity;
+    queue->count--;
+  }
+  queue->offset = queue->count > 0 ? length : 0;
+}
+
+/**
+ * This function releases every frame not started yet, for a connection
+ * too far behind to catch up. A frame partly written stays, so the
+ * connection never gets half a line.
+ *
+ * @param queue the queue to drop from
+ */
+void frame_queue__drop_unstarted(struct FrameQueue *queue) {
+  int keep = queue->offset > 0 ? 1 : 0;
+
+  for (int i = keep; i < queue->count; i++) {
+    frame__release(frame_queue__get(i, queue));
+  }
+  queue->count = queue->count < keep ? queue->count : keep;
+}
@@ -0,0 +1,40 @@
+/**
+ * @file frame.h
+ * @brief The header for frame.
+ */
+#ifndef FRAME_H
+#define FRAME_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define FRAME_QUEUE_MAX 256 // frames a connection may have waiting before it is sent a keyframe instead
+
+// encoded output shared by every connection it is sent to
+struct Frame {
+    int    refs;
+    size_t length;
+    char   data[];
+};
+
+// the frames a connection still has to write, oldest first
+struct FrameQueue {
+    struct Frame** frames;
+    int            head;
+    int            count;
+    int            capacity;
+    size_t         offset; // bytes of the head frame already written
+};
+
+struct Frame* frame__create(const char* data, size_t length);
+void          frame__retain(struct Frame* frame);
+void          frame__release(struct Frame* frame);
+
+void          frame_queue__init(struct FrameQueue* queue);
+void          frame_queue__destruct(struct FrameQueue* queue);
+bool          frame_queue__push(struct Frame* frame, struct FrameQueue* queue);
+struct Frame* frame_queue__get(int i, struct FrameQueue* queue);
+void          frame_queue__consume(size_t length, struct FrameQueue* queue);
+void          frame_queue__drop_unstarted(struct FrameQueue* queue);
+
+#endif // FRAME_H
@@ -0,0 +1,650 @@
+/**
+ * @file loadgen.c
+ * @brief Implementation for the server load generator.
+ *
+ * The load generator plays many short sessions against a running server
+ * and reports how many sessions per second it completed and how long the
+ * server took to answer each command.
+ *
+ * Design Philosophy:
+ *
+ * A session is one connection: start a 9x9 game, reveal up to
+ * LOADGEN_MAX_COMMANDS random cells until the game ends, quit and close.
+ * Many sessions run at once from one epoll loop, each with one command in
+ * flight, so the measured latency is the time between sending a command
+ * and reading its reply line.
+ *
+ * The spectator test has one player and many spectators watching it. The
+ * player makes a move and waits for its reply, and the turn is timed
+ * until every spectator has read the frame of the move. The first
+ * spectator also decodes every frame, and its board is checked against
+ * the player's at the end.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE // accept4, clock_gettime
+#endif
+
+#include <stdio.h>
+
+#include "server/loadgen.h"
+
+#if defined(__linux__)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "rng/rng.h"
+#include "server/buffer.h"
+#include "server/server.h"
+
+struct Client {
+    int      fd;
+    int      sent;      // commands sent in this session
+    bool     quitting;  // the quit command is in flight
+    int      in_length;
+    char     in[SERVER_LINE_MAX];
+    uint64_t sent_at;   // nanoseconds
+};
+
+struct Spectator {
+    int       fd;
+    long long lines;
+    long long bytes;
+};
+
+// the board as the first spectator rebuilds it from its frames
+struct SpectatorBoard {
+    struct Buffer line;  // the line being read
+    char*         cells; // rows * cols visible values
+    int           rows;
+    int           cols;
+    long long     keyframes;
+    long long     deltas;
+    bool          valid; // every frame decoded
+};
+
+struct LoadStats {
+    uint64_t* latencies;
+    size_t    count;
+    size_t    capacity;
+    int       started;
+    int       finished;
+    int       failed;
+};
+
+/**
+ * This function returns the monotonic clock in nanoseconds.
+ *
+ * @return the current time
+ */
+static uint64_t loadgen__now() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t) now.tv_sec * 1000000000ull + (uint64_t) now.tv_nsec;
+}
+
+/**
+ * This function sends one command line on a client and remembers when.
+ * Returns false if the send failed.
+ *
+ * @param line the command line, with its line ending
+ * @param client the client to send on
+ *
+ * @return true if sent; false otherwise
+ */
+static bool loadgen__send(const char *line, struct Client *client) {
+  size_t length = strlen(line);
+  client->sent_at = loadgen__now();
+  return send(client->fd, line, length, MSG_NOSIGNAL) == (ssize_t) length;
+}
+
+/**
+ * This function starts a new session on a client slot: connects and
+ * asks for a new game. Returns false if the server could not be reached.
+ *
+ * @param address the server address
+ * @param epoll_fd the epoll instance
+ * @param client the client slot
+ * @param stats the statistics to update
+ *
+ * @return true if the session started; false otherwise
+ */
+static bool loadgen__start(const char *address, int epoll_fd, struct Client *client, struct LoadStats *stats) {
+  client->fd = server__open_socket(address, false);
+  if (client->fd < 0) {
+    return false;
+  }
+  fcntl(client->fd, F_SETFL, fcntl(client->fd, F_GETFL) | O_NONBLOCK);
+  client->sent = 0;
+  client->quitting = false;
+  client->in_length = 0;
+
+  struct epoll_event event;
+  event.events = EPOLLIN;
+  event.data.ptr = client;
+  epoll_ctl(epoll_fd, EPOLL_CTL_ADD, client->fd, &event);
+
+  stats->started++;
+  if (!loadgen__send("n 9 9 10\n", client)) {
+    close(client->fd);
+    return false;
+  }
+  return true;
+}
+
+/**
+ * This function records the latency of the command that was just
+ * answered.
+ *
+ * @param client the client that got a reply
+ * @param stats the statistics to update
+ */
+static void loadgen__record(struct Client *client, struct LoadStats *stats) {
+  if (stats->count == stats->capacity) {
+    size_t capacity = stats->capacity == 0 ? 4096 : stats->capacity * 2;
+    uint64_t *latencies = (uint64_t *)realloc(stats->latencies, capacity * sizeof(uint64_t));
+    if (latencies == NULL) {
+      return;
+    }
+    stats->latencies = latencies;
+    stats->capacity = capacity;
+  }
+  stats->latencies[stats->count++] = loadgen__now() - client->sent_at;
+}
+
+/**
+ * This function handles one reply line and sends the next command of
+ * the session. Returns false once the session is over.
+ *
+ * @param line the reply line
+ * @param client the client that got the reply
+ * @param rng the generator for the moves
+ *
+ * @return true if the session goes on; false if it is finished
+ */
+static bool loadgen__next(const char *line, struct Client *client, struct Rng *rng) {
+  char command[32];
+
+  if (client->quitting) {
+    return false;
+  }
+  if (strncmp(line, "lose", 4) == 0 || strncmp(line, "win", 3) == 0 || client->sent == LOADGEN_MAX_COMMANDS) {
+    client->quitting = true;
+    return loadgen__send("q\n", client);
+  }
+
+  client->sent++;
+  snprintf(command, sizeof(command), "r %d %d\n", rng__below(9, rng), rng__below(9, rng));
+  return loadgen__send(command, client);
+}
+
+/**
+ * This function compares two latencies for qsort.
+ */
+static int loadgen__compare(const void *a, const void *b) {
+  uint64_t left = *(const uint64_t *)a;
+  uint64_t right = *(const uint64_t *)b;
+  return (left > right) - (left < right);
+}
+
+/**
+ * This function prints the results of a load test.
+ *
+ * @param stats the statistics
+ * @param seconds the wall time of the test
+ */
+static void loadgen__report(struct LoadStats *stats, double seconds) {
+  printf("Sessions: %d finished, %d failed in %.3f s\n", stats->finished, stats->failed, seconds);
+  printf("Sessions/sec: %.0f\n", stats->finished / seconds);
+  printf("Commands: %zu (%.0f/sec)\n", stats->count, stats->count / seconds);
+  if (stats->count == 0) {
+    return;
+  }
+
+  qsort(stats->latencies, stats->count, sizeof(uint64_t), loadgen__compare);
+  printf(
+      "Latency us: p50 %.1f  p90 %.1f  p99 %.1f  max %.1f\n",
+      stats->latencies[stats->count / 2] / 1000.0,
+      stats->latencies[stats->count * 9 / 10] / 1000.0,
+      stats->latencies[stats->count * 99 / 100] / 1000.0,
+      stats->latencies[stats->count - 1] / 1000.0
+  );
+}
+
+/**
+ * This function runs a load test against the server at the given
+ * address. Returns the exit code of the program.
+ *
+ * @param address the server address, tcp:<port> or unix:<path>
+ * @param sessions the total number of sessions to play
+ * @param concurrency the number of sessions in flight at once
+ *
+ * @return the exit code
+ */
+int loadgen__run(const char *address, int sessions, int concurrency) {
+  struct epoll_event events[SERVER_MAX_EVENTS];
+  struct LoadStats stats = {0};
+  struct Rng rng;
+
+  if (sessions < 1 || concurrency < 1) {
+    fprintf(stderr, "Sessions and concurrency must be positive\n");
+    return 1;
+  }
+  if (concurrency > sessions) {
+    concurrency = sessions;
+  }
+
+  struct Client *clients = (struct Client *)calloc(concurrency, sizeof(struct Client));
+  int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  int active = 0;
+  rng__seed(42, &rng);
+
+  uint64_t start = loadgen__now();
+  for (int i = 0; i < concurrency; i++) {
+    if (!loadgen__start(address, epoll_fd, &clients[i], &stats)) {
+      fprintf(stderr, "Could not connect to %s\n", address);
+      stats.failed++;
+      break;
+    }
+    active++;
+  }
+
+  while (active > 0) {
+    int count = epoll_wait(epoll_fd, events, SERVER_MAX_EVENTS, 1000);
+    if (count < 0 && errno != EINTR) {
+      break;
+    }
+    for (int i = 0; i < count; i++) {
+      struct Client *client = (struct Client *)events[i].data.ptr;
+      bool alive = true;
+      ssize_t received = recv(client->fd, client->in + client->in_length, SERVER_LINE_MAX - client->in_length, 0);
+
+      if (received <= 0) {
+        alive = received < 0 && (errno == EAGAIN || errno == EINTR);
+        if (!alive) {
+          stats.failed++;
+        }
+      } else {
+        client->in_length += (int) received;
+        char *newline = memchr(client->in, '\n', client->in_length);
+        if (newline != NULL) {
+          *newline = '\0';
+          loadgen__record(client, &stats);
+          alive = loadgen__next(client->in, client, &rng);
+          if (!alive) {
+            stats.finished++;
+          }
+          client->in_length = 0; // one command in flight, so at most one line
+        } else if (client->in_length == SERVER_LINE_MAX) {
+          alive = false;
+          stats.failed++;
+        }
+      }
+
+      if (!alive) {
+        close(client->fd); // also removes it from epoll
+        active--;
+        if (stats.started < sessions) {
+          if (loadgen__start(address, epoll_fd, client, &stats)) {
+            active++;
+          } else {
+            stats.failed++;
+          }
+        }
+      }
+    }
+  }
+  double seconds = (loadgen__now() - start) / 1e9;
+
+  loadgen__report(&stats, seconds);
+  close(epoll_fd);
+  free(clients);
+  free(stats.latencies);
+  return stats.failed == 0 ? 0 : 1;
+}
+
+//----------------//
+//   SPECTATORS   //
+//----------------//
+
+/**
+ * This function decodes visible values written by a spectator frame,
+ * with (count)value for repeats, into consecutive cells of the board.
+ * Returns the text after the values, or NULL if they do not fit.
+ *
+ * @param text the values
+ * @param position the first cell, row * cols + col
+ * @param board the board being rebuilt
+ *
+ * @return the rest of the text, or NULL if invalid
+ */
+static const char *loadgen__decode_cells(const char *text, int position, struct SpectatorBoard *board) {
+  int size = board->rows * board->cols;
+
+  while (*text != '\0' && *text != ' ') {
+    int count = 1;
+    if (*text == '(') {
+      char *end;
+      count = (int) strtol(text + 1, &end, 10);
+      if (*end != ')' || count < 1) {
+        return NULL;
+      }
+      text = end + 1;
+    }
+    if (*text == '\0' || position + count > size) {
+      return NULL;
+    }
+    memset(board->cells + position, *text, count);
+    position += count;
+    text++;
+  }
+  return text;
+}
+
+/**
+ * This function applies one line the first spectator read to its board.
+ * Lines that are not frames, like the reply to the watch command, are
+ * skipped.
+ *
+ * @param line the line, without its line ending
+ * @param board the board being rebuilt
+ */
+static void loadgen__decode(const char *line, struct SpectatorBoard *board) {
+  int offset = 0;
+
+  if (line[0] == 'k') {
+    int turn;
+    int rows;
+    int cols;
+    if (sscanf(line, "k %d %d %d %*s %n", &turn, &rows, &cols, &offset) < 3 || offset == 0) {
+      board->valid = false;
+      return;
+    }
+    free(board->cells);
+    board->rows = rows;
+    board->cols = cols;
+    board->cells = (char *)malloc((size_t) rows * cols + 1);
+    if (board->cells == NULL || loadgen__decode_cells(line + offset, 0, board) == NULL) {
+      board->valid = false;
+    }
+    board->keyframes++;
+  } else if (line[0] == 'd') {
+    int turn;
+    int runs;
+    if (board->cells == NULL || sscanf(line, "d %d %*s %d%n", &turn, &runs, &offset) < 2) {
+      board->valid = false;
+      return;
+    }
+    const char *text = line + offset;
+    for (int i = 0; i < runs && text != NULL; i++) {
+      char *end;
+      int position = (int) strtol(text, &end, 10);
+      text = *end == ':' ? loadgen__decode_cells(end + 1, position, board) : NULL;
+    }
+    if (text == NULL) {
+      board->valid = false;
+    }
+    board->deltas++;
+  }
+}
+
+/**
+ * This function reads one reply line of the player, blocking.
+ *
+ * @param fd the player's socket
+ * @param line where to store the line, without its line ending
+ *
+ * @return true if a line was read; false if the connection failed
+ */
+static bool loadgen__read_line(int fd, struct Buffer *line) {
+  char c;
+
+  line->length = 0;
+  for (;;) {
+    ssize_t received = recv(fd, &c, 1, 0);
+    if (received <= 0) {
+      if (received < 0 && errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    if (c == '\n') {
+      return buffer__append("", 1, line);
+    }
+    buffer__append(&c, 1, line);
+  }
+}
+
+/**
+ * This function reads what the spectators got until each has read the
+ * given number of lines.
+ *
+ * @param lines the lines every spectator must have read
+ * @param epoll_fd the epoll instance of the spectators
+ * @param spectators the spectators
+ * @param count the number of spectators
+ * @param board the board the first spectator rebuilds
+ *
+ * @return true once all have; false if one failed or the server stalled
+ */
+static bool loadgen__await(long long lines, int epoll_fd, struct Spectator *spectators, int count,
+                           struct SpectatorBoard *board) {
+  struct epoll_event events[SERVER_MAX_EVENTS];
+  static char data[1 << 16];
+  int behind = 0;
+
+  for (int i = 0; i < count; i++) {
+    behind += spectators[i].lines < lines;
+  }
+  while (behind > 0) {
+    int ready = epoll_wait(epoll_fd, events, SERVER_MAX_EVENTS, 5000);
+    if (ready <= 0) {
+      if (ready < 0 && errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    for (int i = 0; i < ready; i++) {
+      struct Spectator *spectator = (struct Spectator *)events[i].data.ptr;
+      ssize_t received;
+      while ((received = recv(spectator->fd, data, sizeof(data), 0)) > 0) {
+        bool was_behind = spectator->lines < lines;
+        spectator->bytes += received;
+        for (char *at = data; (at = memchr(at, '\n', data + received - at)) != NULL; at++) {
+          spectator->lines++;
+        }
+        if (spectator == spectators) {
+          for (ssize_t j = 0; j < received; j++) {
+            if (data[j] != '\n') {
+              buffer__append(data + j, 1, &board->line);
+              continue;
+            }
+            buffer__append("", 1, &board->line);
+            loadgen__decode(board->line.data, board);
+            board->line.length = 0;
+          }
+        }
+        behind -= was_behind && spectator->lines >= lines;
+      }
+      if (received == 0 || (errno != EAGAIN && errno != EINTR)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * This function runs the spectator test against the server at the given
+ * address: one player plays random reveals on a 64x64 board with 400
+ * mines, starting a new game whenever one ends, while the spectators
+ * watch. Returns the exit code of the program.
+ *
+ * @param address the server address, tcp:<port> or unix:<path>
+ * @param spectators the number of spectators
+ * @param turns the number of moves the player makes
+ *
+ * @return the exit code
+ */
+int loadgen__spectate(const char *address, int spectators, int turns) {
+  struct Buffer line;
+  struct SpectatorBoard board = {0};
+  struct Rng rng;
+  unsigned long long id = 0;
+  const char *new_game = "n 64 64 400\n";
+
+  if (spectators < 1 || turns < 1) {
+    fprintf(stderr, "Spectators and turns must be positive\n");
+    return 1;
+  }
+  buffer__init(&line);
+  buffer__init(&board.line);
+  board.valid = true;
+  rng__seed(7, &rng);
+
+  int player = server__open_socket(address, false);
+  if (player < 0 || send(player, new_game, strlen(new_game), MSG_NOSIGNAL) < 0 ||
+      !loadgen__read_line(player, &line) || send(player, "i\n", 2, MSG_NOSIGNAL) < 0 ||
+      !loadgen__read_line(player, &line) || sscanf(line.data, "id %llu", &id) != 1) {
+    fprintf(stderr, "Could not start a game on %s\n", address);
+    return 1;
+  }
+
+  struct Spectator *watchers = (struct Spectator *)calloc(spectators, sizeof(struct Spectator));
+  uint64_t *latencies = (uint64_t *)malloc(turns * sizeof(uint64_t));
+  int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  int connected = 0;
+  bool ok = watchers != NULL && latencies != NULL;
+  char command[32];
+
+  snprintf(command, sizeof(command), "w %llu\n", id);
+  for (; ok && connected < spectators; connected++) {
+    struct Spectator *spectator = &watchers[connected];
+    spectator->fd = server__open_socket(address, false);
+    if (spectator->fd < 0 || send(spectator->fd, command, strlen(command), MSG_NOSIGNAL) < 0) {
+      fprintf(stderr, "Could not connect spectator %d to %s\n", connected, address);
+      ok = false;
+      break;
+    }
+    fcntl(spectator->fd, F_SETFL, fcntl(spectator->fd, F_GETFL) | O_NONBLOCK);
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.ptr = spectator;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, spectator->fd, &event);
+  }
+
+  // the reply to the watch command, then a keyframe
+  long long expected = 2;
+  ok = ok && loadgen__await(expected, epoll_fd, watchers, connected, &board);
+  long long setup_bytes = 0;
+  for (int i = 0; i < connected; i++) {
+    setup_bytes += watchers[i].bytes;
+  }
+
+  int played = 0;
+  uint64_t start = loadgen__now();
+  while (ok && played < turns) {
+    uint64_t sent_at = loadgen__now();
+    snprintf(command, sizeof(command), "r %d %d\n", rng__below(64, &rng), rng__below(64, &rng));
+    if (send(player, command, strlen(command), MSG_NOSIGNAL) < 0 || !loadgen__read_line(player, &line)) {
+      ok = false;
+      break;
+    }
+    bool over = strncmp(line.data, "win", 3) == 0 || strncmp(line.data, "lose", 4) == 0;
+    if (strncmp(line.data, "ok", 2) != 0 && !over) {
+      continue; // a revealed tile, nothing to watch
+    }
+    expected++;
+    if (over) {
+      ok = send(player, new_game, strlen(new_game), MSG_NOSIGNAL) > 0 && loadgen__read_line(player, &line);
+      expected++;
+    }
+    ok = ok && loadgen__await(expected, epoll_fd, watchers, connected, &board);
+    latencies[played++] = loadgen__now() - sent_at;
+  }
+  double seconds = (loadgen__now() - start) / 1e9;
+
+  // the first spectator's board must be the player's
+  bool matches = false;
+  if (ok && send(player, "b\n", 2, MSG_NOSIGNAL) > 0 && loadgen__read_line(player, &line)) {
+    int rows;
+    int cols;
+    int offset = 0;
+    matches = sscanf(line.data, "board %d %d %n", &rows, &cols, &offset) == 2 && board.valid &&
+              board.cells != NULL && rows == board.rows && cols == board.cols &&
+              memcmp(line.data + offset, board.cells, (size_t) rows * cols) == 0;
+  }
+
+  long long bytes = -setup_bytes;
+  for (int i = 0; i < connected; i++) {
+    bytes += watchers[i].bytes;
+    close(watchers[i].fd);
+  }
+  if (player >= 0) {
+    close(player);
+  }
+  close(epoll_fd);
+
+  printf("Spectators: %d, turns: %d in %.3f s\n", connected, played, seconds);
+  if (played > 0) {
+    long long frames = (expected - 2) * connected;
+    qsort(latencies, played, sizeof(uint64_t), loadgen__compare);
+    printf("Frames delivered: %lld (%.0f/sec), %.1f MB (%.1f MB/s), %.0f bytes per frame\n", frames,
+           frames / seconds, bytes / 1e6, bytes / 1e6 / seconds, frames > 0 ? (double) bytes / frames : 0);
+    printf("Keyframes: %lld, deltas: %lld decoded by the first spectator\n", board.keyframes, board.deltas);
+    printf("Turn until all spectators have it, us: p50 %.1f  p90 %.1f  p99 %.1f  max %.1f\n",
+           latencies[played / 2] / 1000.0, latencies[played * 9 / 10] / 1000.0,
+           latencies[played * 99 / 100] / 1000.0, latencies[played - 1] / 1000.0);
+  }
+  printf("First spectator's board %s the player's\n", matches ? "matches" : "DOES NOT match");
+
+  free(watchers);
+  free(latencies);
+  free(board.cells);
+  buffer__destruct(&board.line);
+  buffer__destruct(&line);
+  return ok && matches ? 0 : 1;
+}
+
+#else
+
+/**
+ * This function reports that the load generator is not available on
+ * this platform.
+ *
+ * @return the exit code
+ */
+int loadgen__run(const char *address, int sessions, int concurrency) {
+  (void) address;
+  (void) sessions;
+  (void) concurrency;
+  fprintf(stderr, "The load generator needs epoll and is only supported on Linux\n");
+  return 1;
+}
+
+/**
+ * This function reports that the spectator test is not available on
+ * this platform.
+ *
+ * @return the exit code
+ */
+int loadgen__spectate(const char *address, int spectators, int turns) {
+  (void) address;
+  (void) spectators;
+  (void) turns;
+  fprintf(stderr, "The load generator needs epoll and is only supported on Linux\n");
+  return 1;
+}
+
+#endif
@@ -0,0 +1,13 @@
+/**
+ * @file loadgen.h
+ * @brief The header for loadgen.
+ */
+#ifndef LOADGEN_H
+#define LOADGEN_H
+
+#define LOADGEN_MAX_COMMANDS 16
+
+int loadgen__run(const char* address, int sessions, int concurrency);
+int loadgen__spectate(const char* address, int spectators, int turns);
+
+#endif // LOADGEN_H
@@ -0,0 +1,643 @@
+/**
+ * @file server.c
+ * @brief Implementation for the game server.
+ *
+ * The server hosts many independent game sessions in one process. Clients
+ * connect over a loopback TCP port or a Unix socket and play with the
+ * line protocol described in session.c.
+ *
+ * Design Philosophy:
+ *
+ * One thread runs one epoll loop over non-blocking sockets. Every
+ * connection owns a session, an input line buffer and an output buffer.
+ * Input is split into lines and handed to the session; replies are
+ * written right away, and only when the socket is full does the
+ * connection ask epoll for writability. Nothing blocks, so thousands of
+ * idle sessions cost nothing but their memory.
+ *
+ * A connection can watch another's session. The server keeps every
+ * connection in a table by session id to find it, and fans each frame a
+ * session leaves out to its watchers: the frame is queued on every one
+ * of them by reference and written from the same bytes with sendmsg, so
+ * a turn is encoded once however many watch it. A watcher that falls
+ * FRAME_QUEUE_MAX frames behind has them dropped for a fresh keyframe.
+ *
+ * Only Linux has epoll; on other platforms the server reports that it is
+ * not supported.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE // accept4, clock_gettime
+#endif
+
+#include <stdio.h>
+
+#include "server/server.h"
+
+#if defined(__linux__)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "server/buffer.h"
+#include "server/frame.h"
+#include "server/session.h"
+
+struct Connection {
+    int                fd;
+    bool               writing;    // waiting for EPOLLOUT
+    bool               broken;     // a write failed while fanning out, closed at its next event
+    int                in_length;
+    char               in[SERVER_LINE_MAX];
+    struct FrameQueue  frames;     // written before out, which holds only newer replies
+    struct Buffer      out;
+    struct Connection* watching;   // whose session this connection watches, or NULL
+    int                watch_slot; // in the channel of that session
+    struct Connection* next;       // in its bucket of the table
+    struct Session     session;
+};
+
+struct Server {
+    int                listen_fd;
+    int                epoll_fd;
+    uint64_t           next_id;
+    struct Connection* table[SERVER_TABLE_SIZE]; // connections by session id
+};
+
+static volatile sig_atomic_t stopping = 0;
+
+/**
+ * This function handles SIGINT and SIGTERM by asking the loop to stop.
+ *
+ * @param signal the signal number
+ */
+static void server__on_signal(int signal) {
+  (void) signal;
+  stopping = 1;
+}
+
+//--------------------//
+//   SOCKET HELPERS   //
+//--------------------//
+
+/**
+ * This function opens a socket for the given address. The address is
+ * either tcp:<port>, which is always on the loopback interface, or
+ * unix:<path>. A listening socket is bound and non-blocking; a client
+ * socket is connected. Returns -1 on failure.
+ *
+ * @param address the address to open
+ * @param listening true to listen on the address; false to connect to it
+ *
+ * @return the socket, or -1 on failure
+ */
+int server__open_socket(const char *address, bool listening) {
+  struct sockaddr_storage storage;
+  socklen_t length;
+  int fd;
+
+  memset(&storage, 0, sizeof(storage));
+  if (strncmp(address, "tcp:", 4) == 0) {
+    struct sockaddr_in *in = (struct sockaddr_in *)&storage;
+    int port = atoi(address + 4);
+    if (port <= 0 || port > 65535) {
+      fprintf(stderr, "Invalid port: %s\n", address + 4);
+      return -1;
+    }
+    in->sin_family = AF_INET;
+    in->sin_port = htons((uint16_t) port);
+    in->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    length = sizeof(*in);
+  } else if (strncmp(address, "unix:", 5) == 0) {
+    struct sockaddr_un *un = (struct sockaddr_un *)&storage;
+    if (strlen(address + 5) >= sizeof(un->sun_path)) {
+      fprintf(stderr, "Socket path too long: %s\n", address + 5);
+      return -1;
+    }
+    un->sun_family = AF_UNIX;
+    strcpy(un->sun_path, address + 5);
+    length = sizeof(*un);
+  } else {
+    fprintf(stderr, "Unknown address: %s\n", address);
+    return -1;
+  }
+
+  fd = socket(storage.ss_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd < 0) {
+    perror("socket");
+    return -1;
+  }
+
+  if (listening) {
+    int one = 1;
+    if (storage.ss_family == AF_UNIX) {
+      unlink(address + 5);
+    } else {
+      setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    }
+    if (bind(fd, (struct sockaddr *)&storage, length) < 0 || listen(fd, SOMAXCONN) < 0) {
+      perror("bind");
+      close(fd);
+      return -1;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  } else {
+    if (connect(fd, (struct sockaddr *)&storage, length) < 0) {
+      close(fd);
+      return -1;
+    }
+    if (storage.ss_family == AF_INET) {
+      int one = 1;
+      setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+  }
+
+  return fd;
+}
+
+//-----------------//
+//   CONNECTIONS   //
+//-----------------//
+
+/**
+ * This function returns the connection whose session has the given id.
+ *
+ * @param id the session id
+ * @param server the server
+ *
+ * @return the connection, or NULL if none has the id
+ */
+static struct Connection *server__find(uint64_t id, struct Server *server) {
+  struct Connection *connection = server->table[id % SERVER_TABLE_SIZE];
+
+  while (connection != NULL && connection->session.id != id) {
+    connection = connection->next;
+  }
+  return connection;
+}
+
+/**
+ * This function takes a connection out of the table.
+ *
+ * @param connection the connection to take out
+ * @param server the server
+ */
+static void server__unlink(struct Connection *connection, struct Server *server) {
+  struct Connection **link = &server->table[connection->session.id % SERVER_TABLE_SIZE];
+
+  while (*link != connection) {
+    link = &(*link)->next;
+  }
+  *link = connection->next;
+}
+
+/**
+ * This function writes as much pending output as the socket takes,
+ * queued frames first, and asks epoll for writability if some is left.
+ * Returns false if the connection failed.
+ *
+ * @param connection the connection to flush
+ * @param server the server
+ *
+ * @return true if the connection is still usable; false otherwise
+ */
+static bool server__flush(struct Connection *connection, struct Server *server) {
+  struct FrameQueue *frames = &connection->frames;
+  struct iovec iov[SERVER_MAX_IOV];
+
+  while (frames->count > 0) {
+    struct msghdr message = {0};
+    int count = frames->count < SERVER_MAX_IOV ? frames->count : SERVER_MAX_IOV;
+    for (int i = 0; i < count; i++) {
+      struct Frame *frame = frame_queue__get(i, frames);
+      size_t skip = i == 0 ? frames->offset : 0;
+      iov[i].iov_base = frame->data + skip;
+      iov[i].iov_len = frame->length - skip;
+    }
+    message.msg_iov = iov;
+    message.msg_iovlen = count;
+    ssize_t sent = sendmsg(connection->fd, &message, MSG_NOSIGNAL);
+    if (sent < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      if (errno == EAGAIN || errno == EWOULDBLOCK) {
+        break;
+      }
+      return false;
+    }
+    frame_queue__consume((size_t) sent, frames);
+  }
+
+  size_t written = 0;
+  while (frames->count == 0 && written < connection->out.length) {
+    ssize_t sent = send(
+        connection->fd, connection->out.data + written, connection->out.length - written, MSG_NOSIGNAL
+    );
+    if (sent < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      if (errno == EAGAIN || errno == EWOULDBLOCK) {
+        break;
+      }
+      return false;
+    }
+    written += (size_t) sent;
+  }
+  buffer__consume(written, &connection->out);
+
+  bool pending = frames->count > 0 || connection->out.length > 0;
+  if (pending != connection->writing) {
+    struct epoll_event event;
+    event.events = EPOLLIN | (pending ? EPOLLOUT : 0);
+    event.data.ptr = connection;
+    epoll_ctl(server->epoll_fd, EPOLL_CTL_MOD, connection->fd, &event);
+    connection->writing = pending;
+  }
+  return true;
+}
+
+/**
+ * This function marks a connection broken and asks epoll for
+ * writability, so the loop sees it at once and closes it.
+ *
+ * @param connection the connection that failed
+ * @param server the server
+ */
+static void server__break(struct Connection *connection, struct Server *server) {
+  struct epoll_event event;
+
+  connection->broken = true;
+  event.events = EPOLLIN | EPOLLOUT;
+  event.data.ptr = connection;
+  epoll_ctl(server->epoll_fd, EPOLL_CTL_MOD, connection->fd, &event);
+  connection->writing = true;
+}
+
+/**
+ * This function queues a frame on a connection and writes what the
+ * socket takes. Replies still waiting are queued ahead of the frame, so
+ * the connection gets its lines in order. A connection whose write
+ * fails is broken, see server__break.
+ *
+ * @param frame the frame to send, or NULL if it could not be encoded
+ * @param connection the connection to send it on
+ * @param server the server
+ */
+static void server__send(struct Frame *frame, struct Connection *connection, struct Server *server) {
+  if (connection->broken) {
+    return;
+  }
+  if (frame == NULL) {
+    server__break(connection, server);
+    return;
+  }
+  if (connection->out.length > 0) {
+    struct Frame *replies = frame__create(connection->out.data, connection->out.length);
+    if (replies == NULL || !frame_queue__push(replies, &connection->frames)) {
+      frame__release(replies);
+      server__break(connection, server);
+      return;
+    }
+    frame__release(replies);
+    connection->out.length = 0;
+  }
+  if (!frame_queue__push(frame, &connection->frames) || !server__flush(connection, server)) {
+    server__break(connection, server);
+  }
+}
+
+/**
+ * This function sends a frame of a watched session to one of its
+ * watchers. A watcher too far behind gets its unsent frames dropped and
+ * a keyframe instead, which brings it up to date at once.
+ *
+ * @param frame the frame of the session
+ * @param watcher the watcher
+ * @param server the server
+ */
+static void server__send_watched(struct Frame *frame, struct Connection *watcher, struct Server *server) {
+  struct Connection *player = watcher->watching;
+
+  if (watcher->frames.count < FRAME_QUEUE_MAX) {
+    server__send(frame, watcher, server);
+    return;
+  }
+  frame_queue__drop_unstarted(&watcher->frames);
+  struct Frame *keyframe =
+      channel__keyframe(player->session.has_game ? &player->session.game : NULL, &player->session.channel);
+  server__send(keyframe, watcher, server);
+  frame__release(keyframe);
+}
+
+/**
+ * This function stops a connection from watching, if it watches.
+ *
+ * @param connection the watcher
+ */
+static void server__unwatch(struct Connection *connection) {
+  if (connection->watching == NULL) {
+    return;
+  }
+  struct Connection *moved = channel__remove_watcher(connection->watch_slot, &connection->watching->session.channel);
+  if (moved != NULL) {
+    moved->watch_slot = connection->watch_slot;
+  }
+  connection->watching = NULL;
+}
+
+/**
+ * This function answers a request to watch another session: the reply,
+ * then a keyframe of its game. The watchers of a session are all up to
+ * date after every turn, so encoding the keyframe leaves the others'
+ * deltas unchanged.
+ *
+ * @param connection the connection asking
+ * @param server the server
+ */
+static void server__watch(struct Connection *connection, struct Server *server) {
+  struct Connection *player = server__find(connection->session.watch, server);
+
+  connection->session.watch = 0;
+  if (player == NULL || player == connection) {
+    buffer__printf(&connection->out, "err no session\n");
+    return;
+  }
+  server__unwatch(connection);
+  int slot = channel__add_watcher(connection, &player->session.channel);
+  if (slot < 0) {
+    buffer__printf(&connection->out, "err out of memory\n");
+    return;
+  }
+  connection->watching = player;
+  connection->watch_slot = slot;
+  buffer__printf(&connection->out, "ok watching %llu\n", (unsigned long long) player->session.id);
+
+  struct Frame *keyframe =
+      channel__keyframe(player->session.has_game ? &player->session.game : NULL, &player->session.channel);
+  server__send(keyframe, connection, server);
+  frame__release(keyframe);
+}
+
+/**
+ * This function fans the frame the last command of a session left out to
+ * every watcher of the session.
+ *
+ * @param connection the connection of the session
+ * @param server the server
+ */
+static void server__fan_out(struct Connection *connection, struct Server *server) {
+  struct Channel *channel = &connection->session.channel;
+  struct Frame *frame = connection->session.broadcast;
+
+  connection->session.broadcast = NULL;
+  for (int i = 0; i < channel->num_watchers; i++) {
+    server__send_watched(frame, channel->watchers[i], server);
+  }
+  frame__release(frame);
+}
+
+/**
+ * This function closes a connection and frees everything it owns. Its
+ * watchers are told the session is gone and stay connected.
+ *
+ * @param connection the connection to close
+ * @param server the server
+ */
+static void server__close_connection(struct Connection *connection, struct Server *server) {
+  struct Channel *channel = &connection->session.channel;
+
+  server__unwatch(connection);
+  if (channel->num_watchers > 0) {
+    struct Frame *gone = frame__create("gone\n", 5);
+    for (int i = 0; i < channel->num_watchers; i++) {
+      channel->watchers[i]->watching = NULL;
+      server__send(gone, channel->watchers[i], server);
+    }
+    frame__release(gone);
+  }
+  server__unlink(connection, server);
+  close(connection->fd);
+  session__destruct(&connection->session);
+  frame_queue__destruct(&connection->frames);
+  buffer__destruct(&connection->out);
+  free(connection);
+}
+
+/**
+ * This function reads everything available on a connection and handles
+ * each complete line. Returns false if the connection should be closed.
+ *
+ * @param connection the connection to read from
+ * @param server the server
+ *
+ * @return true if the connection stays open; false otherwise
+ */
+static bool server__read(struct Connection *connection, struct Server *server) {
+  for (;;) {
+    ssize_t received = recv(
+        connection->fd, connection->in + connection->in_length, SERVER_LINE_MAX - connection->in_length, 0
+    );
+    if (received == 0) {
+      return false;
+    }
+    if (received < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return errno == EAGAIN || errno == EWOULDBLOCK;
+    }
+
+    int end = connection->in_length + (int) received;
+    int start = 0;
+    for (int i = connection->in_length; i < end; i++) {
+      if (connection->in[i] == '\n') {
+        connection->in[i] = '\0';
+        session__handle_line(connection->in + start, &connection->out, &connection->session);
+        if (connection->session.watch != 0) {
+          server__watch(connection, server);
+        }
+        if (connection->session.broadcast != NULL) {
+          server__fan_out(connection, server);
+        }
+        start = i + 1;
+        if (connection->session.closed) {
+          return true;
+        }
+      }
+    }
+
+    // keep the incomplete line at the front of the buffer
+    connection->in_length = end - start;
+    memmove(connection->in, connection->in + start, connection->in_length);
+    if (connection->in_length == SERVER_LINE_MAX) {
+      buffer__printf(&connection->out, "err line too long\n");
+      connection->session.closed = true;
+      return true;
+    }
+  }
+}
+
+/**
+ * This function accepts every pending connection on the listening
+ * socket, registers it with epoll and adds it to the table.
+ *
+ * @param server the server
+ */
+static void server__accept(struct Server *server) {
+  for (;;) {
+    int fd = accept4(server->listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return;
+    }
+
+    struct Connection *connection = (struct Connection *)malloc(sizeof(struct Connection));
+    if (connection == NULL) {
+      close(fd);
+      continue;
+    }
+    connection->fd = fd;
+    connection->writing = false;
+    connection->broken = false;
+    connection->in_length = 0;
+    frame_queue__init(&connection->frames);
+    buffer__init(&connection->out);
+    connection->watching = NULL;
+    session__init(server->next_id++, &connection->session);
+    connection->next = server->table[connection->session.id % SERVER_TABLE_SIZE];
+    server->table[connection->session.id % SERVER_TABLE_SIZE] = connection;
+
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.ptr = connection;
+    if (epoll_ctl(server->epoll_fd, EPOLL_CTL_ADD, fd, &event) < 0) {
+      server__close_connection(connection, server);
+    }
+  }
+}
+
+//-----------------//
+//   SERVER LOOP   //
+//-----------------//
+
+/**
+ * This function runs the server on the given address until it gets
+ * SIGINT or SIGTERM. Returns the exit code of the program.
+ *
+ * @param address the address to listen on, tcp:<port> or unix:<path>
+ *
+ * @return the exit code
+ */
+int server__run(const char *address) {
+  struct epoll_event events[SERVER_MAX_EVENTS];
+  struct epoll_event event;
+  struct sigaction action;
+
+  struct Server *server = (struct Server *)calloc(1, sizeof(struct Server));
+  if (server == NULL) {
+    return 1;
+  }
+  server->next_id = 1;
+  server->listen_fd = server__open_socket(address, true);
+  if (server->listen_fd < 0) {
+    free(server);
+    return 1;
+  }
+
+  server->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  event.events = EPOLLIN;
+  event.data.ptr = NULL; // the listening socket is the only NULL entry
+  epoll_ctl(server->epoll_fd, EPOLL_CTL_ADD, server->listen_fd, &event);
+
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = server__on_signal;
+  sigaction(SIGINT, &action, NULL);
+  sigaction(SIGTERM, &action, NULL);
+
+  printf("Listening on %s\n", address);
+  fflush(stdout);
+
+  while (!stopping) {
+    int count = epoll_wait(server->epoll_fd, events, SERVER_MAX_EVENTS, -1);
+    for (int i = 0; i < count; i++) {
+      struct Connection *connection = (struct Connection *)events[i].data.ptr;
+      if (connection == NULL) {
+        server__accept(server);
+        continue;
+      }
+
+      bool open = !connection->broken;
+      if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+        open = false;
+      } else if (open && (events[i].events & EPOLLIN)) {
+        open = server__read(connection, server);
+      }
+      if (open) {
+        open = server__flush(connection, server);
+      }
+      bool drained = connection->out.length == 0 && connection->frames.count == 0;
+      if (!open || (connection->session.closed && drained)) {
+        server__close_connection(connection, server);
+      }
+    }
+  }
+
+  printf("\nServed %llu sessions\n", (unsigned long long) (server->next_id - 1));
+  close(server->epoll_fd);
+  close(server->listen_fd);
+  free(server);
+  if (strncmp(address, "unix:", 5) == 0) {
+    unlink(address + 5);
+  }
+  return 0;
+}
+
+#else
+
+/**
+ * This function reports that the server is not available on this
+ * platform.
+ *
+ * @param address the address to listen on
+ *
+ * @return the exit code
+ */
+int server__run(const char *address) {
+  (void) address;
+  fprintf(stderr, "The server needs epoll and is only supported on Linux\n");
+  return 1;
+}
+
+/**
+ * This function reports that sockets are not available on this platform.
+ *
+ * @param address the address to open
+ * @param listening unused
+ *
+ * @return -1
+ */
+int server__open_socket(const char *address, bool listening) {
+  (void) address;
+  (void) listening;
+  return -1;
+}
+
+#endif
@@ -0,0 +1,18 @@
+/**
+ * @file server.h
+ * @brief The header for server.
+ */
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <stdbool.h>
+
+#define SERVER_LINE_MAX   256
+#define SERVER_MAX_EVENTS 1024
+#define SERVER_MAX_IOV    64   // frames written by one sendmsg
+#define SERVER_TABLE_SIZE 4096 // buckets of the table of connections by session id
+
+int server__run(const char* address);
+int server__open_socket(const char* address, bool listening);
+
+#endif // SERVER_H
@@ -0,0 +1,292 @@
+/**
+ * @file session.c
+ * @brief Implementation for the server sessions.
+ *
+ * A session is one client of the server. It owns its own game, and turns
+ * lines of the text protocol into replies.
+ *
+ * Design Philosophy:
+ *
+ * The protocol reuses the terminal commands, one command per line and one
+ * reply line per command:
+ *
+ *   n [rows] [cols] [mines]   new game        -> ok <rows> <cols> <mines>
+ *   r/f/g [row] [col]         reveal/flag/guess -> ok | lose | win <turns> <secs>
+ *   b                         board           -> board <rows> <cols> <cells>
+ *   q                         quit the game   -> ok
+ *   i                         session id      -> id <id>
+ *   w [id]                    watch a session -> ok watching <id>, then the frames of channel.c
+ *   h                         help            -> ok <commands>
+ *   c                         close           -> bye
+ *
+ * Errors reply "err <reason>". Everything a session needs lives in the
+ * session struct, nothing here touches program wide state or prints, so
+ * the server can host any number of sessions side by side. Watching
+ * involves another session, so the session only records the request and
+ * the server answers it; likewise a command that changes a watched game
+ * leaves its frame in the session for the server to fan out.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "server/session.h"
+
+/**
+ * This function initializes a session without a game.
+ *
+ * @param id the id of the session, also used to seed its games
+ * @param session the session to initialize
+ */
+void session__init(uint64_t id, struct Session *session) {
+  session->has_game = false;
+  session->closed = false;
+  session->id = id;
+  session->commands = 0;
+  channel__init(&session->channel);
+  session->broadcast = NULL;
+  session->watch = 0;
+}
+
+/**
+ * This function frees the game of the session, if any.
+ *
+ * @param session the session
+ */
+static void session__free_game(struct Session *session) {
+  if (session->has_game) {
+    board__destruct(&session->game.board);
+    session->has_game = false;
+  }
+}
+
+/**
+ * This function frees the game and the channel of the session. The
+ * server has already let its watchers go.
+ *
+ * @param session the session to be freed
+ */
+void session__destruct(struct Session *session) {
+  session__free_game(session);
+  frame__release(session->broadcast);
+  session->broadcast = NULL;
+  channel__destruct(&session->channel);
+}
+
+/**
+ * This function sends a frame to the spectators of the session, if it
+ * has any, by leaving it for the server. Nothing is encoded for a
+ * session nobody watches; only its state is kept for later keyframes.
+ *
+ * @param state play, win, lose or quit
+ * @param keyframe true to send the whole board; false for what changed
+ * @param session the session
+ */
+static void session__broadcast(const char *state, bool keyframe, struct Session *session) {
+  session->channel.state = state;
+  if (session->channel.num_watchers == 0) {
+    return;
+  }
+  frame__release(session->broadcast);
+  session->broadcast = keyframe ? channel__keyframe(&session->game, &session->channel)
+                                : channel__delta(&session->game, state, &session->channel);
+}
+
+/**
+ * This function parses the next token of a command as an int. Returns
+ * false if the token is missing or not a number.
+ *
+ * @param value where to store the number
+ *
+ * @return true if a number was parsed; false otherwise
+ */
+static bool session__next_int(int *value) {
+  char *token = strtok(NULL, " \t\r");
+  char *end;
+
+  if (token == NULL) {
+    return false;
+  }
+  long parsed = strtol(token, &end, 10);
+  if (*end != '\0' || parsed < -1000000 || parsed > 1000000) {
+    return false;
+  }
+  *value = (int) parsed;
+  return true;
+}
+
+/**
+ * This function starts a new game for the session. The arguments are
+ * optional; without them the game is a 9x9 board with 10 mines.
+ *
+ * @param out the buffer for the reply
+ * @param session the session
+ */
+static void session__new_game(struct Buffer *out, struct Session *session) {
+  int rows = 9;
+  int cols = 9;
+  int mines = 10;
+
+  if (session__next_int(&rows)) {
+    if (!session__next_int(&cols) || !session__next_int(&mines)) {
+      buffer__printf(out, "err usage: n [rows] [cols] [mines]\n");
+      return;
+    }
+  }
+  if (rows < 2 || cols < 2 || rows > SESSION_MAX_SIDE || cols > SESSION_MAX_SIDE ||
+      mines < 1 || mines >= rows * cols) {
+    buffer__printf(out, "err invalid size\n");
+    return;
+  }
+
+  session__free_game(session);
+  if (!game__build_game_seeded(cols, rows, mines, session->id * 0x100000001B3ull + session->commands,
+                               &session->game)) {
+    buffer__printf(out, "err out of memory\n");
+    return;
+  }
+  game__set_start_time(&session->game);
+  session->has_game = true;
+  buffer__printf(out, "ok %d %d %d\n", rows, cols, mines);
+  session__broadcast("play", true, session);
+}
+
+/**
+ * This function runs a reveal, flag or guess command on the session's
+ * game and writes the reply.
+ *
+ * @param command the command character, one of r, f or g
+ * @param out the buffer for the reply
+ * @param session the session
+ */
+static void session__play(char command, struct Buffer *out, struct Session *session) {
+  struct Game *game = &session->game;
+  int x;
+  int y;
+
+  if (!session__next_int(&x) || !session__next_int(&y)) {
+    buffer__printf(out, "err usage: %c [row] [col]\n", command);
+    return;
+  }
+  if (!session->has_game) {
+    buffer__printf(out, "err no game\n");
+    return;
+  }
+
+  switch (game__apply(command, x, y, game)) {
+  case GAME_STATUS_OK:
+    buffer__printf(out, "ok\n");
+    session__broadcast("play", false, session);
+    break;
+  case GAME_STATUS_WIN:
+    buffer__printf(
+        out, "win %d %.0f\n", game->turns, difftime(game__get_end_time(game), game__get_start_time(game))
+    );
+    session__broadcast("win", false, session);
+    break;
+  case GAME_STATUS_LOSS:
+    buffer__printf(out, "lose\n");
+    session__broadcast("lose", false, session);
+    break;
+  case GAME_STATUS_OUT_OF_BOUNDS:
+    buffer__printf(out, "err out of bounds\n");
+    break;
+  case GAME_STATUS_REVEALED:
+    buffer__printf(out, "err revealed\n");
+    break;
+  case GAME_STATUS_FLAGGED:
+    buffer__printf(out, "err flagged\n");
+    break;
+  default:
+    buffer__printf(out, "err no game\n");
+    break;
+  }
+}
+
+/**
+ * This function writes the visible board of the session's game as a
+ * single line, rows in increasing order.
+ *
+ * @param out the buffer for the reply
+ * @param session the session
+ */
+static void session__print_board(struct Buffer *out, struct Session *session) {
+  struct Board *board = &session->game.board;
+
+  if (!session->has_game) {
+    buffer__printf(out, "err no game\n");
+    return;
+  }
+  buffer__printf(out, "board %d %d ", board__get_x(board), board__get_y(board));
+  for (int i = 0; i < board__get_x(board); i++) {
+    buffer__append(board->board_pointer + board__index(i, 0, board), board__get_y(board), out);
+  }
+  buffer__append("\n", 1, out);
+}
+
+/**
+ * This function records which session the client asked to watch, for
+ * the server to answer.
+ *
+ * @param out the buffer for the reply
+ * @param session the session
+ */
+static void session__watch(struct Buffer *out, struct Session *session) {
+  char *token = strtok(NULL, " \t\r");
+  char *end;
+
+  if (token == NULL) {
+    buffer__printf(out, "err usage: w [id]\n");
+    return;
+  }
+  unsigned long long id = strtoull(token, &end, 10);
+  if (*end != '\0' || id == 0) {
+    buffer__printf(out, "err usage: w [id]\n");
+    return;
+  }
+  session->watch = id;
+}
+
+/**
+ * This function processes one line of input from the client and
+ * appends the reply to the output buffer. The line is modified.
+ *
+ * @param line the line without its line ending
+ * @param out the buffer for the reply
+ * @param session the session the line belongs to
+ */
+void session__handle_line(char *line, struct Buffer *out, struct Session *session) {
+  char *input = strtok(line, " \t\r");
+
+  session->commands++;
+  session->watch = 0;
+  if (input == NULL) {
+    buffer__printf(out, "err empty\n");
+  } else if (strncmp(input, "n", 1) == 0) {
+    session__new_game(out, session);
+  } else if (strncmp(input, "r", 1) == 0 || strncmp(input, "f", 1) == 0 || strncmp(input, "g", 1) == 0) {
+    session__play(input[0], out, session);
+  } else if (strncmp(input, "b", 1) == 0) {
+    session__print_board(out, session);
+  } else if (strncmp(input, "q", 1) == 0) {
+    if (session->has_game && !game__get_end(&session->game)) {
+      game__set_end(true, &session->game);
+      session__broadcast("quit", false, session);
+    }
+    buffer__printf(out, "ok\n");
+  } else if (strncmp(input, "i", 1) == 0) {
+    buffer__printf(out, "id %llu\n", (unsigned long long) session->id);
+  } else if (strncmp(input, "w", 1) == 0) {
+    session__watch(out, session);
+  } else if (strncmp(input, "h", 1) == 0) {
+    buffer__printf(out, "ok n r f g b q i w h c\n");
+  } else if (strncmp(input, "c", 1) == 0) {
+    session->closed = true;
+    buffer__printf(out, "bye\n");
+  } else {
+    buffer__printf(out, "err invalid command\n");
+  }
+}
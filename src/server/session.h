@@ -0,0 +1,32 @@
+/**
+ * @file session.h
+ * @brief The header for session.
+ */
+#ifndef SESSION_H
+#define SESSION_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "game/game.h"
+#include "server/buffer.h"
+#include "server/channel.h"
+
+#define SESSION_MAX_SIDE 256
+
+struct Session {
+    struct Game    game;
+    bool           has_game;
+    bool           closed;
+    uint64_t       id;
+    uint64_t       commands;
+    struct Channel channel;   // the spectators of this session
+    struct Frame*  broadcast; // what the last command sends the spectators, for the server to take
+    uint64_t       watch;     // session the client asked to watch with the last command, 0 for none
+};
+
+void session__init(uint64_t id, struct Session* session);
+void session__destruct(struct Session* session);
+void session__handle_line(char* line, struct Buffer* out, struct Session* session);
+
+#endif // SESSION_H
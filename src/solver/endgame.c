@@ -0,0 +1,505 @@
+/**
+ * @file endgame.c
+ * @brief Implementation for the exact endgame search.
+ *
+ * Source code for playing the last few hidden tiles of a game as well
+ * as possible: the move with the highest chance to win, over every mine
+ * layout the board still allows.
+ *
+ * Design Philosophy:
+ *
+ * With at most ENDGAME_MAX_CELLS tiles hidden, a layout is one 64-bit
+ * word, and every layout the numbers and the mine count allow is listed
+ * up front, all equally likely. A position in the search is the tiles
+ * revealed since the root and the layouts still consistent with what
+ * they showed. Its value is 1 once every tile is settled, mine in all
+ * layouts or safe in all; else the best over the unsettled tiles of the
+ * chance of surviving the reveal times the value of what comes next,
+ * split by the number the tile shows. A tile safe in every layout is
+ * revealed without looking at the others, since information never
+ * hurts. A tile that cannot beat the best found so far even if it were
+ * safe in every layout is skipped.
+ *
+ * The layouts of a position are a range of one array; revealing a tile
+ * sorts the range by the number it shows, so each outcome is a smaller
+ * range, and no layout is ever copied out of the array for good.
+ *
+ * Positions are memoized in a transposition table keyed by Zobrist
+ * hashing what the board shows: a key per tile and number, and per
+ * flag. Revealing A then B reaches the same key as B then A, and the
+ * key is the same on the real board after the move is made, so the next
+ * move starts with its subtree already in the table. The table is kept
+ * across moves and games; a key fixes the position, not the game. The
+ * search gives up when a move runs out of time, and the caller guesses
+ * another way. Flags are trusted.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#include <float.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "rng/rng.h"
+#include "solver/endgame.h"
+#include "solver/solver.h"
+
+#define ENDGAME_FLAG        9    // the Zobrist key of a flag follows those of the numbers
+#define ENDGAME_KEYS        10
+#define ENDGAME_MINE        9    // the outcome of revealing a mine
+#define ENDGAME_CHECK_NODES 1023 // the clock is read every this many nodes plus one
+
+// the numbers around the hidden tiles, while listing layouts
+struct EndgameNumbers {
+    uint64_t masks[ENDGAME_MAX_CELLS * BOARD_NUM_NEIGHBORS]; // hidden tiles around each
+    int      needs[ENDGAME_MAX_CELLS * BOARD_NUM_NEIGHBORS]; // mines each still needs
+    int      num_numbers;
+    int      of_cell[ENDGAME_MAX_CELLS][BOARD_NUM_NEIGHBORS]; // numbers around each hidden tile
+    int      cell_size[ENDGAME_MAX_CELLS];
+    int      mines_left;
+};
+
+/**
+ * This function returns the wall clock in seconds.
+ */
+static double endgame__now() {
+  struct timespec now;
+  timespec_get(&now, TIME_UTC);
+  return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+//------------------------------//
+//   CONSTRUCTOR / DESTRUCTOR   //
+//------------------------------//
+
+/**
+ * This function builds the endgame search of a board, with an empty
+ * transposition table. The board must outlive it and keep its size.
+ *
+ * @param board the board to play
+ * @param config the threshold, budget and table size
+ * @param endgame the endgame to be built
+ *
+ * @return true if built; false if out of memory
+ */
+bool endgame__create(struct Board *board, const struct EndgameConfig *config, struct Endgame *endgame) {
+  int num_tiles = board__get_x(board) * board__get_y(board);
+  size_t table_size = (size_t)1 << config->table_bits;
+  struct Rng rng;
+
+  memset(endgame, 0, sizeof(*endgame));
+  endgame->board = board;
+  endgame->cols = board__get_y(board);
+  endgame->config = *config;
+  if (endgame->config.threshold > ENDGAME_MAX_CELLS) {
+    endgame->config.threshold = ENDGAME_MAX_CELLS;
+  }
+  endgame->table_mask = table_size - 1;
+  endgame->zobrist = (uint64_t *)malloc(num_tiles * ENDGAME_KEYS * sizeof(uint64_t));
+  endgame->table = (struct EndgameEntry *)calloc(table_size, sizeof(struct EndgameEntry)); // key 0 is empty
+  endgame->bit_of = (int *)malloc(num_tiles * sizeof(int));
+  endgame->layouts = (uint64_t *)malloc(config->max_layouts * sizeof(uint64_t));
+  endgame->scratch = (uint64_t *)malloc(config->max_layouts * sizeof(uint64_t));
+
+  if (endgame->zobrist == NULL || endgame->table == NULL || endgame->bit_of == NULL || endgame->layouts == NULL ||
+      endgame->scratch == NULL) {
+    endgame__destruct(endgame);
+    return false;
+  }
+
+  rng__seed(0x5EEDE2D6A3Eull, &rng);
+  for (int i = 0; i < num_tiles * ENDGAME_KEYS; i++) {
+    endgame->zobrist[i] = rng__next(&rng);
+  }
+  return true;
+}
+
+/**
+ * This function frees the table and arrays of the endgame.
+ *
+ * @param endgame the endgame to be freed
+ */
+void endgame__destruct(struct Endgame *endgame) {
+  free(endgame->zobrist);
+  free(endgame->table);
+  free(endgame->bit_of);
+  free(endgame->layouts);
+  free(endgame->scratch);
+
+  endgame->zobrist = NULL;
+  endgame->table = NULL;
+  endgame->bit_of = NULL;
+  endgame->layouts = NULL;
+  endgame->scratch = NULL;
+}
+
+//--------------//
+//   POSITION   //
+//--------------//
+
+/**
+ * This function lists the layouts of the hidden tiles from tile i on,
+ * given the mines placed on the tiles before it, into the endgame.
+ *
+ * @param i the next tile
+ * @param placed the mines on tiles before i, as bits
+ * @param mines how many
+ * @param numbers the numbers around the hidden tiles
+ * @param endgame the endgame
+ *
+ * @return true if listed; false if there are more than max_layouts
+ */
+static bool endgame__list(int i, uint64_t placed, int mines, const struct EndgameNumbers *numbers,
+                          struct Endgame *endgame) {
+  if (i == endgame->num_cells) {
+    if (mines != numbers->mines_left) {
+      return true;
+    }
+    if (endgame->num_layouts == endgame->config.max_layouts) {
+      return false;
+    }
+    endgame->layouts[endgame->num_layouts++] = placed;
+    return true;
+  }
+
+  int left = endgame->num_cells - i - 1; // tiles after i
+  uint64_t later = ~(((uint64_t)2 << i) - 1);
+  for (int value = 0; value < 2; value++) {
+    uint64_t next = placed | (uint64_t)value << i;
+    bool fits = mines + value <= numbers->mines_left && mines + value + left >= numbers->mines_left;
+    for (int k = 0; fits && k < numbers->cell_size[i]; k++) {
+      int n = numbers->of_cell[i][k];
+      int count = solver__popcount(next & numbers->masks[n]);
+      fits = count <= numbers->needs[n] && count + solver__popcount(numbers->masks[n] & later) >= numbers->needs[n];
+    }
+    if (fits && !endgame__list(i + 1, next, mines + value, numbers, endgame)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * This function reads the position off the board, lists its layouts and
+ * returns the Zobrist key of what the board shows.
+ *
+ * @param mines the mines on the board
+ * @param key where to store the key
+ * @param endgame the endgame
+ *
+ * @return true if read; false if too many tiles are hidden, the flags
+ *         contradict the numbers, or there are too many layouts
+ */
+static bool endgame__read(int mines, uint64_t *key, struct Endgame *endgame) {
+  struct Board *board = endgame->board;
+  int rows = board__get_x(board);
+  int cols = endgame->cols;
+  struct EndgameNumbers numbers;
+
+  endgame->num_cells = 0;
+  numbers.num_numbers = 0;
+  numbers.mines_left = mines - board__get_num_flags(board);
+  *key = rng__mix((uint64_t)mines);
+  for (int x = 0; x < rows; x++) {
+    for (int y = 0; y < cols; y++) {
+      int index = board__index(x, y, board);
+      char cell = board->board_pointer[index];
+      int tile = x * cols + y;
+      endgame->bit_of[tile] = -1;
+      if (board->reveal_pointer[index] && cell >= '0' && cell <= '8') {
+        *key ^= endgame->zobrist[tile * ENDGAME_KEYS + cell - '0'];
+      } else if (cell == 'F') {
+        *key ^= endgame->zobrist[tile * ENDGAME_KEYS + ENDGAME_FLAG];
+      } else if (!board->reveal_pointer[index]) {
+        if (endgame->num_cells == endgame->config.threshold) {
+          return false;
+        }
+        endgame->bit_of[tile] = endgame->num_cells;
+        endgame->cells[endgame->num_cells++] = tile;
+      }
+    }
+  }
+  if (endgame->num_cells == 0 || numbers.mines_left < 0 || numbers.mines_left > endgame->num_cells) {
+    return false;
+  }
+
+  for (int i = 0; i < endgame->num_cells; i++) {
+    int index = board__index(endgame->cells[i] / cols, endgame->cells[i] % cols, board);
+    endgame->neighbors[i] = 0;
+    endgame->flags[i] = 0;
+    numbers.cell_size[i] = 0;
+    for (int k = 0; k < board->board_num_neighbors; k++) {
+      int neighbor = board__neighbor(index, k, board);
+      if (board->board_pointer[neighbor] == 'F') {
+        endgame->flags[i]++;
+      } else if (!board->reveal_pointer[neighbor]) {
+        int bit = endgame->bit_of[board__index_x(neighbor, board) * cols + board__index_y(neighbor, board)];
+        endgame->neighbors[i] |= (uint64_t)(bit != i) << bit;
+      }
+    }
+  }
+
+  // the numbers around hidden tiles, each once, and the mines each still needs
+  for (int x = 0; x < rows; x++) {
+    for (int y = 0; y < cols; y++) {
+      int index = board__index(x, y, board);
+      char cell = board->board_pointer[index];
+      if (!board->reveal_pointer[index] || cell < '0' || cell > '8') {
+        continue;
+      }
+      uint64_t mask = 0;
+      int need = cell - '0';
+      for (int k = 0; k < board->board_num_neighbors; k++) {
+        int neighbor = board__neighbor(index, k, board);
+        if (board->board_pointer[neighbor] == 'F') {
+          need--;
+        } else if (!board->reveal_pointer[neighbor]) {
+          int tile = board__index_x(neighbor, board) * cols + board__index_y(neighbor, board);
+          mask |= (uint64_t)1 << endgame->bit_of[tile];
+        }
+      }
+      if (mask == 0) {
+        continue;
+      }
+      if (need < 0 || need > solver__popcount(mask)) {
+        return false;
+      }
+      int n = numbers.num_numbers++;
+      numbers.masks[n] = mask;
+      numbers.needs[n] = need;
+      for (uint64_t bits = mask; bits != 0; bits &= bits - 1) {
+        int i = solver__lowest(bits);
+        if (numbers.cell_size[i] < BOARD_NUM_NEIGHBORS) {
+          numbers.of_cell[i][numbers.cell_size[i]++] = n;
+        }
+      }
+    }
+  }
+
+  endgame->num_layouts = 0;
+  if (!endgame__list(0, 0, 0, &numbers, endgame)) {
+    endgame->stats.too_large++;
+    return false;
+  }
+  return endgame->num_layouts > 0;
+}
+
+//------------//
+//   SEARCH   //
+//------------//
+
+static double endgame__search(int begin, int count, uint64_t unknown, uint64_t key, int *best_cell,
+                              struct Endgame *endgame);
+
+/**
+ * This function returns the chance to win after revealing a tile, with
+ * the best play after: the layouts of the position are sorted by what
+ * the tile shows, and each outcome but a mine is searched.
+ *
+ * @param cell the bit of the tile
+ * @param begin the first layout of the position
+ * @param count how many
+ * @param unknown the tiles not revealed yet, as bits
+ * @param key the Zobrist key of the position
+ * @param endgame the endgame
+ *
+ * @return the chance to win
+ */
+static double endgame__reveal(int cell, int begin, int count, uint64_t unknown, uint64_t key,
+                              struct Endgame *endgame) {
+  uint64_t *layouts = endgame->layouts + begin;
+  uint64_t around = endgame->neighbors[cell];
+  int sizes[ENDGAME_KEYS] = {0};
+  int starts[ENDGAME_KEYS];
+
+  for (int i = 0; i < count; i++) {
+    sizes[(layouts[i] >> cell & 1) ? ENDGAME_MINE : solver__popcount(layouts[i] & around)]++;
+  }
+  starts[0] = 0;
+  for (int v = 1; v < ENDGAME_KEYS; v++) {
+    starts[v] = starts[v - 1] + sizes[v - 1];
+  }
+  for (int i = 0; i < count; i++) {
+    endgame->scratch[starts[(layouts[i] >> cell & 1) ? ENDGAME_MINE : solver__popcount(layouts[i] & around)]++] =
+        layouts[i];
+  }
+  memcpy(layouts, endgame->scratch, count * sizeof(uint64_t));
+
+  double wins = 0;
+  int tile = endgame->cells[cell];
+  int start = 0;
+  for (int v = 0; v < ENDGAME_MINE; v++) {
+    if (sizes[v] > 0) {
+      uint64_t next = key ^ endgame->zobrist[tile * ENDGAME_KEYS + v + endgame->flags[cell]];
+      wins += sizes[v] * endgame__search(begin + start, sizes[v], unknown & ~((uint64_t)1 << cell), next, NULL,
+                                         endgame);
+    }
+    start += sizes[v];
+  }
+  return wins / count;
+}
+
+/**
+ * This function returns the chance to win a position with the best
+ * play, from the table if it was searched before.
+ *
+ * @param begin the first layout of the position
+ * @param count how many
+ * @param unknown the tiles not revealed yet, as bits
+ * @param key the Zobrist key of the position
+ * @param best_cell where to store the bit of the best tile to reveal, or
+ *                  NULL; the table is not read when set
+ * @param endgame the endgame
+ *
+ * @return the chance to win; 0 once the search is aborted
+ */
+static double endgame__search(int begin, int count, uint64_t unknown, uint64_t key, int *best_cell,
+                              struct Endgame *endgame) {
+  const uint64_t *layouts = endgame->layouts + begin;
+  uint64_t all = ~(uint64_t)0;
+  uint64_t any = 0;
+
+  if (endgame->aborted) {
+    return 0;
+  }
+  if ((++endgame->stats.nodes & ENDGAME_CHECK_NODES) == 0 && endgame__now() >= endgame->deadline) {
+    endgame->aborted = true;
+    return 0;
+  }
+  for (int i = 0; i < count; i++) {
+    all &= layouts[i];
+    any |= layouts[i];
+  }
+  uint64_t open = unknown & any & ~all;
+  uint64_t free = unknown & ~any;
+  if (open == 0 && best_cell == NULL) {
+    return 1;
+  }
+
+  struct EndgameEntry *entry = &endgame->table[key & endgame->table_mask];
+  if (best_cell == NULL) {
+    endgame->stats.probes++;
+    if (entry->key == key) {
+      endgame->stats.hits++;
+      return entry->value;
+    }
+  }
+
+  double value = 0;
+  if (free != 0) {
+    int cell = solver__lowest(free);
+    value = open == 0 ? 1 : endgame__reveal(cell, begin, count, unknown, key, endgame);
+    if (best_cell != NULL) {
+      *best_cell = cell;
+    }
+  } else {
+    // the open tiles, most often safe first
+    int cells[ENDGAME_MAX_CELLS];
+    int safe[ENDGAME_MAX_CELLS];
+    int num_open = 0;
+    for (uint64_t bits = open; bits != 0; bits &= bits - 1) {
+      int cell = solver__lowest(bits);
+      int safe_count = 0;
+      for (int i = 0; i < count; i++) {
+        safe_count += !(layouts[i] >> cell & 1);
+      }
+      int j = num_open++;
+      while (j > 0 && safe[j - 1] < safe_count) {
+        cells[j] = cells[j - 1];
+        safe[j] = safe[j - 1];
+        j--;
+      }
+      cells[j] = cell;
+      safe[j] = safe_count;
+    }
+    for (int j = 0; j < num_open && (double)safe[j] / count > value && !endgame->aborted; j++) {
+      double wins = endgame__reveal(cells[j], begin, count, unknown, key, endgame);
+      if (wins > value) {
+        value = wins;
+        if (best_cell != NULL) {
+          *best_cell = cells[j];
+        }
+      }
+    }
+  }
+
+  if (endgame->aborted) {
+    return 0;
+  }
+  entry->key = key;
+  entry->value = value;
+  return value;
+}
+
+//-----------//
+//   MOVES   //
+//-----------//
+
+/**
+ * This function picks the tile with the highest chance to win, if few
+ * enough tiles are hidden and the search ends in time. Otherwise the
+ * caller should guess another way.
+ *
+ * @param x where to store the x coordinate
+ * @param y where to store the y coordinate
+ * @param mines the mines on the board
+ * @param endgame the endgame
+ *
+ * @return true if a tile was picked; false if more than threshold tiles
+ *         are hidden, the position allows too many layouts or none, or
+ *         the time ran out
+ */
+bool endgame__choose(int *x, int *y, int mines, struct Endgame *endgame) {
+  uint64_t key;
+  int best_cell = -1;
+
+  if (!endgame__read(mines, &key, endgame)) {
+    return false;
+  }
+  endgame->deadline = endgame->config.seconds > 0 ? endgame__now() + endgame->config.seconds : DBL_MAX;
+  endgame->aborted = false;
+
+  uint64_t unknown = endgame->num_cells == ENDGAME_MAX_CELLS ? ~(uint64_t)0
+                                                            : ((uint64_t)1 << endgame->num_cells) - 1;
+  double value = endgame__search(0, endgame->num_layouts, unknown, key, &best_cell, endgame);
+  if (endgame->aborted) {
+    endgame->stats.timeouts++;
+    return false;
+  }
+  if (best_cell < 0) {
+    return false;
+  }
+  endgame->stats.searches++;
+  endgame->last_value = value;
+  *x = endgame->cells[best_cell] / endgame->cols;
+  *y = endgame->cells[best_cell] % endgame->cols;
+  return true;
+}
+
+//-------------//
+//   GETTERS   //
+//-------------//
+
+/**
+ * This function returns the chance to win with the last move picked and
+ * the best play after it.
+ *
+ * @param endgame the endgame
+ *
+ * @return the chance, 0 to 1
+ */
+double endgame__get_win_chance(struct Endgame *endgame) {
+  return endgame->last_value;
+}
+
+/**
+ * This function copies the counters of the endgame.
+ *
+ * @param endgame the endgame
+ * @param stats where to copy them
+ */
+void endgame__get_stats(struct Endgame *endgame, struct EndgameStats *stats) {
+  *stats = endgame->stats;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file endgame.h
+ * @brief The header for endgame.
+ */
+#ifndef ENDGAME_H
+#define ENDGAME_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "board/board.h"
+
+#define ENDGAME_MAX_CELLS 64 // hidden tiles a search can take, one bit each
+
+struct EndgameConfig {
+    int    threshold;   // search only when at most this many tiles are hidden, up to ENDGAME_MAX_CELLS
+    double seconds;     // time budget of a move, 0 for none
+    int    table_bits;  // the transposition table has 1 << table_bits entries
+    int    max_layouts; // give up on positions that allow more mine layouts
+};
+
+// a position searched, by the Zobrist key of what the board shows
+struct EndgameEntry {
+    uint64_t key;
+    double   value; // chance to win with the best play
+};
+
+// counters since the endgame was built
+struct EndgameStats {
+    long long searches;  // moves searched to the end
+    long long timeouts;  // moves given up for time
+    long long too_large; // moves given up for too many layouts
+    long long nodes;
+    long long probes;    // transposition table lookups
+    long long hits;
+};
+
+struct Endgame {
+    struct Board*        board;
+    int                  cols;
+    struct EndgameConfig config;
+    uint64_t*            zobrist;        // 10 keys per tile: the numbers 0 to 8, then a flag
+    struct EndgameEntry* table;
+    uint64_t             table_mask;
+    int*                 bit_of;         // bit of each tile in the search, or -1
+    // the position being searched
+    int                  cells[ENDGAME_MAX_CELLS];     // hidden tiles, as x * cols + y
+    int                  num_cells;
+    uint64_t             neighbors[ENDGAME_MAX_CELLS]; // hidden tiles around each, as bits
+    int                  flags[ENDGAME_MAX_CELLS];     // flags around each
+    uint64_t*            layouts;        // mine layouts the board allows, as bits
+    uint64_t*            scratch;
+    int                  num_layouts;
+    double               deadline;
+    bool                 aborted;
+    double               last_value;
+    struct EndgameStats  stats;
+};
+
+bool   endgame__create(struct Board* board, const struct EndgameConfig* config, struct Endgame* endgame);
+void   endgame__destruct(struct Endgame* endgame);
+bool   endgame__choose(int* x, int* y, int mines, struct Endgame* endgame);
+double endgame__get_win_chance(struct Endgame* endgame);
+void   endgame__get_stats(struct Endgame* endgame, struct EndgameStats* stats);
+
+#endif // ENDGAME_H
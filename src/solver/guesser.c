@@ -0,0 +1,766 @@
+/**
+ * @file guesser.c
+ * @brief Implementation for the Monte Carlo guesser.
+ *
+ * Source code for picking a guess when no tile can be deduced: sample
+ * the mine layouts the board still allows, and reveal the tile that is
+ * most often safe and tells the most when it is.
+ *
+ * Design Philosophy:
+ *
+ * Only the frontier, the hidden tiles next to a number, is sampled. The
+ * tiles off it are all alike, so a layout of the frontier with f mines
+ * stands for C(interior, mines_left - f) full layouts and is weighted by
+ * that. Layouts are drawn by sequential importance sampling: one pass
+ * over the frontier in the order it was read, each tile drawn a mine
+ * with a fixed chance when the numbers around it allow both values and
+ * forced otherwise, the layout weighted by one over the chance of the
+ * draws. A pass that reaches a tile no value fits is thrown away. Every
+ * draw is independent, so unlike a Markov chain with local moves, no
+ * layout is out of reach: along a wall, 1-1-1 can only change by
+ * flipping every tile at once. Each thread draws its own layouts; the
+ * weights are kept in log space and rescaled to the largest one seen.
+ *
+ * A guess takes two passes. The first estimates the chance of a mine on
+ * every frontier tile and off it. The safest GUESSER_CANDIDATES tiles,
+ * plus a few interior tiles with the fewest hidden neighbors, then get a
+ * second pass that also records the number each would show. Score is
+ * survival times one plus info_weight times the entropy of that number
+ * in bits: a safe tile whose number is hard to predict settles more.
+ *
+ * The budget is time, samples or both; each pass gets half. Workers on
+ * a pool with no threads run one after another, the first one taking
+ * all the time. Flags are trusted.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#include <float.h>
+#include <limits.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "solver/guesser.h"
+
+#define GUESSER_INTERIOR_CANDIDATES 4    // interior tiles given the second pass
+#define GUESSER_VALUES              10   // the numbers 0 to 8, then a mine
+#define GUESSER_MIN_DENSITY         0.02 // the chance of a mine a free tile is drawn with stays in [min, 1 - min]
+
+/**
+ * This function returns the wall clock in seconds.
+ */
+static double guesser__now() {
+  struct timespec now;
+  timespec_get(&now, TIME_UTC);
+  return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/**
+ * This function returns a uniform double in [0, 1).
+ */
+static double guesser__uniform(struct Rng *rng) {
+  return (rng__next(rng) >> 11) * 0x1.0p-53;
+}
+
+//------------------------------//
+//   CONSTRUCTOR / DESTRUCTOR   //
+//------------------------------//
+
+/**
+ * This function builds a guesser for a board, with its pool and one
+ * worker per thread, the caller's included. The board must outlive it
+ * and keep its size.
+ *
+ * @param board the board to guess on
+ * @param config the threads, budget, scoring and seed
+ * @param guesser the guesser to be built
+ *
+ * @return true if built; false if out of memory, or if the config sets
+ *         no budget
+ */
+bool guesser__create(struct Board *board, const struct GuesserConfig *config, struct Guesser *guesser) {
+  int num_tiles = board__get_x(board) * board__get_y(board);
+
+  memset(guesser, 0, sizeof(*guesser));
+  if (config->seconds <= 0 && config->samples <= 0) {
+    return false;
+  }
+  guesser->board = board;
+  guesser->cols = board__get_y(board);
+  guesser->config = *config;
+  guesser->num_workers = config->threads + 1;
+  if (!thread_pool__create(config->threads, &guesser->pool)) {
+    return false;
+  }
+
+  guesser->workers = (struct GuesserWorker *)calloc(guesser->num_workers, sizeof(struct GuesserWorker));
+  guesser->frontier = (int *)malloc(num_tiles * sizeof(int));
+  guesser->frontier_of = (int *)malloc(num_tiles * sizeof(int));
+  guesser->number_need = (int *)malloc(num_tiles * sizeof(int));
+  guesser->number_cells = (int *)malloc(num_tiles * BOARD_NUM_NEIGHBORS * sizeof(int));
+  guesser->number_size = (int *)malloc(num_tiles * sizeof(int));
+  guesser->cell_numbers = (int *)malloc(num_tiles * BOARD_NUM_NEIGHBORS * sizeof(int));
+  guesser->cell_size = (int *)malloc(num_tiles * sizeof(int));
+  guesser->log_interior = (double *)malloc((num_tiles + 1) * sizeof(double));
+  bool built = guesser->workers != NULL && guesser->frontier != NULL && guesser->frontier_of != NULL &&
+               guesser->number_need != NULL && guesser->number_cells != NULL && guesser->number_size != NULL &&
+               guesser->cell_numbers != NULL && guesser->cell_size != NULL && guesser->log_interior != NULL;
+
+  for (int i = 0; built && i < guesser->num_workers; i++) {
+    struct GuesserWorker *worker = &guesser->workers[i];
+    worker->mines = (unsigned char *)malloc(num_tiles);
+    worker->count = (int *)malloc(num_tiles * sizeof(int));
+    worker->unassigned = (int *)malloc(num_tiles * sizeof(int));
+    worker->mine_weight = (double *)malloc(num_tiles * sizeof(double));
+    worker->histogram = (double *)malloc(GUESSER_CANDIDATES * GUESSER_VALUES * sizeof(double));
+    built = worker->mines != NULL && worker->count != NULL && worker->unassigned != NULL &&
+            worker->mine_weight != NULL && worker->histogram != NULL;
+  }
+
+  if (!built) {
+    guesser__destruct(guesser);
+    return false;
+  }
+  return true;
+}
+
+/**
+ * This function stops the pool and frees the arrays of the guesser.
+ *
+ * @param guesser the guesser to be freed
+ */
+void guesser__destruct(struct Guesser *guesser) {
+  if (guesser->workers != NULL) {
+    for (int i = 0; i < guesser->num_workers; i++) {
+      struct GuesserWorker *worker = &guesser->workers[i];
+      free(worker->mines);
+      free(worker->count);
+      free(worker->unassigned);
+      free(worker->mine_weight);
+      free(worker->histogram);
+    }
+    thread_pool__destruct(&guesser->pool);
+  }
+  free(guesser->workers);
+  free(guesser->frontier);
+  free(guesser->frontier_of);
+  free(guesser->number_need);
+  free(guesser->number_cells);
+  free(guesser->number_size);
+  free(guesser->cell_numbers);
+  free(guesser->cell_size);
+  free(guesser->log_interior);
+
+  guesser->workers = NULL;
+  guesser->frontier = NULL;
+  guesser->frontier_of = NULL;
+  guesser->number_need = NULL;
+  guesser->number_cells = NULL;
+  guesser->number_size = NULL;
+  guesser->cell_numbers = NULL;
+  guesser->cell_size = NULL;
+  guesser->log_interior = NULL;
+}
+
+//--------------//
+//   POSITION   //
+//--------------//
+
+/**
+ * This function returns whether a cell is a hidden tile the player has
+ * not flagged. Guard cells count as revealed.
+ */
+static bool guesser__hidden(int index, struct Board *board) {
+  return !board->reveal_pointer[index] && board->board_pointer[index] != 'F';
+}
+
+/**
+ * This function returns the tile of a grid index, x * cols + y.
+ */
+static int guesser__tile(int index, struct Guesser *guesser) {
+  return board__index_x(index, guesser->board) * guesser->cols + board__index_y(index, guesser->board);
+}
+
+/**
+ * This function reads the position off the board: the frontier, the
+ * numbers around it with the mines each still needs, and the tiles and
+ * mines left off it.
+ *
+ * @param mines the mines on the board
+ * @param guesser the guesser
+ *
+ * @return true if the position can be sampled; false if no tile is
+ *         hidden or the flags contradict the numbers
+ */
+static bool guesser__read(int mines, struct Guesser *guesser) {
+  struct Board *board = guesser->board;
+  int rows = board__get_x(board);
+  int cols = guesser->cols;
+  int hidden = 0;
+
+  memset(guesser->frontier_of, -1, rows * cols * sizeof(int));
+  guesser->num_frontier = 0;
+  guesser->num_numbers = 0;
+  guesser->mines_left = mines - board__get_num_flags(board);
+
+  for (int x = 0; x < rows; x++) {
+    for (int y = 0; y < cols; y++) {
+      int index = board__index(x, y, board);
+      char cell = board->board_pointer[index];
+      if (!board->reveal_pointer[index]) {
+        hidden += cell != 'F';
+        continue;
+      }
+      if (cell < '0' || cell > '8') {
+        continue;
+      }
+
+      int number = guesser->num_numbers;
+      int *cells = &guesser->number_cells[number * BOARD_NUM_NEIGHBORS];
+      int size = 0;
+      int need = cell - '0';
+      for (int k = 0; k < board->board_num_neighbors; k++) {
+        int neighbor = board__neighbor(index, k, board);
+        if (!guesser__hidden(neighbor, board)) {
+          need -= board->board_pointer[neighbor] == 'F';
+          continue;
+        }
+        int tile = guesser__tile(neighbor, guesser);
+        int f = guesser->frontier_of[tile];
+        if (f < 0) {
+          f = guesser->num_frontier++;
+          guesser->frontier[f] = tile;
+          guesser->frontier_of[tile] = f;
+          guesser->cell_size[f] = 0;
+        }
+        // a small torus can wrap two steps onto one tile
+        bool listed = false;
+        for (int i = 0; i < size; i++) {
+          listed |= cells[i] == f;
+        }
+        if (!listed) {
+          cells[size++] = f;
+          guesser->cell_numbers[f * BOARD_NUM_NEIGHBORS + guesser->cell_size[f]++] = number;
+        }
+      }
+      if (size == 0) {
+        continue;
+      }
+      if (need < 0 || need > size) {
+        return false;
+      }
+      guesser->number_need[number] = need;
+      guesser->number_size[number] = size;
+      guesser->num_numbers++;
+    }
+  }
+
+  guesser->interior = hidden - guesser->num_frontier;
+  if (hidden == 0 || guesser->mines_left < 0 || guesser->mines_left > hidden) {
+    return false;
+  }
+
+  guesser->log_interior[0] = 0;
+  for (int k = 1; k <= guesser->interior; k++) {
+    guesser->log_interior[k] = guesser->log_interior[k - 1] + log((double)(guesser->interior - k + 1) / k);
+  }
+  double density = (double)guesser->mines_left / hidden;
+  density = density > GUESSER_MIN_DENSITY ? density : GUESSER_MIN_DENSITY;
+  guesser->density = density < 1 - GUESSER_MIN_DENSITY ? density : 1 - GUESSER_MIN_DENSITY;
+  return true;
+}
+
+//-------------//
+//   SAMPLES   //
+//-------------//
+
+/**
+ * This function returns whether the next frontier tile may take a value:
+ * no number around it gets more mines than it needs or too few tiles
+ * left to reach it, and the mines left still fit.
+ *
+ * @param f the frontier tile, the next one to draw
+ * @param value 1 for a mine, 0 for none
+ * @param worker the worker
+ * @param guesser the guesser
+ *
+ * @return true if it may
+ */
+static bool guesser__fits(int f, int value, struct GuesserWorker *worker, struct Guesser *guesser) {
+  const int *numbers = &guesser->cell_numbers[f * BOARD_NUM_NEIGHBORS];
+
+  for (int i = 0; i < guesser->cell_size[f]; i++) {
+    int n = numbers[i];
+    int count = worker->count[n] + value;
+    if (count > guesser->number_need[n] || count + worker->unassigned[n] - 1 < guesser->number_need[n]) {
+      return false;
+    }
+  }
+  int frontier_mines = worker->frontier_mines + value;
+  int remaining = guesser->num_frontier - f - 1;
+  return frontier_mines <= guesser->mines_left && frontier_mines + remaining + guesser->interior >= guesser->mines_left;
+}
+
+/**
+ * This function draws a layout of the frontier consistent with every
+ * number and the mines left into the worker.
+ *
+ * @param log_weight where to store the log of its weight
+ * @param worker the worker
+ * @param guesser the guesser
+ *
+ * @return true if drawn; false if the draw reached a dead end
+ */
+static bool guesser__draw(double *log_weight, struct GuesserWorker *worker, struct Guesser *guesser) {
+  double log_mine = log(guesser->density);
+  double log_safe = log(1 - guesser->density);
+  double weight = 0;
+
+  memset(worker->count, 0, guesser->num_numbers * sizeof(int));
+  memcpy(worker->unassigned, guesser->number_size, guesser->num_numbers * sizeof(int));
+  worker->frontier_mines = 0;
+
+  for (int f = 0; f < guesser->num_frontier; f++) {
+    bool can_mine = guesser__fits(f, 1, worker, guesser);
+    bool can_safe = guesser__fits(f, 0, worker, guesser);
+    if (!can_mine && !can_safe) {
+      return false;
+    }
+    int value = can_mine;
+    if (can_mine && can_safe) {
+      value = guesser__uniform(&worker->rng) < guesser->density;
+      weight -= value ? log_mine : log_safe;
+    }
+
+    const int *numbers = &guesser->cell_numbers[f * BOARD_NUM_NEIGHBORS];
+    worker->mines[f] = value;
+    for (int i = 0; i < guesser->cell_size[f]; i++) {
+      worker->count[numbers[i]] += value;
+      worker->unassigned[numbers[i]]--;
+    }
+    worker->frontier_mines += value;
+  }
+
+  *log_weight = weight + guesser->log_interior[guesser->mines_left - worker->frontier_mines];
+  return true;
+}
+
+/**
+ * This function adds the layout a worker drew to its counts: the
+ * frontier mines, the share of the interior mined and, in the second
+ * pass, what every candidate would show, interior neighbors drawn at
+ * that share.
+ *
+ * @param log_weight the log of the weight of the layout
+ * @param worker the worker
+ * @param guesser the guesser
+ */
+static void guesser__record(double log_weight, struct GuesserWorker *worker, struct Guesser *guesser) {
+  int interior_mines = guesser->mines_left - worker->frontier_mines;
+
+  if (worker->samples == 0 || log_weight > worker->scale) {
+    double rescale = worker->samples == 0 ? 0 : exp(worker->scale - log_weight);
+    worker->weight *= rescale;
+    worker->interior_mines *= rescale;
+    for (int f = 0; f < guesser->num_frontier; f++) {
+      worker->mine_weight[f] *= rescale;
+    }
+    for (int i = 0; i < GUESSER_CANDIDATES * GUESSER_VALUES; i++) {
+      worker->histogram[i] *= rescale;
+    }
+    worker->scale = log_weight;
+  }
+
+  double weight = exp(log_weight - worker->scale);
+  worker->samples++;
+  worker->weight += weight;
+  for (int f = 0; f < guesser->num_frontier; f++) {
+    worker->mine_weight[f] += worker->mines[f] ? weight : 0;
+  }
+  if (guesser->interior > 0) {
+    worker->interior_mines += weight * interior_mines / guesser->interior;
+  }
+  if (!guesser->info_pass) {
+    return;
+  }
+
+  for (int c = 0; c < guesser->num_candidates; c++) {
+    const struct GuesserCandidate *candidate = &guesser->candidates[c];
+    double *histogram = &worker->histogram[c * GUESSER_VALUES];
+    int others = guesser->interior; // interior tiles the neighbors are drawn from
+    if (candidate->frontier >= 0 && worker->mines[candidate->frontier]) {
+      histogram[GUESSER_VALUES - 1] += weight;
+      continue;
+    }
+    if (candidate->frontier < 0) {
+      if (guesser__uniform(&worker->rng) * others < interior_mines) {
+        histogram[GUESSER_VALUES - 1] += weight;
+        continue;
+      }
+      others--;
+    }
+
+    int value = candidate->flags;
+    for (int i = 0; i < candidate->num_neighbors; i++) {
+      value += worker->mines[candidate->neighbors[i]];
+    }
+    for (int i = 0; i < candidate->interior; i++) {
+      value += guesser__uniform(&worker->rng) * others < interior_mines;
+    }
+    histogram[value] += weight;
+  }
+}
+
+/**
+ * This function runs one worker for a pass, a task of the pool: it
+ * draws layouts until the pass runs out of time or draws. The first
+ * worker draws at least once, so a pass with time left never ends
+ * without trying.
+ *
+ * @param context the guesser
+ * @param task the worker
+ */
+static void guesser__task(void *context, int task) {
+  struct Guesser *guesser = (struct Guesser *)context;
+  struct GuesserWorker *worker = &guesser->workers[task];
+  double log_weight;
+
+  for (long long done = 0; done < guesser->quota; done++) {
+    if ((task != 0 || done > 0) && guesser__now() >= guesser->deadline) {
+      break;
+    }
+    if (guesser__draw(&log_weight, worker, guesser)) {
+      guesser__record(log_weight, worker, guesser);
+    }
+  }
+}
+
+/**
+ * This function runs every worker for a pass, from empty counts.
+ *
+ * @param deadline when the pass must end
+ * @param quota the layouts each worker draws
+ * @param guesser the guesser
+ */
+static void guesser__pass(double deadline, long long quota, struct Guesser *guesser) {
+  guesser->deadline = deadline;
+  guesser->quota = quota;
+  for (int i = 0; i < guesser->num_workers; i++) {
+    struct GuesserWorker *worker = &guesser->workers[i];
+    worker->samples = 0;
+    worker->scale = 0;
+    worker->weight = 0;
+    worker->interior_mines = 0;
+    memset(worker->mine_weight, 0, guesser->num_frontier * sizeof(double));
+    memset(worker->histogram, 0, GUESSER_CANDIDATES * GUESSER_VALUES * sizeof(double));
+  }
+  thread_pool__run(guesser->num_workers, guesser__task, guesser, &guesser->pool);
+}
+
+/**
+ * This function returns the factor that brings the counts of a worker
+ * to the scale of the largest one, 0 for a worker with no layouts.
+ *
+ * @param worker the worker
+ * @param scale the largest scale of the workers with layouts
+ *
+ * @return the factor
+ */
+static double guesser__factor(const struct GuesserWorker *worker, double scale) {
+  return worker->samples > 0 ? exp(worker->scale - scale) : 0;
+}
+
+/**
+ * This function returns the largest scale of the workers with layouts,
+ * and how many layouts they drew in all.
+ *
+ * @param samples where to store the layouts drawn
+ * @param guesser the guesser
+ *
+ * @return the scale
+ */
+static double guesser__scale(long long *samples, struct Guesser *guesser) {
+  double scale = -DBL_MAX;
+
+  *samples = 0;
+  for (int i = 0; i < guesser->num_workers; i++) {
+    const struct GuesserWorker *worker = &guesser->workers[i];
+    *samples += worker->samples;
+    if (worker->samples > 0 && worker->scale > scale) {
+      scale = worker->scale;
+    }
+  }
+  return scale;
+}
+
+//----------------//
+//   CANDIDATES   //
+//----------------//
+
+/**
+ * This function puts a tile among the candidates if it is among the
+ * GUESSER_CANDIDATES safest so far, keeping them safest first.
+ *
+ * @param tile the tile, x * cols + y
+ * @param mine its chance of a mine
+ * @param chances the chance of each candidate
+ * @param guesser the guesser
+ */
+static void guesser__offer(int tile, double mine, double *chances, struct Guesser *guesser) {
+  int i = guesser->num_candidates < GUESSER_CANDIDATES ? guesser->num_candidates++ : GUESSER_CANDIDATES;
+
+  while (i > 0 && chances[i - 1] > mine) {
+    if (i < GUESSER_CANDIDATES) {
+      guesser->candidates[i] = guesser->candidates[i - 1];
+      chances[i] = chances[i - 1];
+    }
+    i--;
+  }
+  if (i < GUESSER_CANDIDATES) {
+    guesser->candidates[i].tile = tile;
+    chances[i] = mine;
+  }
+}
+
+/**
+ * This function picks the candidates from the first pass: the safest
+ * frontier tiles and the interior tiles with the fewest hidden
+ * neighbors, whose number opens the most, and lists what each would
+ * count.
+ *
+ * @param scale the largest scale of the workers
+ * @param chances where to store the chance of a mine of each candidate
+ * @param guesser the guesser
+ */
+static void guesser__pick(double scale, double *chances, struct Guesser *guesser) {
+  struct Board *board = guesser->board;
+  int rows = board__get_x(board);
+  int cols = guesser->cols;
+  double total = 0;
+  double interior_mine = 0;
+
+  for (int i = 0; i < guesser->num_workers; i++) {
+    double factor = guesser__factor(&guesser->workers[i], scale);
+    total += factor * guesser->workers[i].weight;
+    interior_mine += factor * guesser->workers[i].interior_mines;
+  }
+  guesser->num_candidates = 0;
+  for (int f = 0; f < guesser->num_frontier; f++) {
+    double mine = 0;
+    for (int i = 0; i < guesser->num_workers; i++) {
+      mine += guesser__factor(&guesser->workers[i], scale) * guesser->workers[i].mine_weight[f];
+    }
+    guesser__offer(guesser->frontier[f], mine / total, chances, guesser);
+  }
+
+  // the interior tiles with the fewest hidden neighbors, earliest first on ties
+  int interior[GUESSER_INTERIOR_CANDIDATES];
+  int interior_hidden[GUESSER_INTERIOR_CANDIDATES];
+  int num_interior = 0;
+  for (int x = 0; x < rows && guesser->interior > 0; x++) {
+    for (int y = 0; y < cols; y++) {
+      int index = board__index(x, y, board);
+      if (!guesser__hidden(index, board) || guesser->frontier_of[x * cols + y] >= 0) {
+        continue;
+      }
+      int around = 0;
+      for (int k = 0; k < board->board_num_neighbors; k++) {
+        around += guesser__hidden(board__neighbor(index, k, board), board);
+      }
+      int i = num_interior < GUESSER_INTERIOR_CANDIDATES ? num_interior++ : GUESSER_INTERIOR_CANDIDATES;
+      while (i > 0 && interior_hidden[i - 1] > around) {
+        if (i < GUESSER_INTERIOR_CANDIDATES) {
+          interior[i] = interior[i - 1];
+          interior_hidden[i] = interior_hidden[i - 1];
+        }
+        i--;
+      }
+      if (i < GUESSER_INTERIOR_CANDIDATES) {
+        interior[i] = x * cols + y;
+        interior_hidden[i] = around;
+      }
+    }
+  }
+  for (int i = 0; i < num_interior; i++) {
+    guesser__offer(interior[i], interior_mine / total, chances, guesser);
+  }
+
+  for (int c = 0; c < guesser->num_candidates; c++) {
+    struct GuesserCandidate *candidate = &guesser->candidates[c];
+    int index = board__index(candidate->tile / cols, candidate->tile % cols, board);
+    candidate->frontier = guesser->frontier_of[candidate->tile];
+    candidate->num_neighbors = 0;
+    candidate->interior = 0;
+    candidate->flags = 0;
+    for (int k = 0; k < board->board_num_neighbors; k++) {
+      int neighbor = board__neighbor(index, k, board);
+      if (!guesser__hidden(neighbor, board)) {
+        candidate->flags += board->board_pointer[neighbor] == 'F';
+        continue;
+      }
+      int f = guesser->frontier_of[guesser__tile(neighbor, guesser)];
+      if (f >= 0) {
+        candidate->neighbors[candidate->num_neighbors++] = f;
+      } else {
+        candidate->interior += neighbor != index;
+      }
+    }
+  }
+}
+
+/**
+ * This function scores the candidates from the second pass and returns
+ * the best one.
+ *
+ * @param scale the largest scale of the workers
+ * @param guesser the guesser
+ *
+ * @return the index of the best candidate
+ */
+static int guesser__score(double scale, struct Guesser *guesser) {
+  double best_score = -1;
+  int best = 0;
+
+  for (int c = 0; c < guesser->num_candidates; c++) {
+    double counts[GUESSER_VALUES] = {0};
+    double total = 0;
+    for (int i = 0; i < guesser->num_workers; i++) {
+      double factor = guesser__factor(&guesser->workers[i], scale);
+      for (int v = 0; v < GUESSER_VALUES; v++) {
+        counts[v] += factor * guesser->workers[i].histogram[c * GUESSER_VALUES + v];
+      }
+    }
+    for (int v = 0; v < GUESSER_VALUES; v++) {
+      total += counts[v];
+    }
+    double safe = total - counts[GUESSER_VALUES - 1];
+    if (total <= 0 || safe <= 0) {
+      continue;
+    }
+
+    double entropy = 0;
+    for (int v = 0; v < GUESSER_VALUES - 1; v++) {
+      if (counts[v] > 0) {
+        double share = counts[v] / safe;
+        entropy -= share * log2(share);
+      }
+    }
+    double survival = safe / total;
+    double score = survival * (1 + guesser->config.info_weight * entropy);
+    if (score > best_score) {
+      best_score = score;
+      best = c;
+      guesser->last_survival = survival;
+      guesser->last_info = entropy;
+    }
+  }
+  return best;
+}
+
+//-------------//
+//   GUESSES   //
+//-------------//
+
+/**
+ * This function picks the tile to guess: it samples the layouts the
+ * board allows, then scores the safest tiles by their chance of being
+ * safe and what their number would tell. Flags are trusted.
+ *
+ * @param x where to store the x coordinate
+ * @param y where to store the y coordinate
+ * @param mines the mines on the board
+ * @param guesser the guesser
+ *
+ * @return true if a tile was picked; false if none is hidden, the flags
+ *         contradict the numbers, or no layout was drawn in the budget
+ */
+bool guesser__choose(int *x, int *y, int mines, struct Guesser *guesser) {
+  const struct GuesserConfig *config = &guesser->config;
+  double start = guesser__now();
+  bool info = config->info_weight > 0;
+  double share = info ? 0.5 : 1; // of the budget, for the first pass
+  double chances[GUESSER_CANDIDATES];
+  long long quota = LLONG_MAX;
+  long long samples;
+
+  if (!guesser__read(mines, guesser)) {
+    return false;
+  }
+  guesser->calls++;
+  for (int i = 0; i < guesser->num_workers; i++) {
+    rng__seed(rng__mix(config->seed ^ rng__mix(guesser->calls * guesser->num_workers + i)),
+              &guesser->workers[i].rng);
+  }
+  if (config->samples > 0) {
+    quota = (long long)(config->samples * share / guesser->num_workers);
+    quota = quota > 0 ? quota : 1;
+  }
+
+  guesser->info_pass = false;
+  guesser__pass(config->seconds > 0 ? start + config->seconds * share : DBL_MAX, quota, guesser);
+  double scale = guesser__scale(&samples, guesser);
+  if (samples == 0) {
+    return false;
+  }
+  guesser__pick(scale, chances, guesser);
+  guesser->last_samples = samples;
+  guesser->last_survival = 1 - chances[0];
+  guesser->last_info = 0;
+  int best = 0;
+
+  if (info) {
+    guesser->info_pass = true;
+    guesser__pass(config->seconds > 0 ? start + config->seconds : DBL_MAX, quota, guesser);
+    scale = guesser__scale(&samples, guesser);
+    if (samples > 0) {
+      best = guesser__score(scale, guesser);
+      guesser->last_samples += samples;
+    }
+  }
+
+  *x = guesser->candidates[best].tile / guesser->cols;
+  *y = guesser->candidates[best].tile % guesser->cols;
+  return true;
+}
+
+//-------------//
+//   GETTERS   //
+//-------------//
+
+/**
+ * This function returns the estimated chance the last guess was safe.
+ *
+ * @param guesser the guesser
+ *
+ * @return the chance, 0 to 1
+ */
+double guesser__get_survival(struct Guesser *guesser) {
+  return guesser->last_survival;
+}
+
+/**
+ * This function returns the expected information of the number the last
+ * guess shows when safe, in bits; 0 when info_weight is 0.
+ *
+ * @param guesser the guesser
+ *
+ * @return the bits
+ */
+double guesser__get_info(struct Guesser *guesser) {
+  return guesser->last_info;
+}
+
+/**
+ * This function returns the layouts the last guess was made from, over
+ * both passes and all workers.
+ *
+ * @param guesser the guesser
+ *
+ * @return the layouts
+ */
+long long guesser__get_samples(struct Guesser *guesser) {
+  return guesser->last_samples;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file guesser.h
+ * @brief The header for guesser.
+ */
+#ifndef GUESSER_H
+#define GUESSER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "board/board.h"
+#include "rng/rng.h"
+#include "thread/thread_pool.h"
+
+#define GUESSER_CANDIDATES 12 // tiles whose information gain is estimated, the safest ones
+
+struct GuesserConfig {
+    int      threads;     // worker threads besides the caller, each draws its own layouts
+    double   seconds;     // time budget of a guess, 0 for none
+    int      samples;     // samples per guess over all chains, 0 for none; one budget must be set
+    double   info_weight; // score is survival * (1 + info_weight * bits the revealed number gives)
+    uint64_t seed;
+};
+
+// the layouts one thread draws, and their weighted counts
+struct GuesserWorker {
+    unsigned char* mines;          // of each frontier tile, in the layout being drawn
+    int*           count;          // mines around each number, among its frontier tiles
+    int*           unassigned;     // frontier tiles of each number not drawn yet
+    int            frontier_mines;
+    struct Rng     rng;
+    long long      samples;        // layouts drawn to the end, dead ends aside
+    // counts are weighted by exp(log weight - scale), scale the largest log weight so far
+    double         scale;
+    double         weight;
+    double*        mine_weight;    // of layouts with a mine on each frontier tile
+    double         interior_mines; // summed, mines off the frontier over tiles off it
+    double*        histogram;      // per candidate, by the number it shows, 9 when a mine
+};
+
+// a tile given the second pass, with what it would count
+struct GuesserCandidate {
+    int tile;                           // x * cols + y
+    int frontier;                       // index in frontier, or -1 off it
+    int neighbors[BOARD_NUM_NEIGHBORS]; // frontier tiles around it
+    int num_neighbors;
+    int interior;                       // hidden tiles off the frontier around it
+    int flags;
+};
+
+struct Guesser {
+    struct Board*           board;
+    int                     cols;
+    struct GuesserConfig    config;
+    struct ThreadPool       pool;
+    int                     num_workers;
+    struct GuesserWorker*   workers;
+    uint64_t                calls;             // guesses made, so every guess draws new samples
+    // the position being guessed on
+    int*                    frontier;          // hidden tiles next to a number, as x * cols + y
+    int                     num_frontier;
+    int*                    frontier_of;       // index in frontier of each tile, or -1
+    int*                    number_need;       // mines each number still needs, flags taken off
+    int*                    number_cells;      // BOARD_NUM_NEIGHBORS frontier tiles per number
+    int*                    number_size;
+    int                     num_numbers;
+    int*                    cell_numbers;      // BOARD_NUM_NEIGHBORS numbers per frontier tile
+    int*                    cell_size;
+    int                     interior;          // hidden tiles off the frontier
+    int                     mines_left;        // mines not flagged
+    double*                 log_interior;      // log C(interior, k) for every k up to interior
+    double                  density;           // chance a free frontier tile is drawn a mine
+    struct GuesserCandidate candidates[GUESSER_CANDIDATES];
+    int                     num_candidates;
+    double                  deadline;
+    long long               quota;             // layouts each worker draws in this pass
+    bool                    info_pass;         // filling the histograms of the candidates
+    // the last guess
+    long long               last_samples;
+    double                  last_survival;
+    double                  last_info;         // bits
+};
+
+bool      guesser__create(struct Board* board, const struct GuesserConfig* config, struct Guesser* guesser);
+void      guesser__destruct(struct Guesser* guesser);
+bool      guesser__choose(int* x, int* y, int mines, struct Guesser* guesser);
+double    guesser__get_survival(struct Guesser* guesser);
+double    guesser__get_info(struct Guesser* guesser);
+long long guesser__get_samples(struct Guesser* guesser);
+
+#endif // GUESSER_H
@@ -0,0 +1,2205 @@
+/**
+ * @file pattern_table.h
+ * @brief The local pattern table, generated by tools/gen_pattern_table.c.
+ *
+ * Do not edit: run gen_pattern_table > src/solver/pattern_table.h instead.
+ */
+#ifndef PATTERN_TABLE_H
+#define PATTERN_TABLE_H
+
+#define PATTERN_RADIX 9
+#define PATTERN_KEYS  59049
+
+// indexed by (((need_a * 9 + need_b) * 9 + only_a) * 9 + shared) * 9 + only_b; two bits
+// for each group, A only in the low bits, then both, then B only: 1 safe, 2 mines
+static const unsigned char PATTERN_TABLE[PATTERN_KEYS] = {
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     1,17,17,17,17,17,17,17,17,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     1,17,17,17,17,17,17,17,17,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     1,17,17,17,17,17,17,17,17,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     1,17,17,17,17,17,17,17,17,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     1,17,17,17,17,17,17,17,17,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     1,17,17,17,17,17,17,17,17,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     1,17,17,17,17,17,17,17,17,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     1,17,17,17,17,17,17,17,17,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,  5,21,21,21,21,21,21,21,21,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  0,36, 4, 4, 4, 4, 4, 4, 4,  0,36, 4, 4, 4, 4, 4, 4, 4,
+     0,36, 4, 4, 4, 4, 4, 4, 4,  0,36, 4, 4, 4, 4, 4, 4, 4,  0,36, 4, 4, 4, 4, 4, 4, 4,
+     0,36, 4, 4, 4, 4, 4, 4, 4,  0,36, 4, 4, 4, 4, 4, 4, 4,  0,36, 4, 4, 4, 4, 4, 4, 4,
+     0,33, 1, 1, 1, 1, 1, 1, 1,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,33, 1, 1, 1, 1, 1, 1, 1,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,33, 1, 1, 1, 1, 1, 1, 1,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,33, 1, 1, 1, 1, 1, 1, 1,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,33, 1, 1, 1, 1, 1, 1, 1,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,33, 1, 1, 1, 1, 1, 1, 1,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,33, 1, 1, 1, 1, 1, 1, 1,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,33, 1, 1, 1, 1, 1, 1, 1,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,  0,37, 5, 5, 5, 5, 5, 5, 5,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0, 0,36, 4, 4, 4, 4, 4, 4,  0, 0,36, 4, 4, 4, 4, 4, 4,
+     0, 0,36, 4, 4, 4, 4, 4, 4,  0, 0,36, 4, 4, 4, 4, 4, 4,  0, 0,36, 4, 4, 4, 4, 4, 4,
+     0, 0,36, 4, 4, 4, 4, 4, 4,  0, 0,36, 4, 4, 4, 4, 4, 4,  0, 0,36, 4, 4, 4, 4, 4, 4,
+     0, 0,33, 1, 1, 1, 1, 1, 1,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,33, 1, 1, 1, 1, 1, 1,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,33, 1, 1, 1, 1, 1, 1,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,33, 1, 1, 1, 1, 1, 1,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,33, 1, 1, 1, 1, 1, 1,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,33, 1, 1, 1, 1, 1, 1,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,33, 1, 1, 1, 1, 1, 1,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,33, 1, 1, 1, 1, 1, 1,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,  0, 0,37, 5, 5, 5, 5, 5, 5,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0, 0,36, 4, 4, 4, 4, 4,  0, 0, 0,36, 4, 4, 4, 4, 4,
+     0, 0, 0,36, 4, 4, 4, 4, 4,  0, 0, 0,36, 4, 4, 4, 4, 4,  0, 0, 0,36, 4, 4, 4, 4, 4,
+     0, 0, 0,36, 4, 4, 4, 4, 4,  0, 0, 0,36, 4, 4, 4, 4, 4,  0, 0, 0,36, 4, 4, 4, 4, 4,
+     0, 0, 0,33, 1, 1, 1, 1, 1,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,33, 1, 1, 1, 1, 1,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,33, 1, 1, 1, 1, 1,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,33, 1, 1, 1, 1, 1,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,33, 1, 1, 1, 1, 1,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,33, 1, 1, 1, 1, 1,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,33, 1, 1, 1, 1, 1,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,33, 1, 1, 1, 1, 1,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,  0, 0, 0,37, 5, 5, 5, 5, 5,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0, 0,36, 4, 4, 4, 4,  0, 0, 0, 0,36, 4, 4, 4, 4,
+     0, 0, 0, 0,36, 4, 4, 4, 4,  0, 0, 0, 0,36, 4, 4, 4, 4,  0, 0, 0, 0,36, 4, 4, 4, 4,
+     0, 0, 0, 0,36, 4, 4, 4, 4,  0, 0, 0, 0,36, 4, 4, 4, 4,  0, 0, 0, 0,36, 4, 4, 4, 4,
+     0, 0, 0, 0,33, 1, 1, 1, 1,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,33, 1, 1, 1, 1,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,33, 1, 1, 1, 1,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,33, 1, 1, 1, 1,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,33, 1, 1, 1, 1,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,33, 1, 1, 1, 1,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,33, 1, 1, 1, 1,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,33, 1, 1, 1, 1,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,  0, 0, 0, 0,37, 5, 5, 5, 5,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0, 0,36, 4, 4, 4,  0, 0, 0, 0, 0,36, 4, 4, 4,
+     0, 0, 0, 0, 0,36, 4, 4, 4,  0, 0, 0, 0, 0,36, 4, 4, 4,  0, 0, 0, 0, 0,36, 4, 4, 4,
+     0, 0, 0, 0, 0,36, 4, 4, 4,  0, 0, 0, 0, 0,36, 4, 4, 4,  0, 0, 0, 0, 0,36, 4, 4, 4,
+     0, 0, 0, 0, 0,33, 1, 1, 1,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,33, 1, 1, 1,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,33, 1, 1, 1,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,33, 1, 1, 1,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,33, 1, 1, 1,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,33, 1, 1, 1,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,33, 1, 1, 1,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,33, 1, 1, 1,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,  0, 0, 0, 0, 0,37, 5, 5, 5,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0, 0,36, 4, 4,  0, 0, 0, 0, 0, 0,36, 4, 4,
+     0, 0, 0, 0, 0, 0,36, 4, 4,  0, 0, 0, 0, 0, 0,36, 4, 4,  0, 0, 0, 0, 0, 0,36, 4, 4,
+     0, 0, 0, 0, 0, 0,36, 4, 4,  0, 0, 0, 0, 0, 0,36, 4, 4,  0, 0, 0, 0, 0, 0,36, 4, 4,
+     0, 0, 0, 0, 0, 0,33, 1, 1,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,33, 1, 1,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,33, 1, 1,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,33, 1, 1,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,33, 1, 1,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,33, 1, 1,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,33, 1, 1,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,33, 1, 1,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,  0, 0, 0, 0, 0, 0,37, 5, 5,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0, 0,36, 4,  0, 0, 0, 0, 0, 0, 0,36, 4,
+     0, 0, 0, 0, 0, 0, 0,36, 4,  0, 0, 0, 0, 0, 0, 0,36, 4,  0, 0, 0, 0, 0, 0, 0,36, 4,
+     0, 0, 0, 0, 0, 0, 0,36, 4,  0, 0, 0, 0, 0, 0, 0,36, 4,  0, 0, 0, 0, 0, 0, 0,36, 4,
+     0, 0, 0, 0, 0, 0, 0,33, 1,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,33, 1,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,33, 1,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,33, 1,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,33, 1,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,33, 1,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,33, 1,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,33, 1,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,  0, 0, 0, 0, 0, 0, 0,37, 5,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0, 0,36,  0, 0, 0, 0, 0, 0, 0, 0,36,
+     0, 0, 0, 0, 0, 0, 0, 0,36,  0, 0, 0, 0, 0, 0, 0, 0,36,  0, 0, 0, 0, 0, 0, 0, 0,36,
+     0, 0, 0, 0, 0, 0, 0, 0,36,  0, 0, 0, 0, 0, 0, 0, 0,36,  0, 0, 0, 0, 0, 0, 0, 0,36,
+     0, 0, 0, 0, 0, 0, 0, 0,33,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,33,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,33,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,33,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,33,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,33,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,33,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,33,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,  0, 0, 0, 0, 0, 0, 0, 0,37,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     2,18,18,18,18,18,18,18,18,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  8,24,24,24,24,24,24,24,24,  0,16,16,16,16,16,16,16,16,
+     0,16,16,16,16,16,16,16,16,  0,16,16,16,16,16,16,16,16,  0,16,16,16,16,16,16,16,16,
+     0,16,16,16,16,16,16,16,16,  0,16,16,16,16,16,16,16,16,  0,16,16,16,16,16,16,16,16,
+     0,34, 2, 2, 2, 2, 2, 2, 2,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0,40, 8, 8, 8, 8, 8, 8, 8,  0,32, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  0,32, 0, 0, 0, 0, 0, 0, 0,  0,32, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  0,32, 0, 0, 0, 0, 0, 0, 0,  0,32, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,34, 2, 2, 2, 2, 2, 2,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,40, 8, 8, 8, 8, 8, 8,  0, 0,32, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0, 0,32, 0, 0, 0, 0, 0, 0,  0, 0,32, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0, 0,32, 0, 0, 0, 0, 0, 0,  0, 0,32, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,34, 2, 2, 2, 2, 2,  0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,40, 8, 8, 8, 8, 8,  0, 0, 0,32, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0, 0,32, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0, 0,32, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,34, 2, 2, 2, 2,  0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,40, 8, 8, 8, 8,  0, 0, 0, 0,32, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0, 0,32, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0, 0,32, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,34, 2, 2, 2,  0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0,40, 8, 8, 8,  0, 0, 0, 0, 0,32, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0, 0,32, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0, 0,32, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,34, 2, 2,  0, 0, 0, 0, 0,41, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,41, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,41, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,41, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,41, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,41, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,41, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,41, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0,40, 8, 8,  0, 0, 0, 0, 0, 0,32, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0, 0,32, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0, 0,32, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,34, 2,  0, 0, 0, 0, 0, 0,41, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,41, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,41, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,41, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,41, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,41, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,41, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,41, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0,40, 8,  0, 0, 0, 0, 0, 0, 0,32, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0, 0,32, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0, 0,32, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,34,  0, 0, 0, 0, 0, 0, 0,41, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,41, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,41, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,41, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,41, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,41, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,41, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,41, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,  0, 0, 0, 0, 0, 0, 0,33, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     2,18,18,18,18,18,18,18,18,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0,34, 2, 2, 2, 2, 2, 2, 2,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  8,24,24,24,24,24,24,24,24,
+     0,16,16,16,16,16,16,16,16,  0,16,16,16,16,16,16,16,16,  0,16,16,16,16,16,16,16,16,
+     0,16,16,16,16,16,16,16,16,  0,16,16,16,16,16,16,16,16,  0,16,16,16,16,16,16,16,16,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,34, 2, 2, 2, 2, 2, 2,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0,40, 8, 8, 8, 8, 8, 8, 8,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  0,32, 0, 0, 0, 0, 0, 0, 0,  0,32, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  0,32, 0, 0, 0, 0, 0, 0, 0,  0,32, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,  0,41, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,34, 2, 2, 2, 2, 2,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,40, 8, 8, 8, 8, 8, 8,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0, 0,32, 0, 0, 0, 0, 0, 0,  0, 0,32, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0, 0,32, 0, 0, 0, 0, 0, 0,  0, 0,32, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,  0, 0,41, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,34, 2, 2, 2, 2,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,40, 8, 8, 8, 8, 8,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0, 0,32, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0, 0,32, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,42,10,10,10,10,  0, 0, 0,41, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,34, 2, 2, 2,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,40, 8, 8, 8, 8,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0, 0,32, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0, 0,32, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0,42,10,10,10,  0, 0, 0, 0,41, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,34, 2, 2,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0,40, 8, 8, 8,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0, 0,32, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0, 0,32, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0,42,10,10,  0, 0, 0, 0, 0,41, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,34, 2,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,41, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,41, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,41, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,41, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,41, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,41, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,41, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0,40, 8, 8,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0, 0,32, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0, 0,32, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0,42,10,  0, 0, 0, 0, 0, 0,41, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,34,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,41, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,41, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,41, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,41, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,41, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,41, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,41, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,  0, 0, 0, 0, 0, 0,33, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     2,18,18,18,18,18,18,18,18,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0,34, 2, 2, 2, 2, 2, 2, 2,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,34, 2, 2, 2, 2, 2, 2,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     8,24,24,24,24,24,24,24,24,  0,16,16,16,16,16,16,16,16,  0,16,16,16,16,16,16,16,16,
+     0,16,16,16,16,16,16,16,16,  0,16,16,16,16,16,16,16,16,  0,16,16,16,16,16,16,16,16,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,
+     9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,34, 2, 2, 2, 2, 2,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,40, 8, 8, 8, 8, 8, 8, 8,  0,32, 0, 0, 0, 0, 0, 0, 0,  0,32, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  0,32, 0, 0, 0, 0, 0, 0, 0,  0,32, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,
+     0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,34, 2, 2, 2, 2,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,40, 8, 8, 8, 8, 8, 8,  0, 0,32, 0, 0, 0, 0, 0, 0,  0, 0,32, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0, 0,32, 0, 0, 0, 0, 0, 0,  0, 0,32, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,
+     0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,42,10,10,10,10,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,34, 2, 2, 2,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,40, 8, 8, 8, 8, 8,  0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0, 0,32, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0, 0,32, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,42,10,10,10,10,
+     0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0,42,10,10,10,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,34, 2, 2,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,40, 8, 8, 8, 8,  0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0, 0,32, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0, 0,32, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0,42,10,10,10,
+     0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0,42,10,10,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,34, 2,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,40, 8, 8, 8,  0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0, 0,32, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0, 0,32, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0,42,10,10,
+     0, 0, 0, 0, 0,41, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0,42,10,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,41, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,34,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,41, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,41, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,41, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,41, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,41, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,41, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,  0, 0, 0, 0, 0,33, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     2,18,18,18,18,18,18,18,18,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0,34, 2, 2, 2, 2, 2, 2, 2,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,34, 2, 2, 2, 2, 2, 2,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10,26,26,26,26,26,26,26,26,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,34, 2, 2, 2, 2, 2,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  8,24,24,24,24,24,24,24,24,  0,16,16,16,16,16,16,16,16,
+     0,16,16,16,16,16,16,16,16,  0,16,16,16,16,16,16,16,16,  0,16,16,16,16,16,16,16,16,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,42,10,10,10,10,10,10,10,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,34, 2, 2, 2, 2,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0,40, 8, 8, 8, 8, 8, 8, 8,  0,32, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  0,32, 0, 0, 0, 0, 0, 0, 0,  0,32, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,42,10,10,10,10,10,10,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,42,10,10,10,10,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,34, 2, 2, 2,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,40, 8, 8, 8, 8, 8, 8,  0, 0,32, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0, 0,32, 0, 0, 0, 0, 0, 0,  0, 0,32, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,42,10,10,10,10,10,  0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,42,10,10,10,10,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0,42,10,10,10,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,34, 2, 2,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,40, 8, 8, 8, 8, 8,  0, 0, 0,32, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0, 0,32, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,42,10,10,10,10,  0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0,42,10,10,10,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0,42,10,10,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,34, 2,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,40, 8, 8, 8, 8,  0, 0, 0, 0,32, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0, 0,32, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,42,10,10,10,  0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0,42,10,10,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0,42,10,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,34,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,41, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,  0, 0, 0, 0,33, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     2,18,18,18,18,18,18,18,18,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0,34, 2, 2, 2, 2, 2, 2, 2,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,34, 2, 2, 2, 2, 2, 2,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10,26,26,26,26,26,26,26,26,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,34, 2, 2, 2, 2, 2,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,42,10,10,10,10,10,10,10,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,34, 2, 2, 2, 2,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  8,24,24,24,24,24,24,24,24,
+     0,16,16,16,16,16,16,16,16,  0,16,16,16,16,16,16,16,16,  0,16,16,16,16,16,16,16,16,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,42,10,10,10,10,10,10,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,42,10,10,10,10,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,34, 2, 2, 2,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0,40, 8, 8, 8, 8, 8, 8, 8,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  0,32, 0, 0, 0, 0, 0, 0, 0,  0,32, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,  0,41, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,42,10,10,10,10,10,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,42,10,10,10,10,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0,42,10,10,10,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,34, 2, 2,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,
+     0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,40, 8, 8, 8, 8, 8, 8,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0, 0,32, 0, 0, 0, 0, 0, 0,  0, 0,32, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,  0, 0,41, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,42,10,10,10,10,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0,42,10,10,10,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0,42,10,10,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,34, 2,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,41, 0, 0, 0, 0, 0, 0,
+     0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,40, 8, 8, 8, 8, 8,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0, 0,32, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,42,10,10,10,10,  0, 0, 0,41, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,42,10,10,10,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0,42,10,10,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0,42,10,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,34,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,41, 0, 0, 0, 0, 0,
+     0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,  0, 0, 0,33, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     2,18,18,18,18,18,18,18,18,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0,34, 2, 2, 2, 2, 2, 2, 2,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,34, 2, 2, 2, 2, 2, 2,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10,26,26,26,26,26,26,26,26,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,34, 2, 2, 2, 2, 2,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,42,10,10,10,10,10,10,10,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,34, 2, 2, 2, 2,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,42,10,10,10,10,10,10,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,42,10,10,10,10,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,34, 2, 2, 2,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     8,24,24,24,24,24,24,24,24,  0,16,16,16,16,16,16,16,16,  0,16,16,16,16,16,16,16,16,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,
+     9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,42,10,10,10,10,10,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,42,10,10,10,10,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0,42,10,10,10,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,34, 2, 2,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,40, 8, 8, 8, 8, 8, 8, 8,  0,32, 0, 0, 0, 0, 0, 0, 0,  0,32, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,
+     0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,42,10,10,10,10,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0,42,10,10,10,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0,42,10,10,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,34, 2,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,40, 8, 8, 8, 8, 8, 8,  0, 0,32, 0, 0, 0, 0, 0, 0,  0, 0,32, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,
+     0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,42,10,10,10,10,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,42,10,10,10,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0,42,10,10,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0,42,10,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,34,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,41, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,  0, 0,33, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     2,18,18,18,18,18,18,18,18,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     0,16,16,16,16,16,16,16,16,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,  4,20,20,20,20,20,20,20,20,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0,34, 2, 2, 2, 2, 2, 2, 2,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,32, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,34, 2, 2, 2, 2, 2, 2,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,32, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10,26,26,26,26,26,26,26,26,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,34, 2, 2, 2, 2, 2,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,32, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,42,10,10,10,10,10,10,10,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,34, 2, 2, 2, 2,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,32, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,42,10,10,10,10,10,10,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,42,10,10,10,10,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,34, 2, 2, 2,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,32, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10,26,26,26,26,26,26,26,26,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,42,10,10,10,10,10,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,42,10,10,10,10,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0,42,10,10,10,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,34, 2, 2,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,32, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  8,24,24,24,24,24,24,24,24,  0,16,16,16,16,16,16,16,16,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,42,10,10,10,10,10,10,10,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,42,10,10,10,10,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0,42,10,10,10,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0,42,10,10,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,34, 2,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,32, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,  1, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0,40, 8, 8, 8, 8, 8, 8, 8,  0,32, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,42,10,10,10,10,10,10,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,42,10,10,10,10,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,42,10,10,10,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0,42,10,10,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0,42,10,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,34,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,32,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,41, 0, 0, 0, 0, 0, 0, 0,  0,33, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     2,18,18,18,18,18,18,18,18,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,  6,22,22,22,22,22,22,22,22,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0,34, 2, 2, 2, 2, 2, 2, 2,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,34, 2, 2, 2, 2, 2, 2,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10,26,26,26,26,26,26,26,26,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,34, 2, 2, 2, 2, 2,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,  2,18,18,18,18,18,18,18,18,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,42,10,10,10,10,10,10,10,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,34, 2, 2, 2, 2,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,
+     2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,42,10,10,10,10,10,10,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,42,10,10,10,10,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,34, 2, 2, 2,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10,26,26,26,26,26,26,26,26,  2,18,18,18,18,18,18,18,18,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,42,10,10,10,10,10,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,42,10,10,10,10,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0,42,10,10,10,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0,34, 2, 2,  0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,
+     8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 10,26,26,26,26,26,26,26,26,  2,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,42,10,10,10,10,10,10,10,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0,42,10,10,10,10,10,10,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,42,10,10,10,10,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0,42,10,10,10,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0,42,10,10,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,34, 2,  0, 0, 0, 0, 0, 0,40, 0, 0,  0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,  0, 0,40, 0, 0, 0, 0, 0, 0,
+     0,40, 0, 0, 0, 0, 0, 0, 0,  8, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  8,24,24,24,24,24,24,24,24,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0,42,10,10,10,10,10,10,10,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0,42,10,10,10,10,10,10,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0,42,10,10,10,10,10,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,42,10,10,10,10,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0,42,10,10,10,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0,42,10,10,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0,42,10,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,34,  0, 0, 0, 0, 0, 0, 0,40, 0,  0, 0, 0, 0, 0, 0,40, 0, 0,
+     0, 0, 0, 0, 0,40, 0, 0, 0,  0, 0, 0, 0,40, 0, 0, 0, 0,  0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0,40, 0, 0, 0, 0, 0, 0,  0,40, 0, 0, 0, 0, 0, 0, 0,  9, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+#endif // PATTERN_TABLE_H
@@ -0,0 +1,466 @@
+/**
+ * @file patterns.c
+ * @brief Implementation for the local pattern deductions.
+ *
+ * Source code for the pattern table in front of the solver: the
+ * deductions a player makes at a glance, 1-2-1 and 1-2-2-1 along a wall,
+ * a 1 in a corner, looked up in a table instead of worked out.
+ *
+ * Design Philosophy:
+ *
+ * Numbers are read from board_pointer, and the hidden tiles from the
+ * solver: its known mines count as mines, its known safe tiles as empty,
+ * and every other hidden tile is unknown, flagged or not, so a wrong
+ * flag cannot force a wrong tile. Each number is looked up alone, and
+ * together with every number it shares an unknown tile with; on the
+ * square board those are the numbers in the 5x5 around it. The table
+ * finds deductions the solver's equations miss, not the same ones
+ * sooner. A pair splits its unknown tiles into around A only, around
+ * both and around B only, and what that forces depends only on the
+ * counts, so PATTERN_TABLE is keyed by the mines each number still
+ * needs and the size of each group. The table is built offline by
+ * tools/gen_pattern_table.c.
+ *
+ * Only numbers whose surroundings changed are looked up again, read
+ * from the board's change journal, and not before a tile is asked for,
+ * so while the solver still has safe tiles queued the table costs only
+ * the journal read.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "solver/pattern_table.h"
+#include "solver/patterns.h"
+#include "solver/solver.h"
+
+#define PATTERNS_WINDOW 7        // the 5x5 of partners and the tiles around them, on the square board
+#define PATTERNS_BOX    0x1C387u // the 3x3 in the top left corner of the window, a bit per cell
+
+/**
+ * This function returns what the solver knows about a cell. Guard cells
+ * count as revealed.
+ */
+static enum SolverCell patterns__known(int index, struct Patterns *patterns) {
+  struct Board *board = patterns->board;
+
+  if (board->reveal_pointer[index]) {
+    return SOLVER_REVEALED;
+  }
+  return (enum SolverCell) patterns->solver->cells[board__index_x(index, board) * patterns->cols +
+                                                   board__index_y(index, board)];
+}
+
+/**
+ * This function returns the PATTERN_TABLE entry of a pair of numbers:
+ * the mines each still needs and the hidden tiles around A only, both
+ * and B only.
+ */
+static int patterns__lookup(int need_a, int need_b, int only_a, int shared, int only_b) {
+  int key = (((need_a * PATTERN_RADIX + need_b) * PATTERN_RADIX + only_a) * PATTERN_RADIX + shared) * PATTERN_RADIX +
+            only_b;
+  return PATTERN_TABLE[key];
+}
+
+/**
+ * This function lists the unknown tiles around a number and returns how
+ * many mines it still needs, less the known mines around it.
+ *
+ * @param index the grid index of the number
+ * @param hidden where to list the unknown tiles, BOARD_NUM_NEIGHBORS long
+ * @param num_hidden where to store how many there are
+ * @param patterns the patterns
+ *
+ * @return the mines still needed
+ */
+static int patterns__around(int index, int *hidden, int *num_hidden, struct Patterns *patterns) {
+  struct Board *board = patterns->board;
+  int need = board->board_pointer[index] - '0';
+
+  *num_hidden = 0;
+  for (int k = 0; k < board->board_num_neighbors; k++) {
+    int neighbor = board__neighbor(index, k, board);
+    enum SolverCell known = patterns__known(neighbor, patterns);
+    if (known == SOLVER_UNKNOWN) {
+      hidden[(*num_hidden)++] = neighbor;
+    } else {
+      need -= known == SOLVER_MINE;
+    }
+  }
+  return need;
+}
+
+/**
+ * This function queues a forced tile, unless it already is.
+ *
+ * @param tile the tile, x * cols + y
+ * @param mine whether it holds a mine
+ * @param patterns the patterns
+ */
+static void patterns__queue(int tile, bool mine, struct Patterns *patterns) {
+  if (!patterns->queued[tile]) {
+    patterns->queued[tile] = true;
+    patterns->moves[patterns->num_moves++] = tile * 2 + mine;
+  }
+}
+
+/**
+ * This function queues every tile of a group the table forced.
+ *
+ * @param group the tiles, as grid indexes
+ * @param size how many
+ * @param forced 1 if they are safe, 2 if mines, 0 if not forced
+ * @param patterns the patterns
+ */
+static void patterns__force(const int *group, int size, int forced, struct Patterns *patterns) {
+  struct Board *board = patterns->board;
+
+  if (forced == 0) {
+    return;
+  }
+  for (int i = 0; i < size; i++) {
+    int tile = board__index_x(group[i], board) * patterns->cols + board__index_y(group[i], board);
+    patterns__queue(tile, forced == 2, patterns);
+  }
+}
+
+/**
+ * This function queues every tile of a group of the square window the
+ * table forced.
+ *
+ * @param group the tiles, a bit per cell of the window
+ * @param forced 1 if they are safe, 2 if mines, 0 if not forced
+ * @param x the x coordinate of the middle of the window
+ * @param y the y coordinate of the middle of the window
+ * @param patterns the patterns
+ */
+static void patterns__force_window(uint64_t group, int forced, int x, int y, struct Patterns *patterns) {
+  if (forced == 0) {
+    return;
+  }
+  while (group != 0) {
+    int bit = solver__lowest(group);
+    group &= group - 1;
+    int tile = (x + bit / PATTERNS_WINDOW - PATTERNS_WINDOW / 2) * patterns->cols + y + bit % PATTERNS_WINDOW -
+               PATTERNS_WINDOW / 2;
+    patterns__queue(tile, forced == 2, patterns);
+  }
+}
+
+/**
+ * This function is patterns__scan on the square row-major board. It
+ * reads the 7x7 around the number once, as masks of unknown tiles and
+ * known mines, so each pair costs a few popcounts.
+ *
+ * @param index the grid index of the number
+ * @param patterns the patterns
+ */
+static void patterns__scan_square(int index, struct Patterns *patterns) {
+  struct Board *board = patterns->board;
+  int x = board__index_x(index, board);
+  int y = board__index_y(index, board);
+  int middle = PATTERNS_WINDOW / 2;
+  signed char numbers[PATTERNS_WINDOW * PATTERNS_WINDOW];
+  uint64_t numbered = 0;
+  uint64_t hidden = 0;
+  uint64_t flags = 0; // the known mines
+
+  // the part of the window on the board
+  int first_i = x >= middle ? 0 : middle - x;
+  int last_i = x + middle < board->board_x ? PATTERNS_WINDOW : board->board_x - x + middle;
+  int first_j = y >= middle ? 0 : middle - y;
+  int last_j = y + middle < board->board_y ? PATTERNS_WINDOW : board->board_y - y + middle;
+  for (int i = first_i; i < last_i; i++) {
+    const char *row = board->board_pointer + index + (i - middle) * board->board_stride - middle;
+    const bool *revealed = board->reveal_pointer + index + (i - middle) * board->board_stride - middle;
+    const unsigned char *known = patterns->solver->cells + (x + i - middle) * patterns->cols + y - middle;
+    // without branches, the cells are too mixed to predict
+    for (int j = first_j; j < last_j; j++) {
+      int bit = i * PATTERNS_WINDOW + j;
+      uint64_t hidden_cell = !revealed[j];
+      uint64_t number = (unsigned) (row[j] - '0') <= 8;
+      flags |= (uint64_t) (hidden_cell & (known[j] == SOLVER_MINE)) << bit;
+      hidden |= (uint64_t) (hidden_cell & (known[j] == SOLVER_UNKNOWN)) << bit;
+      numbered |= (~hidden_cell & number) << bit;
+      numbers[bit] = (signed char) (row[j] - '0');
+    }
+  }
+
+  uint64_t box_a = (uint64_t) PATTERNS_BOX << ((middle - 1) * PATTERNS_WINDOW + middle - 1);
+  uint64_t hidden_a = hidden & box_a;
+  int need_a = numbers[middle * PATTERNS_WINDOW + middle] - solver__popcount(flags & box_a);
+  if (hidden_a == 0 || need_a < 0) {
+    return;
+  }
+  patterns__force_window(hidden_a, patterns__lookup(need_a, 0, solver__popcount(hidden_a), 0, 0) & 3, x, y,
+                         patterns);
+
+  // the numbers whose 3x3 holds one of its hidden tiles
+  uint64_t reach = hidden_a | hidden_a << 1 | hidden_a >> 1;
+  reach |= reach << PATTERNS_WINDOW | reach >> PATTERNS_WINDOW;
+  uint64_t partners = reach & numbered & ~((uint64_t) 1 << (middle * PATTERNS_WINDOW + middle));
+  while (partners != 0) {
+    int bit = solver__lowest(partners);
+    partners &= partners - 1;
+    uint64_t box_b = (uint64_t) PATTERNS_BOX << (bit - PATTERNS_WINDOW - 1);
+    uint64_t shared = hidden_a & box_b;
+    uint64_t only_a = hidden_a & ~box_b;
+    uint64_t only_b = hidden & box_b & ~box_a;
+    int need_b = numbers[bit] - solver__popcount(flags & box_b);
+    if (need_b < 0) {
+      continue;
+    }
+
+    int forced = patterns__lookup(need_a, need_b, solver__popcount(only_a), solver__popcount(shared),
+                                  solver__popcount(only_b));
+    patterns__force_window(only_a, forced & 3, x, y, patterns);
+    patterns__force_window(shared, forced >> 2 & 3, x, y, patterns);
+    patterns__force_window(only_b, forced >> 4 & 3, x, y, patterns);
+  }
+}
+
+/**
+ * This function looks a number up alone and together with every number
+ * it shares a hidden tile with, and queues what is forced.
+ *
+ * @param index the grid index of the tile, numbered or not
+ * @param patterns the patterns
+ */
+static void patterns__scan(int index, struct Patterns *patterns) {
+  struct Board *board = patterns->board;
+  int around_a[BOARD_NUM_NEIGHBORS];
+  int num_a;
+
+  if (board->board_pointer[index] < '0' || board->board_pointer[index] > '8' || !board->reveal_pointer[index]) {
+    return;
+  }
+  if (board->board_square && board->board_uniform) {
+    patterns__scan_square(index, patterns);
+    return;
+  }
+  int need_a = patterns__around(index, around_a, &num_a, patterns);
+  if (num_a == 0 || need_a < 0) {
+    return;
+  }
+  patterns__force(around_a, num_a, patterns__lookup(need_a, 0, num_a, 0, 0) & 3, patterns);
+
+  // the numbers sharing a hidden tile with this one, each once
+  int partners[BOARD_NUM_NEIGHBORS * BOARD_NUM_NEIGHBORS];
+  int num_partners = 0;
+  for (int i = 0; i < num_a; i++) {
+    for (int k = 0; k < board->board_num_neighbors; k++) {
+      int other = board__neighbor(around_a[i], k, board);
+      char cell = board->board_pointer[other];
+      if (other == index || !board->reveal_pointer[other] || cell < '0' || cell > '8') {
+        continue;
+      }
+      bool listed = false;
+      for (int j = 0; j < num_partners && !listed; j++) {
+        listed = partners[j] == other;
+      }
+      if (!listed) {
+        partners[num_partners++] = other;
+      }
+    }
+  }
+
+  for (int p = 0; p < num_partners; p++) {
+    int around_b[BOARD_NUM_NEIGHBORS];
+    int num_b;
+    int need_b = patterns__around(partners[p], around_b, &num_b, patterns);
+    if (need_b < 0) {
+      continue;
+    }
+
+    // split into A only, both and B only
+    int only_a[BOARD_NUM_NEIGHBORS];
+    int shared[BOARD_NUM_NEIGHBORS];
+    int only_b[BOARD_NUM_NEIGHBORS];
+    int num_only_a = 0;
+    int num_shared = 0;
+    int num_only_b = 0;
+    for (int i = 0; i < num_a; i++) {
+      bool in_b = false;
+      for (int j = 0; j < num_b && !in_b; j++) {
+        in_b = around_b[j] == around_a[i];
+      }
+      if (in_b) {
+        shared[num_shared++] = around_a[i];
+      } else {
+        only_a[num_only_a++] = around_a[i];
+      }
+    }
+    for (int j = 0; j < num_b; j++) {
+      bool in_a = false;
+      for (int i = 0; i < num_shared && !in_a; i++) {
+        in_a = shared[i] == around_b[j];
+      }
+      if (!in_a) {
+        only_b[num_only_b++] = around_b[j];
+      }
+    }
+
+    int forced = patterns__lookup(need_a, need_b, num_only_a, num_shared, num_only_b);
+    patterns__force(only_a, num_only_a, forced & 3, patterns);
+    patterns__force(shared, num_shared, forced >> 2 & 3, patterns);
+    patterns__force(only_b, num_only_b, forced >> 4 & 3, patterns);
+  }
+}
+
+//------------------------------//
+//   CONSTRUCTOR / DESTRUCTOR   //
+//------------------------------//
+
+/**
+ * This function builds the patterns of a solver's board, reading what
+ * the board shows and the solver knows now. The solver must outlive them.
+ *
+ * @param solver the solver whose board to read
+ * @param patterns the patterns to be built
+ *
+ * @return true if built; false if out of memory
+ */
+bool patterns__create(struct Solver *solver, struct Patterns *patterns) {
+  struct Board *board = solver->board;
+  int num_cells = board__get_x(board) * board__get_y(board);
+
+  patterns->solver = solver;
+  patterns->board = board;
+  patterns->cols = board__get_y(board);
+  patterns->seen = (int *)calloc(board->board_cells, sizeof(int));
+  patterns->pending = (int *)malloc(board->board_cells * sizeof(int));
+  patterns->queued = (bool *)malloc(num_cells * sizeof(bool));
+  patterns->moves = (int *)malloc(num_cells * sizeof(int));
+
+  if (patterns->seen == NULL || patterns->pending == NULL || patterns->queued == NULL || patterns->moves == NULL) {
+    patterns__destruct(patterns);
+    return false;
+  }
+
+  patterns->scan = 0;
+  patterns__reset(patterns);
+  return true;
+}
+
+/**
+ * This function frees the arrays of the patterns.
+ *
+ * @param patterns the patterns to be freed
+ */
+void patterns__destruct(struct Patterns *patterns) {
+  free(patterns->seen);
+  free(patterns->pending);
+  free(patterns->queued);
+  free(patterns->moves);
+
+  patterns->seen = NULL;
+  patterns->pending = NULL;
+  patterns->queued = NULL;
+  patterns->moves = NULL;
+}
+
+//-------------//
+//   LOOKUPS   //
+//-------------//
+
+/**
+ * This function marks a cell to be looked up before the next tile is
+ * handed out, unless it already is.
+ *
+ * @param index the grid index of the cell, numbered or not
+ * @param patterns the patterns
+ */
+static void patterns__mark(int index, struct Patterns *patterns) {
+  if (patterns->seen[index] != patterns->scan) {
+    patterns->seen[index] = patterns->scan;
+    patterns->pending[patterns->num_pending++] = index;
+  }
+}
+
+/**
+ * This function forgets the forced tiles and marks every number on the
+ * board to be looked up again, as after the board was reset for a new
+ * game.
+ *
+ * @param patterns the patterns to be reset
+ */
+void patterns__reset(struct Patterns *patterns) {
+  struct Board *board = patterns->board;
+
+  memset(patterns->queued, 0, board__get_x(board) * patterns->cols * sizeof(bool));
+  patterns->num_moves = 0;
+  patterns->next_move = 0;
+  patterns->num_pending = 0;
+  patterns->scan++;
+
+  for (int x = 0; x < board__get_x(board); x++) {
+    for (int y = 0; y < board__get_y(board); y++) {
+      patterns__mark(board__index(x, y, board), patterns);
+    }
+  }
+}
+
+/**
+ * This function marks every number the last move changed the
+ * surroundings of to be looked up again, read from the board's change
+ * journal: the changed tiles and the numbers around them. Call it after
+ * every move, before the journal is cleared. The lookups wait for
+ * patterns__next.
+ *
+ * @param patterns the patterns
+ *
+ * @return the number of cells waiting to be looked up
+ */
+int patterns__update(struct Patterns *patterns) {
+  struct Board *board = patterns->board;
+
+  for (int i = 0; i < board__get_num_changes(board); i++) {
+    int changed = board->changed_cells[i];
+    patterns__mark(changed, patterns);
+    for (int k = 0; k < board->board_num_neighbors; k++) {
+      patterns__mark(board__neighbor(changed, k, board), patterns);
+    }
+  }
+  return patterns->num_pending;
+}
+
+/**
+ * This function hands out the next forced tile that still needs a move
+ * and the solver does not know yet: a safe tile still hidden, or a mine
+ * not flagged yet. The marked numbers are looked up first when no forced
+ * tile is left. Returns false if there is none.
+ *
+ * @param x where to store the x coordinate
+ * @param y where to store the y coordinate
+ * @param mine where to store whether it is a mine
+ * @param patterns the patterns
+ *
+ * @return true if a tile was found; false otherwise
+ */
+bool patterns__next(int *x, int *y, bool *mine, struct Patterns *patterns) {
+  struct Board *board = patterns->board;
+
+  for (;;) {
+    while (patterns->next_move < patterns->num_moves) {
+      int move = patterns->moves[patterns->next_move++];
+      *x = move / 2 / patterns->cols;
+      *y = move / 2 % patterns->cols;
+      *mine = move & 1;
+      if (patterns->solver->cells[move / 2] == SOLVER_UNKNOWN && !board__is_revealed(*x, *y, board) &&
+          board__get_cell(*x, *y, board) != 'F') {
+        return true;
+      }
+    }
+    if (patterns->num_pending == 0) {
+      return false;
+    }
+    for (int i = 0; i < patterns->num_pending; i++) {
+      patterns__scan(patterns->pending[i], patterns);
+    }
+    patterns->num_pending = 0;
+    patterns->scan++;
+  }
+}
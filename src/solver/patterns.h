@@ -0,0 +1,34 @@
+/**
+ * @file patterns.h
+ * @brief The header for patterns.
+ */
+#ifndef PATTERNS_H
+#define PATTERNS_H
+
+#include <stdbool.h>
+
+#include "board/board.h"
+#include "solver/solver.h"
+
+// local deductions read off the visible board and the solver's known tiles with PATTERN_TABLE
+struct Patterns {
+    struct Solver* solver;
+    struct Board*  board;
+    int            cols;
+    int*           seen;      // the scan each cell of the grids was last marked in
+    int            scan;
+    int*           pending;   // cells marked to be looked up, as grid indexes
+    int            num_pending;
+    bool*          queued;    // forced tiles already in moves
+    int*           moves;     // forced tiles as (x * cols + y) * 2, plus 1 for a mine
+    int            num_moves;
+    int            next_move; // moves before this one were handed out
+};
+
+bool patterns__create(struct Solver* solver, struct Patterns* patterns);
+void patterns__destruct(struct Patterns* patterns);
+void patterns__reset(struct Patterns* patterns);
+int  patterns__update(struct Patterns* patterns);
+bool patterns__next(int* x, int* y, bool* mine, struct Patterns* patterns);
+
+#endif // PATTERNS_H
@@ -0,0 +1,540 @@
+/**
+ * @file solver.c
+ * @brief Implementation for the constraint solver.
+ *
+ * Source code for a solver that deduces safe tiles and mines from the
+ * numbers on a board, the way a player does, without looking at where
+ * the mines are.
+ *
+ * Design Philosophy:
+ *
+ * Every revealed number is an equation: the hidden tiles around it sum
+ * to the number, less the mines already deduced there. The equations are
+ * kept reduced, Gauss-Jordan style: each row is solved for one pivot
+ * tile, which is eliminated from every other row. A row is two bitsets
+ * over the tiles of the board, the tiles with coefficient +1 and those
+ * with -1, so adding or subtracting rows is a pass of AND, OR and
+ * AND-NOT over whole words. A row operation that would give some tile a
+ * coefficient of 2 is skipped; the rows stay true equations and only
+ * that elimination is left out.
+ *
+ * A row with value equal to its number of +1 tiles says all of them are
+ * mines and all its -1 tiles are safe; a value equal to minus its number
+ * of -1 tiles says the opposite. A deduced tile is substituted into the
+ * rows, which may settle more rows, until nothing changes.
+ *
+ * The matrix is kept between moves. solver__update reads the board's
+ * change journal: a tile being revealed takes its column out and adds
+ * its number as a new row, reduced against the pivots already there.
+ * Only rows that changed are checked again, so a move costs about the
+ * rows its new tiles touch rather than the whole frontier.
+ *
+ * Flags and guesses are the player's and are not trusted: a flagged tile
+ * is an unknown like any other hidden tile.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "solver/solver.h"
+
+/**
+ * This function returns the +1 bitset of a row.
+ */
+static uint64_t *solver__pos(int row, struct Solver *solver) {
+  return solver->pos + (size_t) row * solver->words;
+}
+
+/**
+ * This function returns the -1 bitset of a row.
+ */
+static uint64_t *solver__neg(int row, struct Solver *solver) {
+  return solver->neg + (size_t) row * solver->words;
+}
+
+/**
+ * This function returns the coefficient of a tile in a row: 1, -1 or 0.
+ */
+static int solver__coefficient(int row, int tile, struct Solver *solver) {
+  uint64_t bit = 1ull << (tile & 63);
+  if (solver__pos(row, solver)[tile >> 6] & bit) {
+    return 1;
+  }
+  return solver__neg(row, solver)[tile >> 6] & bit ? -1 : 0;
+}
+
+//------------------------------//
+//   CONSTRUCTOR / DESTRUCTOR   //
+//------------------------------//
+
+/**
+ * This function builds a solver for a board, reading what the board
+ * shows now. The board must outlive the solver and keep its size.
+ * Returns false if the board has more than SOLVER_MAX_CELLS tiles or out
+ * of memory.
+ *
+ * @param board the board to solve
+ * @param solver the solver to be built
+ *
+ * @return true if built; false otherwise
+ */
+bool solver__create(struct Board *board, struct Solver *solver) {
+  int num_cells = board__get_x(board) * board__get_y(board);
+  if (num_cells > SOLVER_MAX_CELLS) {
+    return false;
+  }
+
+  solver->board = board;
+  solver->cols = board__get_y(board);
+  solver->num_cells = num_cells;
+  solver->words = (num_cells + 63) / 64;
+
+  size_t bits = (size_t) num_cells * solver->words;
+  solver->cells = (unsigned char *)malloc(num_cells);
+  solver->pos = (uint64_t *)malloc(bits * sizeof(uint64_t));
+  solver->neg = (uint64_t *)malloc(bits * sizeof(uint64_t));
+  solver->value = (int *)malloc(num_cells * sizeof(int));
+  solver->pivot = (int *)malloc(num_cells * sizeof(int));
+  solver->dirty = (bool *)malloc(num_cells * sizeof(bool));
+  solver->pivot_row = (int *)malloc(num_cells * sizeof(int));
+  solver->rows = (int *)malloc(num_cells * sizeof(int));
+  solver->free_rows = (int *)malloc(num_cells * sizeof(int));
+  solver->safe = (int *)malloc(num_cells * sizeof(int));
+  solver->scratch = (uint64_t *)malloc(2 * solver->words * sizeof(uint64_t));
+
+  if (solver->cells == NULL || solver->pos == NULL || solver->neg == NULL || solver->value == NULL ||
+      solver->pivot == NULL || solver->dirty == NULL || solver->pivot_row == NULL || solver->rows == NULL ||
+      solver->free_rows == NULL || solver->safe == NULL || solver->scratch == NULL) {
+    solver__destruct(solver);
+    return false;
+  }
+
+  solver__reset(solver);
+  return true;
+}
+
+/**
+ * This function frees the arrays of a solver.
+ *
+ * @param solver the solver to be freed
+ */
+void solver__destruct(struct Solver *solver) {
+  free(solver->cells);
+  free(solver->pos);
+  free(solver->neg);
+  free(solver->value);
+  free(solver->pivot);
+  free(solver->dirty);
+  free(solver->pivot_row);
+  free(solver->rows);
+  free(solver->free_rows);
+  free(solver->safe);
+  free(solver->scratch);
+
+  solver->cells = NULL;
+  solver->pos = NULL;
+  solver->neg = NULL;
+  solver->value = NULL;
+  solver->pivot = NULL;
+  solver->dirty = NULL;
+  solver->pivot_row = NULL;
+  solver->rows = NULL;
+  solver->free_rows = NULL;
+  solver->safe = NULL;
+  solver->scratch = NULL;
+}
+
+//------------//
+//   MATRIX   //
+//------------//
+
+/**
+ * This function takes a row out of use.
+ *
+ * @param slot where the row is in the list of rows in use
+ * @param solver the solver
+ */
+static void solver__drop_row(int slot, struct Solver *solver) {
+  int row = solver->rows[slot];
+
+  if (solver->pivot[row] >= 0) {
+    solver->pivot_row[solver->pivot[row]] = -1;
+  }
+  solver->rows[slot] = solver->rows[--solver->num_rows];
+  solver->free_rows[solver->num_free++] = row;
+}
+
+/**
+ * This function adds a multiple of the pivot row to a row so that the
+ * tile drops out of it. It does nothing if that would give another tile
+ * a coefficient of 2.
+ *
+ * @param row the row to reduce
+ * @param pivot_row a row holding the tile
+ * @param tile the tile to drop
+ * @param solver the solver
+ *
+ * @return true if the tile was dropped; false otherwise
+ */
+static bool solver__combine(int row, int pivot_row, int tile, struct Solver *solver) {
+  // adding q = -f * pivot_row, where f makes the tile cancel
+  bool negate = solver__coefficient(row, tile, solver) == solver__coefficient(pivot_row, tile, solver);
+  const uint64_t *q_pos = negate ? solver__neg(pivot_row, solver) : solver__pos(pivot_row, solver);
+  const uint64_t *q_neg = negate ? solver__pos(pivot_row, solver) : solver__neg(pivot_row, solver);
+  uint64_t *pos = solver__pos(row, solver);
+  uint64_t *neg = solver__neg(row, solver);
+
+  for (int w = 0; w < solver->words; w++) {
+    if ((pos[w] & q_pos[w]) | (neg[w] & q_neg[w])) {
+      return false;
+    }
+  }
+  for (int w = 0; w < solver->words; w++) {
+    uint64_t new_pos = (pos[w] & ~q_neg[w]) | (q_pos[w] & ~neg[w]);
+    uint64_t new_neg = (neg[w] & ~q_pos[w]) | (q_neg[w] & ~pos[w]);
+    pos[w] = new_pos;
+    neg[w] = new_neg;
+  }
+  solver->value[row] += negate ? -solver->value[pivot_row] : solver->value[pivot_row];
+  solver->dirty[row] = true;
+  return true;
+}
+
+/**
+ * This function solves a row for one of its tiles that no other row is
+ * solved for, and eliminates that tile from every other row.
+ *
+ * @param row the row
+ * @param solver the solver
+ */
+static void solver__choose_pivot(int row, struct Solver *solver) {
+  const uint64_t *pos = solver__pos(row, solver);
+  const uint64_t *neg = solver__neg(row, solver);
+  int tile = -1;
+
+  for (int w = 0; w < solver->words && tile < 0; w++) {
+    uint64_t word = pos[w] | neg[w];
+    while (word != 0 && tile < 0) {
+      int candidate = w * 64 + solver__lowest(word);
+      word &= word - 1;
+      tile = solver->pivot_row[candidate] < 0 ? candidate : -1;
+    }
+  }
+  solver->pivot[row] = tile;
+  if (tile < 0) {
+    return;
+  }
+
+  solver->pivot_row[tile] = row;
+  uint64_t bit = 1ull << (tile & 63);
+  for (int i = 0; i < solver->num_rows; i++) {
+    int other = solver->rows[i];
+    if (other != row && ((solver__pos(other, solver)[tile >> 6] | solver__neg(other, solver)[tile >> 6]) & bit)) {
+      solver__combine(other, row, tile, solver);
+    }
+  }
+}
+
+/**
+ * This function substitutes the value of a tile into every row, taking
+ * its column out of the matrix. A row that was solved for the tile is
+ * solved for another of its tiles.
+ *
+ * @param tile the tile
+ * @param mine 1 if it holds a mine; 0 if not
+ * @param solver the solver
+ */
+static void solver__substitute(int tile, int mine, struct Solver *solver) {
+  uint64_t bit = 1ull << (tile & 63);
+  int word = tile >> 6;
+
+  for (int i = 0; i < solver->num_rows; i++) {
+    int row = solver->rows[i];
+    uint64_t *pos = solver__pos(row, solver);
+    uint64_t *neg = solver__neg(row, solver);
+    if (pos[word] & bit) {
+      pos[word] &= ~bit;
+      solver->value[row] -= mine;
+      solver->dirty[row] = true;
+    } else if (neg[word] & bit) {
+      neg[word] &= ~bit;
+      solver->value[row] += mine;
+      solver->dirty[row] = true;
+    }
+  }
+
+  int row = solver->pivot_row[tile];
+  if (row >= 0) {
+    solver->pivot_row[tile] = -1;
+    solver__choose_pivot(row, solver);
+  }
+}
+
+/**
+ * This function adds the equation of a revealed number: its hidden
+ * neighbors sum to the number less the mines deduced among them. The
+ * new row is reduced by the pivots already in the matrix.
+ *
+ * @param tile the tile of the number
+ * @param number the number
+ * @param solver the solver
+ */
+static void solver__add_row(int tile, int number, struct Solver *solver) {
+  struct Board *board = solver->board;
+  int index = board__index(tile / solver->cols, tile % solver->cols, board);
+  int row = solver->free_rows[solver->num_free - 1];
+  uint64_t *pos = solver__pos(row, solver);
+  bool empty = true;
+
+  memset(pos, 0, solver->words * sizeof(uint64_t));
+  memset(solver__neg(row, solver), 0, solver->words * sizeof(uint64_t));
+  for (int k = 0; k < board->board_num_neighbors; k++) {
+    int neighbor = board__neighbor(index, k, board);
+    int x = board__index_x(neighbor, board);
+    int y = board__index_y(neighbor, board);
+    if (!board__in_bounds(x, y, board)) {
+      continue;
+    }
+    int other = x * solver->cols + y;
+    if (solver->cells[other] == SOLVER_UNKNOWN) {
+      empty = false;
+      pos[other >> 6] |= 1ull << (other & 63);
+    } else if (solver->cells[other] == SOLVER_MINE) {
+      number--;
+    }
+  }
+  if (empty) {
+    return;
+  }
+
+  solver->num_free--;
+  solver->rows[solver->num_rows++] = row;
+  solver->value[row] = number;
+  solver->pivot[row] = -1;
+  solver->dirty[row] = true;
+
+  // eliminate the pivots it holds, as they were before it came
+  for (int w = 0; w < solver->words; w++) {
+    uint64_t word = pos[w];
+    while (word != 0) {
+      int other = w * 64 + solver__lowest(word);
+      word &= word - 1;
+      int pivot_row = solver->pivot_row[other];
+      if (pivot_row >= 0 && solver__coefficient(row, other, solver) != 0) {
+        solver__combine(row, pivot_row, other, solver);
+      }
+    }
+  }
+  solver__choose_pivot(row, solver);
+}
+
+/**
+ * This function records a tile the board revealed, taking its column out
+ * and adding its number as a row.
+ *
+ * @param tile the tile
+ * @param number the number it shows
+ * @param solver the solver
+ */
+static void solver__reveal(int tile, int number, struct Solver *solver) {
+  enum SolverCell before = (enum SolverCell) solver->cells[tile];
+
+  solver->cells[tile] = SOLVER_REVEALED;
+  if (before == SOLVER_UNKNOWN) {
+    solver__substitute(tile, 0, solver);
+  }
+  solver__add_row(tile, number, solver);
+}
+
+//------------------//
+//   SOLVER STEPS   //
+//------------------//
+
+/**
+ * This function forgets everything and reads the board again, as after
+ * the board was reset for a new game.
+ *
+ * @param solver the solver to be reset
+ */
+void solver__reset(struct Solver *solver) {
+  struct Board *board = solver->board;
+
+  memset(solver->cells, SOLVER_UNKNOWN, solver->num_cells);
+  for (int i = 0; i < solver->num_cells; i++) {
+    solver->pivot_row[i] = -1;
+    solver->free_rows[i] = solver->num_cells - 1 - i;
+  }
+  solver->num_rows = 0;
+  solver->num_free = solver->num_cells;
+  solver->num_safe = 0;
+  solver->next_safe = 0;
+
+  for (int x = 0; x < board__get_x(board); x++) {
+    for (int y = 0; y < board__get_y(board); y++) {
+      char cell = board__get_cell(x, y, board);
+      if (cell >= '0' && cell <= '8') {
+        solver__reveal(x * solver->cols + y, cell - '0', solver);
+      }
+    }
+  }
+}
+
+/**
+ * This function brings the matrix up to date with the tiles the last
+ * move revealed, read from the board's change journal. Call it after
+ * every move, before the journal is cleared; entries read before are
+ * skipped, so a journal that is never cleared works too.
+ *
+ * @param solver the solver
+ */
+void solver__update(struct Solver *solver) {
+  struct Board *board = solver->board;
+
+  for (int i = 0; i < board__get_num_changes(board); i++) {
+    int index = board->changed_cells[i];
+    int tile = board__index_x(index, board) * solver->cols + board__index_y(index, board);
+    char cell = board->board_pointer[index];
+    if (cell >= '0' && cell <= '8' && solver->cells[tile] != SOLVER_REVEALED) {
+      solver__reveal(tile, cell - '0', solver);
+    }
+  }
+}
+
+/**
+ * This function deduces every tile the equations force, substituting
+ * each into the matrix, until no changed row forces more. Safe tiles are
+ * queued for solver__next_safe.
+ *
+ * @param solver the solver
+ *
+ * @return the number of tiles deduced
+ */
+int solver__solve(struct Solver *solver) {
+  int deduced = 0;
+  bool changed = true;
+
+  while (changed) {
+    changed = false;
+    for (int i = 0; i < solver->num_rows;) {
+      int row = solver->rows[i];
+      if (!solver->dirty[row]) {
+        i++;
+        continue;
+      }
+      solver->dirty[row] = false;
+
+      const uint64_t *pos = solver__pos(row, solver);
+      const uint64_t *neg = solver__neg(row, solver);
+      int num_pos = 0;
+      int num_neg = 0;
+      for (int w = 0; w < solver->words; w++) {
+        num_pos += solver__popcount(pos[w]);
+        num_neg += solver__popcount(neg[w]);
+      }
+      if (num_pos + num_neg == 0) {
+        solver__drop_row(i, solver);
+        continue;
+      }
+      if (solver->value[row] != num_pos && solver->value[row] != -num_neg) {
+        i++;
+        continue;
+      }
+
+      // +1 tiles are mines and -1 tiles safe, or the other way round; the
+      // row is copied, as substituting may repivot rows into it
+      int pos_mine = solver->value[row] == num_pos ? 1 : 0;
+      memcpy(solver->scratch, pos, solver->words * sizeof(uint64_t));
+      memcpy(solver->scratch + solver->words, neg, solver->words * sizeof(uint64_t));
+      for (int w = 0; w < 2 * solver->words; w++) {
+        int mine = w < solver->words ? pos_mine : 1 - pos_mine;
+        uint64_t word = solver->scratch[w];
+        while (word != 0) {
+          int tile = (w % solver->words) * 64 + solver__lowest(word);
+          word &= word - 1;
+          solver->cells[tile] = mine ? SOLVER_MINE : SOLVER_SAFE;
+          if (!mine) {
+            solver->safe[solver->num_safe++] = tile;
+          }
+          solver__substitute(tile, mine, solver);
+          deduced++;
+        }
+      }
+      changed = true;
+    }
+  }
+  return deduced;
+}
+
+/**
+ * This function records a tile deduced by other means, such as the
+ * pattern table, and substitutes it into the matrix so the rows it was
+ * in need no work to settle it. The caller vouches for it: a wrong one
+ * makes later deductions wrong. Tiles already known are left alone.
+ *
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param mine whether it holds a mine
+ * @param solver the solver
+ */
+void solver__learn(int x, int y, bool mine, struct Solver *solver) {
+  int tile = x * solver->cols + y;
+
+  if (solver->cells[tile] != SOLVER_UNKNOWN) {
+    return;
+  }
+  solver->cells[tile] = mine ? SOLVER_MINE : SOLVER_SAFE;
+  solver__substitute(tile, mine, solver);
+}
+
+//-------------//
+//   GETTERS   //
+//-------------//
+
+/**
+ * This function hands out the next tile deduced safe that is still
+ * hidden. Returns false if there is none.
+ *
+ * @param x where to store the x coordinate
+ * @param y where to store the y coordinate
+ * @param solver the solver
+ *
+ * @return true if a safe tile was found; false otherwise
+ */
+bool solver__next_safe(int *x, int *y, struct Solver *solver) {
+  while (solver->next_safe < solver->num_safe) {
+    int tile = solver->safe[solver->next_safe++];
+    if (solver->cells[tile] == SOLVER_SAFE) {
+      *x = tile / solver->cols;
+      *y = tile % solver->cols;
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * This function returns what the solver knows about a tile.
+ *
+ * @param x the x coordinate
+ * @param y the y coordinate
+ * @param solver the solver
+ *
+ * @return the state of the tile
+ */
+enum SolverCell solver__get_cell(int x, int y, struct Solver *solver) {
+  return (enum SolverCell) solver->cells[x * solver->cols + y];
+}
+
+/**
+ * This function returns the number of equations in the matrix.
+ *
+ * @param solver the solver
+ *
+ * @return the number of rows
+ */
+int solver__get_num_rows(struct Solver *solver) {
+  return solver->num_rows;
+}
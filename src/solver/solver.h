@@ -0,0 +1,92 @@
+/**
+ * @file solver.h
+ * @brief The header for solver.
+ */
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "board/board.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#define SOLVER_MAX_CELLS (1 << 12) // the most tiles a board the solver reads can have
+
+// what the solver knows about a tile
+enum SolverCell {
+    SOLVER_UNKNOWN,  // hidden, flagged or guessed, and not deduced
+    SOLVER_SAFE,     // hidden, deduced to hold no mine
+    SOLVER_MINE,     // hidden, deduced to hold a mine
+    SOLVER_REVEALED,
+};
+
+// the frontier constraints of a board as linear equations over its hidden tiles:
+// row r says sum(pos) - sum(neg) = value, each set a bitset of tiles x * cols + y
+struct Solver {
+    struct Board*  board;
+    int            cols;
+    int            num_cells;
+    int            words;        // 64 bit words per bitset
+    unsigned char* cells;        // enum SolverCell of each tile
+    uint64_t*      pos;          // num_cells rows of words each
+    uint64_t*      neg;
+    int*           value;
+    int*           pivot;        // the tile row r was solved for, or -1
+    bool*          dirty;        // changed since its bounds were last checked
+    int*           pivot_row;    // the row each tile is the pivot of, or -1
+    int*           rows;         // rows in use
+    int            num_rows;
+    int*           free_rows;    // rows not in use
+    int            num_free;
+    int*           safe;         // tiles deduced safe, in the order they were found
+    int            num_safe;
+    int            next_safe;    // safe tiles before this one were handed out
+    uint64_t*      scratch;      // a copy of the row being settled
+};
+
+/**
+ * This function returns the number of set bits of a word.
+ */
+static inline int solver__popcount(uint64_t word) {
+#if defined(_MSC_VER)
+    return (int) __popcnt64(word);
+#elif defined(__POPCNT__)
+    return __builtin_popcountll(word);
+#else
+    // without the instruction the builtin is a library call
+    word = word - (word >> 1 & 0x5555555555555555ull);
+    word = (word & 0x3333333333333333ull) + (word >> 2 & 0x3333333333333333ull);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return (int) (word * 0x0101010101010101ull >> 56);
+#endif
+}
+
+/**
+ * This function returns the index of the lowest set bit of a nonzero
+ * word.
+ */
+static inline int solver__lowest(uint64_t word) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return (int) index;
+#else
+    return __builtin_ctzll(word);
+#endif
+}
+
+bool solver__create(struct Board* board, struct Solver* solver);
+void solver__destruct(struct Solver* solver);
+void solver__reset(struct Solver* solver);
+void solver__update(struct Solver* solver);
+int  solver__solve(struct Solver* solver);
+void solver__learn(int x, int y, bool mine, struct Solver* solver);
+bool solver__next_safe(int* x, int* y, struct Solver* solver);
+enum SolverCell solver__get_cell(int x, int y, struct Solver* solver);
+int  solver__get_num_rows(struct Solver* solver);
+
+#endif // SOLVER_H
@@ -0,0 +1,210 @@
+/**
+ * @file thread.c
+ * @brief Implementation for the thread functions.
+ *
+ * A thin layer over the platform threads, so the rest of the program can
+ * start threads and use mutexes without caring about the platform.
+ *
+ * Design Philosophy:
+ *
+ * Windows gets the native threads, slim reader/writer locks and condition
+ * variables; everything else gets pthreads. Only what the program needs
+ * is wrapped, and failures other than thread creation are not expected.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE // nanosleep
+#endif
+
+#include <stdlib.h>
+
+#include "thread/thread.h"
+
+#if !defined(_WIN32)
+#include <time.h>
+#include <unistd.h>
+#endif
+
+struct ThreadStart {
+    ThreadFunction function;
+    void*          arg;
+};
+
+#if defined(_WIN32)
+
+/**
+ * This function adapts a ThreadFunction to the Windows entry signature.
+ */
+static DWORD WINAPI thread__entry(LPVOID param) {
+  struct ThreadStart start = *(struct ThreadStart *)param;
+  free(param);
+  start.function(start.arg);
+  return 0;
+}
+
+#else
+
+/**
+ * This function adapts a ThreadFunction to the pthread entry signature.
+ */
+static void *thread__entry(void *param) {
+  struct ThreadStart start = *(struct ThreadStart *)param;
+  free(param);
+  start.function(start.arg);
+  return NULL;
+}
+
+#endif
+
+/**
+ * This function starts a thread running the given function. Returns
+ * false if the thread could not be started.
+ *
+ * @param function the function to run
+ * @param arg the argument passed to the function
+ * @param thread where to store the thread handle
+ *
+ * @return true if started; false otherwise
+ */
+bool thread__create(ThreadFunction function, void *arg, Thread *thread) {
+  struct ThreadStart *start = (struct ThreadStart *)malloc(sizeof(struct ThreadStart));
+  if (start == NULL) {
+    return false;
+  }
+  start->function = function;
+  start->arg = arg;
+
+#if defined(_WIN32)
+  *thread = CreateThread(NULL, 0, thread__entry, start, 0, NULL);
+  if (*thread == NULL) {
+    free(start);
+    return false;
+  }
+#else
+  if (pthread_create(thread, NULL, thread__entry, start) != 0) {
+    free(start);
+    return false;
+  }
+#endif
+  return true;
+}
+
+/**
+ * This function waits for a thread to finish.
+ *
+ * @param thread the thread to wait for
+ */
+void thread__join(Thread *thread) {
+#if defined(_WIN32)
+  WaitForSingleObject(*thread, INFINITE);
+  CloseHandle(*thread);
+#else
+  pthread_join(*thread, NULL);
+#endif
+}
+
+/**
+ * This function returns the number of hardware threads, at least 1.
+ *
+ * @return the number of hardware threads
+ */
+int thread__hardware_concurrency() {
+#if defined(_WIN32)
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwNumberOfProcessors > 0 ? (int) info.dwNumberOfProcessors : 1;
+#else
+  long count = sysconf(_SC_NPROCESSORS_ONLN);
+  return count > 0 ? (int) count : 1;
+#endif
+}
+
+/**
+ * This function suspends the calling thread for a number of
+ * milliseconds.
+ *
+ * @param ms the milliseconds to sleep
+ */
+void thread__sleep(int ms) {
+#if defined(_WIN32)
+  Sleep((DWORD) ms);
+#else
+  struct timespec duration = {ms / 1000, (long) (ms % 1000) * 1000000};
+  nanosleep(&duration, NULL);
+#endif
+}
+
+//-------------//
+//   MUTEXES   //
+//-------------//
+
+void thread__mutex_init(Mutex *mutex) {
+#if defined(_WIN32)
+  InitializeSRWLock(mutex);
+#else
+  pthread_mutex_init(mutex, NULL);
+#endif
+}
+
+void thread__mutex_destroy(Mutex *mutex) {
+#if defined(_WIN32)
+  (void) mutex;
+#else
+  pthread_mutex_destroy(mutex);
+#endif
+}
+
+void thread__mutex_lock(Mutex *mutex) {
+#if defined(_WIN32)
+  AcquireSRWLockExclusive(mutex);
+#else
+  pthread_mutex_lock(mutex);
+#endif
+}
+
+void thread__mutex_unlock(Mutex *mutex) {
+#if defined(_WIN32)
+  ReleaseSRWLockExclusive(mutex);
+#else
+  pthread_mutex_unlock(mutex);
+#endif
+}
+
+//-------------------------//
+//   CONDITION VARIABLES   //
+//-------------------------//
+
+void thread__cond_init(Cond *cond) {
+#if defined(_WIN32)
+  InitializeConditionVariable(cond);
+#else
+  pthread_cond_init(cond, NULL);
+#endif
+}
+
+void thread__cond_destroy(Cond *cond) {
+#if defined(_WIN32)
+  (void) cond;
+#else
+  pthread_cond_destroy(cond);
+#endif
+}
+
+void thread__cond_wait(Cond *cond, Mutex *mutex) {
+#if defined(_WIN32)
+  SleepConditionVariableSRW(cond, mutex, INFINITE, 0);
+#else
+  pthread_cond_wait(cond, mutex);
+#endif
+}
+
+void thread__cond_broadcast(Cond *cond) {
+#if defined(_WIN32)
+  WakeAllConditionVariable(cond);
+#else
+  pthread_cond_broadcast(cond);
+#endif
+}
@@ -0,0 +1,39 @@
+/**
+ * @file thread.h
+ * @brief The header for thread.
+ */
+#ifndef THREAD_H
+#define THREAD_H
+
+#include <stdbool.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+typedef HANDLE             Thread;
+typedef SRWLOCK            Mutex;
+typedef CONDITION_VARIABLE Cond;
+#else
+#include <pthread.h>
+typedef pthread_t       Thread;
+typedef pthread_mutex_t Mutex;
+typedef pthread_cond_t  Cond;
+#endif
+
+typedef void (*ThreadFunction)(void* arg);
+
+bool thread__create(ThreadFunction function, void* arg, Thread* thread);
+void thread__join(Thread* thread);
+int  thread__hardware_concurrency();
+void thread__sleep(int ms);
+
+void thread__mutex_init(Mutex* mutex);
+void thread__mutex_destroy(Mutex* mutex);
+void thread__mutex_lock(Mutex* mutex);
+void thread__mutex_unlock(Mutex* mutex);
+
+void thread__cond_init(Cond* cond);
+void thread__cond_destroy(Cond* cond);
+void thread__cond_wait(Cond* cond, Mutex* mutex);
+void thread__cond_broadcast(Cond* cond);
+
+#endif // THREAD_H
@@ -0,0 +1,165 @@
+/**
+ * @file thread_pool.c
+ * @brief Implementation for the thread pool.
+ *
+ * A fixed set of worker threads that run numbered tasks in parallel.
+ *
+ * Design Philosophy:
+ *
+ * The workers are started once and sleep between runs, so a run costs a
+ * wake up instead of a thread start and never allocates. thread_pool__run
+ * blocks until every task is done, and the calling thread works on tasks
+ * too, so a pool of zero workers simply runs everything serially. Tasks
+ * are handed out one at a time through an atomic counter, which balances
+ * uneven tasks without any locking.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#include <stdlib.h>
+
+#include "thread/thread_pool.h"
+
+/**
+ * This function runs tasks of the current run until none are left.
+ *
+ * @param pool the pool to take tasks from
+ */
+static void thread_pool__work(struct ThreadPool *pool) {
+  for (;;) {
+    int task = atomic_fetch_add_explicit(&pool->next_task, 1, memory_order_relaxed);
+    if (task >= pool->num_tasks) {
+      return;
+    }
+    pool->task(pool->context, task);
+  }
+}
+
+/**
+ * This function is the main loop of a worker thread: wait for a run,
+ * work on it, report back, repeat until the pool stops.
+ *
+ * @param arg the pool
+ */
+static void thread_pool__worker(void *arg) {
+  struct ThreadPool *pool = (struct ThreadPool *)arg;
+  unsigned long seen = 0;
+
+  thread__mutex_lock(&pool->mutex);
+  for (;;) {
+    while (pool->generation == seen && !pool->stopping) {
+      thread__cond_wait(&pool->wake, &pool->mutex);
+    }
+    if (pool->stopping) {
+      break;
+    }
+    seen = pool->generation;
+    thread__mutex_unlock(&pool->mutex);
+
+    thread_pool__work(pool);
+
+    thread__mutex_lock(&pool->mutex);
+    if (--pool->busy == 0) {
+      thread__cond_broadcast(&pool->done);
+    }
+  }
+  thread__mutex_unlock(&pool->mutex);
+}
+
+/**
+ * This function starts a pool with the given number of worker threads.
+ * Returns false if the threads could not be started or out of memory.
+ *
+ * @param num_threads the number of workers, 0 for a serial pool
+ * @param pool the pool to be built
+ *
+ * @return true if started; false otherwise
+ */
+bool thread_pool__create(int num_threads, struct ThreadPool *pool) {
+  pool->num_threads = 0;
+  pool->generation = 0;
+  pool->stopping = false;
+  pool->num_tasks = 0;
+  pool->busy = 0;
+  atomic_init(&pool->next_task, 0);
+  thread__mutex_init(&pool->mutex);
+  thread__cond_init(&pool->wake);
+  thread__cond_init(&pool->done);
+
+  pool->threads = num_threads > 0 ? (Thread *)malloc(num_threads * sizeof(Thread)) : NULL;
+  if (num_threads > 0 && pool->threads == NULL) {
+    thread_pool__destruct(pool);
+    return false;
+  }
+  for (int i = 0; i < num_threads; i++) {
+    if (!thread__create(thread_pool__worker, pool, &pool->threads[i])) {
+      thread_pool__destruct(pool);
+      return false;
+    }
+    pool->num_threads++;
+  }
+  return true;
+}
+
+/**
+ * This function stops the workers of the pool and frees it.
+ *
+ * @param pool the pool to be freed
+ */
+void thread_pool__destruct(struct ThreadPool *pool) {
+  thread__mutex_lock(&pool->mutex);
+  pool->stopping = true;
+  thread__cond_broadcast(&pool->wake);
+  thread__mutex_unlock(&pool->mutex);
+
+  for (int i = 0; i < pool->num_threads; i++) {
+    thread__join(&pool->threads[i]);
+  }
+  free(pool->threads);
+  pool->threads = NULL;
+  pool->num_threads = 0;
+
+  thread__cond_destroy(&pool->done);
+  thread__cond_destroy(&pool->wake);
+  thread__mutex_destroy(&pool->mutex);
+}
+
+/**
+ * This function runs task(context, i) for every i in [0, num_tasks) on
+ * the pool and the calling thread, and returns when all are done.
+ *
+ * @param num_tasks the number of tasks
+ * @param task the function to run for each task
+ * @param context passed to every task
+ * @param pool the pool to run on
+ */
+void thread_pool__run(int num_tasks, ThreadPoolTask task, void *context, struct ThreadPool *pool) {
+  if (num_tasks <= 0) {
+    return;
+  }
+  if (pool->num_threads == 0 || num_tasks == 1) {
+    for (int i = 0; i < num_tasks; i++) {
+      task(context, i);
+    }
+    return;
+  }
+
+  thread__mutex_lock(&pool->mutex);
+  pool->task = task;
+  pool->context = context;
+  pool->num_tasks = num_tasks;
+  atomic_store_explicit(&pool->next_task, 0, memory_order_relaxed);
+  pool->busy = pool->num_threads;
+  pool->generation++;
+  thread__cond_broadcast(&pool->wake);
+  thread__mutex_unlock(&pool->mutex);
+
+  thread_pool__work(pool);
+
+  thread__mutex_lock(&pool->mutex);
+  while (pool->busy > 0) {
+    thread__cond_wait(&pool->done, &pool->mutex);
+  }
+  thread__mutex_unlock(&pool->mutex);
+}
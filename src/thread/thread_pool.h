@@ -0,0 +1,34 @@
+/**
+ * @file thread_pool.h
+ * @brief The header for thread pool.
+ */
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+
+#include "thread/thread.h"
+
+typedef void (*ThreadPoolTask)(void* context, int task);
+
+struct ThreadPool {
+    Thread*        threads;
+    int            num_threads; // workers, the calling thread is not counted
+    Mutex          mutex;
+    Cond           wake;
+    Cond           done;
+    unsigned long  generation;
+    bool           stopping;
+    ThreadPoolTask task;
+    void*          context;
+    int            num_tasks;
+    atomic_int     next_task;
+    int            busy;
+};
+
+bool thread_pool__create(int num_threads, struct ThreadPool* pool);
+void thread_pool__destruct(struct ThreadPool* pool);
+void thread_pool__run(int num_tasks, ThreadPoolTask task, void* context, struct ThreadPool* pool);
+
+#endif // THREAD_POOL_H
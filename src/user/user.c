@@ -15,42 +15,63 @@
  */
 
 #include "user/user.h"
+#include "game/game.h"
+#include "thread/thread.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #define MAX_USERS 100
-#define MAX_NAME_LEN 32
 #define USER_FILE "users.txt"
+#define USER_STATS_FILE "%s_stats.txt"
 
 static struct User user_list[MAX_USERS];
 static int user_count = 0;
 static struct User* current_user = NULL;
 
+// guards the list, the scores and the stats files, which race players update from their own threads
+static Mutex user_lock;
+static bool user_lock_ready = false;
+
 /**
- * @brief Initialize user system, load users from file, and select or add a user.
+ * @brief Load the users from file.
  *
- * This function loads all users from USER_FILE, prints the user list,
- * and prompts the user to select or add a user. Sets the current_user pointer.
+ * This function loads all users from USER_FILE into the user list. It must
+ * run before any other user function, and before any thread is started.
  */
-void user__init() {
-    // Load user data
+void user__load() {
+    if (!user_lock_ready) {
+        thread__mutex_init(&user_lock);
+        user_lock_ready = true;
+    }
+
     FILE* fp = fopen(USER_FILE, "r");
     if (fp) {
-        char name[MAX_NAME_LEN];
+        char name[USER_NAME_LEN];
         int score;
         while (fscanf(fp, "%31s %d", name, &score) == 2 && user_count < MAX_USERS) {
-            user_list[user_count].name = strdup(name);
+            strcpy(user_list[user_count].name, name);
             user_list[user_count].total_scores = score;
             user_count++;
         }
         fclose(fp);
     }
+}
+
+/**
+ * @brief Initialize user system, load users from file, and select or add a user.
+ *
+ * This function loads all users from USER_FILE, prints the user list,
+ * and prompts the user to select or add a user. Sets the current_user pointer.
+ */
+void user__init() {
+    // Load user data
+    user__load();
 
     // Choose a user
     user__print_user_list();
     printf("Please choose a user by name, or add a new user by typing a new name: ");
-    char input[MAX_NAME_LEN];
+    char input[USER_NAME_LEN];
     scanf("%31s", input);
     if (user__choose_user(input) != NULL) {
         printf("User %s chosen.\n", input);
@@ -71,9 +92,11 @@ void user__save() {
         return;
     }
 
+    thread__mutex_lock(&user_lock);
     for (int i = 0; i < user_count; ++i) {
         fprintf(fp, "%s %d\n", user_list[i].name, user_list[i].total_scores);
     }
+    thread__mutex_unlock(&user_lock);
     fclose(fp);
 }
 
@@ -118,17 +141,59 @@ struct User* user__choose_user(char* name) {
  * @return Pointer to the new User struct, or NULL if failed.
  */
 struct User* user__add_user(char* name) {
-    if (user_count >= MAX_USERS) return NULL;
+    if (user_count >= MAX_USERS || strlen(name) >= USER_NAME_LEN) return NULL;
     for (int i = 0; i < user_count; ++i) {
         if (strcmp(user_list[i].name, name) == 0) return NULL;
     }
-    user_list[user_count].name = strdup(name);
+    strcpy(user_list[user_count].name, name);
     user_list[user_count].total_scores = 0;
     current_user = &user_list[user_count];
     user_count++;
     return current_user;
 }
 
+/**
+ * @brief Find a user by name, adding them if there is none, without
+ * choosing them.
+ *
+ * Safe to call from several threads at once, so every player of a race
+ * can be looked up while the current user stays who it was.
+ *
+ * @param name The name of the user.
+ * @return Pointer to the User struct, or NULL if the list is full.
+ */
+struct User* user__get_user(const char* name) {
+    struct User* user = NULL;
+
+    thread__mutex_lock(&user_lock);
+    for (int i = 0; i < user_count && user == NULL; ++i) {
+        if (strcmp(user_list[i].name, name) == 0) {
+            user = &user_list[i];
+        }
+    }
+    if (user == NULL && user_count < MAX_USERS && strlen(name) < USER_NAME_LEN) {
+        strcpy(user_list[user_count].name, name);
+        user_list[user_count].total_scores = 0;
+        user = &user_list[user_count++];
+    }
+    thread__mutex_unlock(&user_lock);
+    return user;
+}
+
+/**
+ * @brief Add points to a user's total score.
+ *
+ * Safe to call from several threads at once, also for the same user.
+ *
+ * @param user The user to credit.
+ * @param score The points to add.
+ */
+void user__add_score(struct User* user, int score) {
+    thread__mutex_lock(&user_lock);
+    user->total_scores += score;
+    thread__mutex_unlock(&user_lock);
+}
+
 /**
  * @brief Print the current user.
  *
@@ -149,4 +214,36 @@ void user__print_current_user() {
  */
 struct User* user__get_current_user() {
     return current_user;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Append the statistics of a finished game to the user's stats file.
+ *
+ * Each user has their own file, one line per game, so leaderboards and
+ * bot evaluation can rank by these numbers without replaying games.
+ * Safe to call from several threads at once; their lines do not mix.
+ *
+ * @param user The user who played the game.
+ * @param stats The statistics of the game.
+ */
+void user__record_stats(struct User* user, const struct GameStats* stats) {
+    char path[USER_NAME_LEN + sizeof(USER_STATS_FILE)];
+    snprintf(path, sizeof(path), USER_STATS_FILE, user->name);
+
+    thread__mutex_lock(&user_lock);
+    FILE* fp = fopen(path, "a");
+    if (!fp) {
+        thread__mutex_unlock(&user_lock);
+        return;
+    }
+
+    // A new file starts with the column names
+    fseek(fp, 0, SEEK_END);
+    if (ftell(fp) == 0) {
+        fprintf(fp, "won 3bv 3bv_solved turns seconds 3bv_per_second efficiency wasted_flags openings_used\n");
+    }
+    fprintf(fp, "%d %d %d %d %.0f %.3f %.3f %d %d\n", stats->won, stats->bbbv, stats->bbbv_solved, stats->turns,
+            stats->seconds, stats->bbbv_per_second, stats->efficiency, stats->wasted_flags, stats->openings_used);
+    fclose(fp);
+    thread__mutex_unlock(&user_lock);
+}
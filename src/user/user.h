@@ -7,17 +7,25 @@
 
 #include <stdbool.h>
 
+struct GameStats;
+
+#define USER_NAME_LEN 32 // longest name plus its terminator
+
 struct User {
-    char* name;
-    int   total_scores;
+    char name[USER_NAME_LEN];
+    int  total_scores;
 };
 
+void         user__load();
 void         user__init();
 void         user__save();
 void         user__print_user_list();
 struct User* user__choose_user(char* name);
 struct User* user__add_user(char* name);
+struct User* user__get_user(const char* name);
+void         user__add_score(struct User* user, int score);
 void         user__print_current_user();
 struct User* user__get_current_user();
+void         user__record_stats(struct User* user, const struct GameStats* stats);
 
 #endif // USER_H
\ No newline at end of file
@@ -0,0 +1,128 @@
+/**
+ * @file gen_pattern_table.c
+ * @brief Generator for the local pattern table of the solver.
+ *
+ * Prints src/solver/pattern_table.h, the table patterns.c looks local
+ * deductions up in. Run it again only if the key or the entries change:
+ *
+ *     gen_pattern_table > src/solver/pattern_table.h
+ *
+ * Design Philosophy:
+ *
+ * Two numbered tiles A and B that share hidden neighbors split the
+ * hidden tiles around them into three groups: around A only, around
+ * both, around B only. Tiles in one group are interchangeable, so what
+ * the two numbers force depends only on the size of each group and on
+ * how many mines each number still needs, not on where the tiles are.
+ * The key is those five counts, each 0 to 8; a single number is the key
+ * with B needing no mines and having no tiles.
+ *
+ * For every key the generator tries every split of the mines over the
+ * groups that satisfies both numbers. A group that is empty in every
+ * split is safe, one that is full in every split is mines. Keys no
+ * split satisfies force nothing, since the board must have been misread
+ * (a wrong flag) to give them.
+ *
+ * @author daoge_cmd
+ * @date October 18, 2026
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#define PATTERN_RADIX 9 // each count is 0 to 8, the most neighbors a tile has
+
+enum { GROUP_SAFE = 1, GROUP_MINE = 2 };
+
+/**
+ * This function works out what a key forces: two bits for each group,
+ * A only in the low bits, then both, then B only.
+ *
+ * @param need_a the mines A still needs
+ * @param need_b the mines B still needs
+ * @param only_a the hidden tiles around A only
+ * @param shared the hidden tiles around both
+ * @param only_b the hidden tiles around B only
+ *
+ * @return the entry of the key
+ */
+static int gen__entry(int need_a, int need_b, int only_a, int shared, int only_b) {
+  int sizes[3] = {only_a, shared, only_b};
+  bool can_empty[3] = {false, false, false};
+  bool can_full[3] = {false, false, false};
+  bool other[3] = {false, false, false}; // some split leaves the group neither empty nor full
+  bool any = false;
+
+  for (int in_shared = 0; in_shared <= shared; in_shared++) {
+    int mines[3] = {need_a - in_shared, in_shared, need_b - in_shared};
+    if (mines[0] < 0 || mines[0] > only_a || mines[2] < 0 || mines[2] > only_b) {
+      continue;
+    }
+    any = true;
+    for (int g = 0; g < 3; g++) {
+      can_empty[g] |= mines[g] == 0;
+      can_full[g] |= mines[g] == sizes[g];
+      other[g] |= mines[g] != 0 && mines[g] != sizes[g];
+    }
+  }
+  if (!any) {
+    return 0;
+  }
+
+  int entry = 0;
+  for (int g = 0; g < 3; g++) {
+    if (sizes[g] == 0 || other[g] || (can_empty[g] && can_full[g])) {
+      continue;
+    }
+    entry |= (can_empty[g] ? GROUP_SAFE : GROUP_MINE) << (2 * g);
+  }
+  return entry;
+}
+
+/**
+ * This function prints the table as a C header.
+ *
+ * @return the exit code
+ */
+int main() {
+  int keys = PATTERN_RADIX * PATTERN_RADIX * PATTERN_RADIX * PATTERN_RADIX * PATTERN_RADIX;
+
+  printf("/**\n");
+  printf(" * @file pattern_table.h\n");
+  printf(" * @brief The local pattern table, generated by tools/gen_pattern_table.c.\n");
+  printf(" *\n");
+  printf(" * Do not edit: run gen_pattern_table > src/solver/pattern_table.h instead.\n");
+  printf(" */\n");
+  printf("#ifndef PATTERN_TABLE_H\n");
+  printf("#define PATTERN_TABLE_H\n\n");
+  printf("#define PATTERN_RADIX %d\n", PATTERN_RADIX);
+  printf("#define PATTERN_KEYS  %d\n\n", keys);
+  printf("// indexed by (((need_a * 9 + need_b) * 9 + only_a) * 9 + shared) * 9 + only_b; two bits\n");
+  printf("// for each group, A only in the low bits, then both, then B only: 1 safe, 2 mines\n");
+  printf("static const unsigned char PATTERN_TABLE[PATTERN_KEYS] = {\n");
+
+  // three values of shared to a line
+  int key = 0;
+  for (int need_a = 0; need_a < PATTERN_RADIX; need_a++) {
+    for (int need_b = 0; need_b < PATTERN_RADIX; need_b++) {
+      for (int only_a = 0; only_a < PATTERN_RADIX; only_a++) {
+        for (int shared = 0; shared < PATTERN_RADIX; shared++) {
+          if (shared % 3 == 0) {
+            printf("   ");
+          }
+          for (int only_b = 0; only_b < PATTERN_RADIX; only_b++) {
+            printf("%s%2d,", only_b == 0 ? " " : "", gen__entry(need_a, need_b, only_a, shared, only_b));
+            key++;
+          }
+          if (shared % 3 == 2) {
+            printf("\n");
+          }
+        }
+      }
+    }
+  }
+
+  printf("};\n\n");
+  printf("#endif // PATTERN_TABLE_H\n");
+  return key == keys ? 0 : 1;
+}
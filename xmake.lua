@@ -1,10 +1,45 @@
 add_rules('mode.debug', 'mode.release')
 
+set_version('0.2.0')
+set_languages('c23')
+set_optimize('fastest')
+add_includedirs('src')
+
+-- MSVC only takes <stdatomic.h> behind this switch
+if is_plat('windows') then
+    add_cflags('/experimental:c11atomics', {tools = 'cl'})
+end
+
+-- the engine library, no I/O; xmake f -k shared builds it as a shared library
+target('libminesweeper')
+    set_kind('$(kind)')
+    if not is_plat('windows') then
+        set_basename('minesweeper')
+    end
+    add_files('src/alloc/*.c', 'src/board/*.c', 'src/coop/*.c', 'src/endless/*.c', 'src/engine/*.c', 'src/env/*.c', 'src/game/game.c', 'src/game/game_events.c', 'src/pregen/*.c', 'src/rng/*.c', 'src/solver/*.c', 'src/thread/*.c')
+    if is_mode('debug') then
+        add_defines('MINESWEEPER_ALLOC_DEBUG')
+    end
+    if is_kind('shared') then
+        add_defines('MINESWEEPER_SHARED', {public = true})
+        add_defines('MINESWEEPER_BUILDING')
+        set_symbols('hidden')
+    end
+    if is_plat('linux', 'macosx') then
+        add_syslinks('pthread', 'm', {public = true})
+    end
+
 target('minesweeper')
     set_kind('binary')
-    add_files('src/**.c')
-    add_includedirs('src')
-    set_version('0.2.0')
-    set_languages('c23')
-    set_optimize('fastest')
+    add_deps('libminesweeper')
+    add_files('src/**.c|alloc/*.c|board/*.c|coop/*.c|endless/*.c|engine/*.c|env/*.c|game/game.c|game/game_events.c|pregen/*.c|rng/*.c|solver/*.c|thread/*.c')
     set_rundir('$(projectdir)')
+    if is_plat('linux', 'macosx') then
+        add_syslinks('m')
+    end
+
+-- generator of src/solver/pattern_table.h, run by hand when the table changes
+target('gen_pattern_table')
+    set_kind('binary')
+    set_default(false)
+    add_files('tools/gen_pattern_table.c')